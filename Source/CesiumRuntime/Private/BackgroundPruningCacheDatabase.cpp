@@ -0,0 +1,64 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "BackgroundPruningCacheDatabase.h"
+#include "CesiumRuntime.h"
+#include "UnrealTaskProcessor.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CacheItem.h>
+THIRD_PARTY_INCLUDES_END
+
+using namespace CesiumAsync;
+
+BackgroundPruningCacheDatabase::BackgroundPruningCacheDatabase(
+    const std::shared_ptr<ICacheDatabase>& pDatabase)
+    : _pDatabase(pDatabase),
+      _pPruning(std::make_shared<std::atomic<bool>>(false)) {}
+
+std::optional<CacheItem>
+BackgroundPruningCacheDatabase::getEntry(const std::string& key) const {
+  return this->_pDatabase->getEntry(key);
+}
+
+bool BackgroundPruningCacheDatabase::storeEntry(
+    const std::string& key,
+    std::time_t expiryTime,
+    const std::string& url,
+    const std::string& requestMethod,
+    const HttpHeaders& requestHeaders,
+    uint16_t statusCode,
+    const HttpHeaders& responseHeaders,
+    const std::span<const std::byte>& responseData) {
+  return this->_pDatabase->storeEntry(
+      key,
+      expiryTime,
+      url,
+      requestMethod,
+      requestHeaders,
+      statusCode,
+      responseHeaders,
+      responseData);
+}
+
+bool BackgroundPruningCacheDatabase::prune() {
+  if (this->_pPruning->exchange(true)) {
+    return true;
+  }
+
+  // The task holds its own references, so that it can outlive this object.
+  UnrealTaskProcessor::ScopedPriority scope(
+      UnrealTaskProcessor::Priority::Background);
+  getAsyncSystem().runInWorkerThread(
+      [pDatabase = this->_pDatabase, pPruning = this->_pPruning]() {
+        TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::PruneRequestCache)
+        pDatabase->prune();
+        pPruning->store(false);
+      });
+
+  return true;
+}
+
+bool BackgroundPruningCacheDatabase::clearAll() {
+  return this->_pDatabase->clearAll();
+}
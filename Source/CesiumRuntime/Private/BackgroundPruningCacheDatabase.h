@@ -0,0 +1,54 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "HAL/Platform.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <CesiumAsync/ICacheDatabase.h>
+THIRD_PARTY_INCLUDES_END
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+/**
+ * An {@link CesiumAsync::ICacheDatabase} that forwards to another cache, but
+ * prunes it in the background lane of the Cesium worker pool.
+ *
+ * `CachingAssetAccessor` prunes the cache periodically from whatever thread
+ * happens to complete a request. Pruning is never needed to render a tile, so
+ * this defers it behind all visible and preload work instead. At most one
+ * prune is in flight at a time; requests to prune while one is in flight are
+ * ignored.
+ */
+class BackgroundPruningCacheDatabase : public CesiumAsync::ICacheDatabase {
+public:
+  explicit BackgroundPruningCacheDatabase(
+      const std::shared_ptr<CesiumAsync::ICacheDatabase>& pDatabase);
+
+  virtual std::optional<CesiumAsync::CacheItem>
+  getEntry(const std::string& key) const override;
+
+  virtual bool storeEntry(
+      const std::string& key,
+      std::time_t expiryTime,
+      const std::string& url,
+      const std::string& requestMethod,
+      const CesiumAsync::HttpHeaders& requestHeaders,
+      uint16_t statusCode,
+      const CesiumAsync::HttpHeaders& responseHeaders,
+      const std::span<const std::byte>& responseData) override;
+
+  /**
+   * Starts pruning the underlying cache in the background lane, and returns
+   * immediately.
+   */
+  virtual bool prune() override;
+
+  virtual bool clearAll() override;
+
+private:
+  std::shared_ptr<CesiumAsync::ICacheDatabase> _pDatabase;
+  std::shared_ptr<std::atomic<bool>> _pPruning;
+};
@@ -19,9 +19,11 @@
 #include "CesiumGltfPointsSceneProxyUpdater.h"
 #include "CesiumGltfPrimitiveComponent.h"
 #include "CesiumLifetime.h"
+#include "CesiumMaterialInstancePool.h"
 #include "CesiumRasterOverlay.h"
 #include "CesiumRuntime.h"
 #include "CesiumRuntimeSettings.h"
+#include "CesiumTextureBudget.h"
 #include "CesiumTileExcluder.h"
 #include "CesiumViewExtension.h"
 #include "CesiumVoxelRendererComponent.h"
@@ -42,6 +44,7 @@
 #include "PixelFormat.h"
 #include "StereoRendering.h"
 #include "UnrealPrepareRendererResources.h"
+#include "UnrealTaskProcessor.h"
 #include "VecMath.h"
 
 THIRD_PARTY_INCLUDES_START
@@ -155,88 +158,287 @@ void ACesium3DTileset::SetMobility(EComponentMobility::Type NewMobility) {
   }
 }
 
-void ACesium3DTileset::SampleHeightMostDetailed(
-    const TArray<FVector>& LongitudeLatitudeHeightArray,
-    FCesiumSampleHeightMostDetailedCallback OnHeightsSampled) {
-  // It's possible to call this function before a Tick happens, so make sure
-  // that the necessary variables are resolved.
-  this->ResolveGeoreference();
-  this->ResolveCameraManager();
-  this->ResolveCreditSystem();
-
-  if (this->_pTileset == nullptr) {
-    this->LoadTileset();
-  }
+namespace {
 
+std::vector<CesiumGeospatial::Cartographic>
+toCartographics(TConstArrayView<FVector> longitudeLatitudeHeights) {
   std::vector<CesiumGeospatial::Cartographic> positions;
-  positions.reserve(LongitudeLatitudeHeightArray.Num());
+  positions.reserve(longitudeLatitudeHeights.Num());
 
-  for (const FVector& position : LongitudeLatitudeHeightArray) {
+  for (const FVector& position : longitudeLatitudeHeights) {
     positions.emplace_back(CesiumGeospatial::Cartographic::fromDegrees(
         position.X,
         position.Y,
         position.Z));
   }
 
-  auto sampleHeights = [this, &positions]() mutable {
-    if (this->_pTileset) {
-      return this->_pTileset->sampleHeightMostDetailed(positions)
-          .catchImmediately([positions = std::move(positions)](
-                                std::exception&& exception) mutable {
-            std::vector<bool> sampleSuccess(positions.size(), false);
-            return Cesium3DTilesSelection::SampleHeightResult{
-                std::move(positions),
-                std::move(sampleSuccess),
-                {exception.what()}};
-          });
-    } else {
-      std::vector<bool> sampleSuccess(positions.size(), false);
-      return getAsyncSystem().createResolvedFuture(
-          Cesium3DTilesSelection::SampleHeightResult{
+  return positions;
+}
+
+CesiumAsync::Future<Cesium3DTilesSelection::SampleHeightResult> sampleHeights(
+    Cesium3DTilesSelection::Tileset* pTileset,
+    std::vector<CesiumGeospatial::Cartographic>&& positions) {
+  if (pTileset) {
+    return pTileset->sampleHeightMostDetailed(positions).catchImmediately(
+        [positions = std::move(positions)](
+            std::exception&& exception) mutable {
+          std::vector<bool> sampleSuccess(positions.size(), false);
+          return Cesium3DTilesSelection::SampleHeightResult{
               std::move(positions),
               std::move(sampleSuccess),
-              {"Could not sample heights from tileset because it has not "
-               "been created."}});
+              {exception.what()}};
+        });
+  } else {
+    std::vector<bool> sampleSuccess(positions.size(), false);
+    return getAsyncSystem().createResolvedFuture(
+        Cesium3DTilesSelection::SampleHeightResult{
+            std::move(positions),
+            std::move(sampleSuccess),
+            {"Could not sample heights from tileset because it has not "
+             "been created."}});
+  }
+}
+
+void toUnrealSampleHeightResults(
+    Cesium3DTilesSelection::SampleHeightResult&& result,
+    TArray<FCesiumSampleHeightResult>& sampleHeightResults,
+    TArray<FString>& warnings) {
+  check(result.positions.size() == result.sampleSuccess.size());
+
+  // This should do nothing, but will prevent undefined behavior if
+  // the array sizes are unexpectedly different.
+  result.sampleSuccess.resize(result.positions.size(), false);
+
+  sampleHeightResults.Reserve(result.positions.size());
+
+  for (size_t i = 0; i < result.positions.size(); ++i) {
+    const CesiumGeospatial::Cartographic& position = result.positions[i];
+
+    FCesiumSampleHeightResult unrealResult;
+    unrealResult.LongitudeLatitudeHeight = FVector(
+        CesiumUtility::Math::radiansToDegrees(position.longitude),
+        CesiumUtility::Math::radiansToDegrees(position.latitude),
+        position.height);
+    unrealResult.SampleSuccess = result.sampleSuccess[i];
+
+    sampleHeightResults.Emplace(std::move(unrealResult));
+  }
+
+  warnings.Reserve(result.warnings.size());
+
+  for (const std::string& warning : result.warnings) {
+    warnings.Emplace(UTF8_TO_TCHAR(warning.c_str()));
+  }
+}
+
+/**
+ * Marks every result as failed, and restores its original height, because
+ * the tileset it was sampled from has been destroyed.
+ */
+void failSampleHeightResults(
+    TConstArrayView<FVector> positions,
+    TArray<FCesiumSampleHeightResult>& sampleHeightResults,
+    TArray<FString>& warnings) {
+  for (int32 i = 0; i < sampleHeightResults.Num(); ++i) {
+    sampleHeightResults[i].SampleSuccess = false;
+    if (positions.IsValidIndex(i)) {
+      sampleHeightResults[i].LongitudeLatitudeHeight = positions[i];
     }
-  };
+  }
+  warnings.Emplace(TEXT("The tileset was destroyed before sampling finished."));
+}
+
+/**
+ * The state of a query started with
+ * ACesium3DTileset::SampleHeightMostDetailedStreaming. It is only accessed
+ * from the game thread.
+ */
+struct StreamingHeightQuery {
+  TWeakObjectPtr<ACesium3DTileset> pTileset;
+  TArray<FVector> positions;
+  int32 chunkSize;
+  int32 maxConcurrentChunks;
+  int32 nextChunkStart = 0;
+  int32 chunksInFlight = 0;
+  FCesiumSampleHeightChunkCallback onChunkSampled;
+  FCesiumSampleHeightQueryCompleteCallback onComplete;
+  TSharedRef<FCesiumSampleHeightQuery> pHandle;
+
+  /**
+   * Whether sampleNextHeightChunks is currently starting chunks. Chunks that
+   * complete immediately while it does so leave it to start the next ones.
+   */
+  bool startingChunks = false;
+  bool completed = false;
+};
+
+void sampleNextHeightChunks(const TSharedRef<StreamingHeightQuery>& pQuery) {
+  // A chunk's future may already be resolved when it is started, in which
+  // case its continuation runs inside the loop below. Starting more chunks
+  // from there would nest one stack frame per chunk, so the continuation
+  // returns here instead and this loop picks up where it left off.
+  if (pQuery->startingChunks)
+    return;
+
+  pQuery->startingChunks = true;
+
+  while (!pQuery->pHandle->IsCancelled() &&
+         pQuery->chunksInFlight < pQuery->maxConcurrentChunks &&
+         pQuery->nextChunkStart < pQuery->positions.Num()) {
+    ACesium3DTileset* pTileset = pQuery->pTileset.Get();
+    if (!IsValid(pTileset))
+      break;
+
+    const int32 chunkStart = pQuery->nextChunkStart;
+    const int32 chunkCount = FMath::Min(
+        pQuery->chunkSize,
+        pQuery->positions.Num() - chunkStart);
+
+    // Update the state before sampling, because the future may already be
+    // resolved, in which case the continuation below runs immediately.
+    pQuery->nextChunkStart += chunkCount;
+    ++pQuery->chunksInFlight;
+
+    sampleHeights(
+        pTileset->GetTileset(),
+        toCartographics(
+            MakeArrayView(pQuery->positions).Slice(chunkStart, chunkCount)))
+        .thenImmediately(
+            [pQuery, chunkStart, chunkCount](
+                Cesium3DTilesSelection::SampleHeightResult&& result) {
+              --pQuery->chunksInFlight;
+
+              if (!pQuery->pHandle->IsCancelled()) {
+                TArray<FCesiumSampleHeightResult> sampleHeightResults;
+                TArray<FString> warnings;
+                toUnrealSampleHeightResults(
+                    std::move(result),
+                    sampleHeightResults,
+                    warnings);
+
+                ACesium3DTileset* pTileset = pQuery->pTileset.Get();
+                if (!IsValid(pTileset)) {
+                  pTileset = nullptr;
+                  failSampleHeightResults(
+                      MakeArrayView(pQuery->positions)
+                          .Slice(chunkStart, chunkCount),
+                      sampleHeightResults,
+                      warnings);
+                }
+
+                pQuery->onChunkSampled.ExecuteIfBound(
+                    pTileset,
+                    chunkStart,
+                    sampleHeightResults,
+                    warnings);
+              }
+
+              sampleNextHeightChunks(pQuery);
+            });
+  }
 
-  sampleHeights().thenImmediately(
-      [this, OnHeightsSampled = std::move(OnHeightsSampled)](
-          Cesium3DTilesSelection::SampleHeightResult&& result) {
-        if (!IsValid(this))
-          return;
+  pQuery->startingChunks = false;
 
-        check(result.positions.size() == result.sampleSuccess.size());
+  if (pQuery->completed || pQuery->chunksInFlight > 0 ||
+      pQuery->pHandle->IsCancelled()) {
+    return;
+  }
 
-        // This should do nothing, but will prevent undefined behavior if
-        // the array sizes are unexpectedly different.
-        result.sampleSuccess.resize(result.positions.size(), false);
+  // Nothing is in flight and nothing more can be started, either because
+  // every chunk has been sampled or because the tileset has been destroyed.
+  if (pQuery->nextChunkStart >= pQuery->positions.Num()) {
+    pQuery->completed = true;
+    pQuery->onComplete.ExecuteIfBound(true);
+  } else if (!IsValid(pQuery->pTileset.Get())) {
+    pQuery->completed = true;
+    pQuery->onComplete.ExecuteIfBound(false);
+  }
+}
 
-        TArray<FCesiumSampleHeightResult> sampleHeightResults;
-        sampleHeightResults.Reserve(result.positions.size());
+} // namespace
 
-        for (size_t i = 0; i < result.positions.size(); ++i) {
-          const CesiumGeospatial::Cartographic& position = result.positions[i];
+void ACesium3DTileset::_prepareForHeightQueries() {
+  // It's possible to sample heights before a Tick happens, so make sure
+  // that the necessary variables are resolved.
+  this->ResolveGeoreference();
+  this->ResolveCameraManager();
+  this->ResolveCreditSystem();
 
-          FCesiumSampleHeightResult unrealResult;
-          unrealResult.LongitudeLatitudeHeight = FVector(
-              CesiumUtility::Math::radiansToDegrees(position.longitude),
-              CesiumUtility::Math::radiansToDegrees(position.latitude),
-              position.height);
-          unrealResult.SampleSuccess = result.sampleSuccess[i];
+  if (this->_pTileset == nullptr) {
+    this->LoadTileset();
+  }
+}
 
-          sampleHeightResults.Emplace(std::move(unrealResult));
-        }
+void ACesium3DTileset::SampleHeightMostDetailed(
+    const TArray<FVector>& LongitudeLatitudeHeightArray,
+    FCesiumSampleHeightMostDetailedCallback OnHeightsSampled) {
+  this->_prepareForHeightQueries();
+
+  sampleHeights(
+      this->_pTileset.Get(),
+      toCartographics(LongitudeLatitudeHeightArray))
+      .thenImmediately(
+          [pWeakThis = TWeakObjectPtr<ACesium3DTileset>(this),
+           LongitudeLatitudeHeightArray,
+           OnHeightsSampled = std::move(OnHeightsSampled)](
+              Cesium3DTilesSelection::SampleHeightResult&& result) {
+            TArray<FCesiumSampleHeightResult> sampleHeightResults;
+            TArray<FString> warnings;
+            toUnrealSampleHeightResults(
+                std::move(result),
+                sampleHeightResults,
+                warnings);
+
+            // Still report the failure if the tileset was destroyed during
+            // the query, so that callers waiting on it are not left hanging.
+            ACesium3DTileset* pThis = pWeakThis.Get();
+            if (!IsValid(pThis)) {
+              pThis = nullptr;
+              failSampleHeightResults(
+                  LongitudeLatitudeHeightArray,
+                  sampleHeightResults,
+                  warnings);
+            }
+
+            OnHeightsSampled.ExecuteIfBound(
+                pThis,
+                sampleHeightResults,
+                warnings);
+          });
+}
 
-        TArray<FString> warnings;
-        warnings.Reserve(result.warnings.size());
+TSharedRef<FCesiumSampleHeightQuery>
+ACesium3DTileset::SampleHeightMostDetailedStreaming(
+    TArray<FVector> LongitudeLatitudeHeightArray,
+    FCesiumSampleHeightChunkCallback OnChunkSampled,
+    FCesiumSampleHeightQueryCompleteCallback OnComplete,
+    int32 ChunkSize,
+    int32 MaxConcurrentChunks) {
+  this->_prepareForHeightQueries();
 
-        for (const std::string& warning : result.warnings) {
-          warnings.Emplace(UTF8_TO_TCHAR(warning.c_str()));
-        }
+  TSharedRef<FCesiumSampleHeightQuery> pHandle =
+      MakeShared<FCesiumSampleHeightQuery>();
 
-        OnHeightsSampled.ExecuteIfBound(this, sampleHeightResults, warnings);
-      });
+  if (LongitudeLatitudeHeightArray.IsEmpty()) {
+    OnComplete.ExecuteIfBound(true);
+    return pHandle;
+  }
+
+  TSharedRef<StreamingHeightQuery> pQuery =
+      MakeShared<StreamingHeightQuery>(StreamingHeightQuery{
+          this,
+          MoveTemp(LongitudeLatitudeHeightArray),
+          FMath::Max(ChunkSize, 1),
+          FMath::Max(MaxConcurrentChunks, 1),
+          0,
+          0,
+          MoveTemp(OnChunkSampled),
+          MoveTemp(OnComplete),
+          pHandle});
+
+  sampleNextHeightChunks(pQuery);
+
+  return pHandle;
 }
 
 void ACesium3DTileset::SetGeoreference(
@@ -538,6 +740,24 @@ void ACesium3DTileset::SetAlwaysIncludeTangents(bool bAlwaysIncludeTangents) {
   }
 }
 
+void ACesium3DTileset::SetShareVerticesForGeneratedTangents(
+    bool bShareVerticesForGeneratedTangents) {
+  if (this->ShareVerticesForGeneratedTangents !=
+      bShareVerticesForGeneratedTangents) {
+    this->ShareVerticesForGeneratedTangents =
+        bShareVerticesForGeneratedTangents;
+    this->DestroyTileset();
+  }
+}
+
+void ACesium3DTileset::SetUseCompactTextureCoordinates(
+    bool bUseCompactTextureCoordinates) {
+  if (this->UseCompactTextureCoordinates != bUseCompactTextureCoordinates) {
+    this->UseCompactTextureCoordinates = bUseCompactTextureCoordinates;
+    this->DestroyTileset();
+  }
+}
+
 void ACesium3DTileset::SetGenerateSmoothNormals(bool bGenerateSmoothNormals) {
   if (this->GenerateSmoothNormals != bGenerateSmoothNormals) {
     this->GenerateSmoothNormals = bGenerateSmoothNormals;
@@ -1043,6 +1263,10 @@ void ACesium3DTileset::LoadTileset() {
     this->BoundingVolumePoolComponent->initPool(this->OcclusionPoolSize);
   }
 
+  if (!this->_pMaterialInstancePool) {
+    this->_pMaterialInstancePool = NewObject<UCesiumMaterialInstancePool>(this);
+  }
+
   CesiumGeospatial::Ellipsoid pNativeEllipsoid =
       this->ResolveGeoreference()->GetEllipsoid()->GetNativeEllipsoid();
 
@@ -1365,6 +1589,12 @@ void ACesium3DTileset::DestroyTileset() {
       [this]() { --this->_tilesetsBeingDestroyed; });
   this->_pTileset.Reset();
 
+  // Don't hold on to the material instances of unloaded tiles while the
+  // tileset is not loaded.
+  if (this->_pMaterialInstancePool) {
+    this->_pMaterialInstancePool->clear();
+  }
+
   switch (this->TilesetSource) {
   case ETilesetSource::FromEllipsoid:
     UE_LOG(LogCesium, Verbose, TEXT("Destroying tileset from ellipsoid done"));
@@ -1914,7 +2144,8 @@ void ACesium3DTileset::updateTilesetOptionsFromProperties() {
       this->_pTileset->getOptions();
   options.maximumScreenSpaceError =
       static_cast<double>(this->MaximumScreenSpaceError);
-  options.maximumCachedBytes = this->MaximumCachedBytes;
+  options.maximumCachedBytes =
+      CesiumTextureBudget::get().scaleCachedBytes(this->MaximumCachedBytes);
   options.preloadAncestors = this->PreloadAncestors;
   options.preloadSiblings = this->PreloadSiblings;
   options.forbidHoles = this->ForbidHoles;
@@ -2155,6 +2386,7 @@ void ACesium3DTileset::Tick(float DeltaTime) {
     }
   }
 
+  CesiumTextureBudget::get().updateForFrame();
   updateTilesetOptionsFromProperties();
 
   std::vector<FCesiumCamera> cameras = this->GetCameras();
@@ -2197,6 +2429,17 @@ void ACesium3DTileset::Tick(float DeltaTime) {
         ellipsoid));
   }
 
+  // Tile content loads started while selecting and loading tiles go in the
+  // visible lane of the worker pool when this tileset can be seen, and in the
+  // preload lane otherwise, for example while it is hidden or has no cameras.
+  // cesium-native itself starts the loads of visible tiles before those of
+  // preloaded ones. Continuations of a load stay in the lane it started in.
+  const bool isShown = !this->IsHidden() && pRoot->IsVisible() &&
+                       !frustums.empty();
+  UnrealTaskProcessor::ScopedPriority loadPriority(
+      isShown ? UnrealTaskProcessor::Priority::Visible
+              : UnrealTaskProcessor::Priority::Preload);
+
   const Cesium3DTilesSelection::ViewUpdateResult* pResult;
   if (this->_captureMovieMode) {
     TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::updateViewOffline)
@@ -2324,6 +2567,12 @@ void ACesium3DTileset::PostEditChangeProperty(
           GET_MEMBER_NAME_CHECKED(ACesium3DTileset, CreateNavCollision) ||
       PropName ==
           GET_MEMBER_NAME_CHECKED(ACesium3DTileset, AlwaysIncludeTangents) ||
+      PropName == GET_MEMBER_NAME_CHECKED(
+                      ACesium3DTileset,
+                      ShareVerticesForGeneratedTangents) ||
+      PropName == GET_MEMBER_NAME_CHECKED(
+                      ACesium3DTileset,
+                      UseCompactTextureCoordinates) ||
       PropName ==
           GET_MEMBER_NAME_CHECKED(ACesium3DTileset, GenerateSmoothNormals) ||
       PropName == GET_MEMBER_NAME_CHECKED(ACesium3DTileset, EnableWaterMask) ||
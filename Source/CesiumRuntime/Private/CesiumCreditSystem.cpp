@@ -164,7 +164,7 @@ ACesiumCreditSystem::GetDefaultCreditSystem(const UObject* WorldContextObject) {
 ACesiumCreditSystem::ACesiumCreditSystem()
     : AActor(),
       _pCreditSystem(std::make_shared<CesiumUtility::CreditSystem>()),
-      _lastCreditsCount(0) {
+      _creditLayouts() {
   PrimaryActorTick.bCanEverTick = true;
 #if WITH_EDITOR
   this->SetIsSpatiallyLoaded(false);
@@ -248,6 +248,10 @@ void ACesiumCreditSystem::updateCreditsViewport(bool recreateWidget) {
   if (!IsValid(CreditsWidget) || recreateWidget) {
     CreditsWidget =
         CreateWidget<UScreenCreditsWidget>(GetWorld(), CreditsWidgetClass);
+
+    // The new widget has no credits yet, so make sure the next Tick gives
+    // them to it.
+    this->_creditLayouts.clear();
   }
 
 #if WITH_EDITOR
@@ -326,49 +330,48 @@ void ACesiumCreditSystem::Tick(float DeltaTime) {
   const std::vector<CesiumUtility::Credit>& creditsToShowThisFrame =
       credits.currentCredits;
 
-  // if the credit list has changed, we want to reformat the credits
-  CreditsUpdated = creditsToShowThisFrame.size() != _lastCreditsCount ||
-                   credits.removedCredits.size() > 0;
+  // The set of credits rarely changes, so only rebuild the widget text when
+  // it does.
+  CreditsUpdated = this->_creditsChanged(creditsToShowThisFrame);
 
   if (CreditsUpdated) {
+    std::vector<CreditLayout> creditLayouts;
+    creditLayouts.reserve(creditsToShowThisFrame.size());
+
+    for (const CesiumUtility::Credit& credit : creditsToShowThisFrame) {
+      creditLayouts.push_back(CreditLayout{
+          credit,
+          _pCreditSystem->shouldBeShownOnScreen(credit),
+          this->_getCreditRtf(credit)});
+    }
+
+    this->_creditLayouts = std::move(creditLayouts);
+
     FString OnScreenCredits;
     FString Credits;
 
-    _lastCreditsCount = creditsToShowThisFrame.size();
-
     bool firstCreditOnScreen = true;
-    for (int i = 0; i < creditsToShowThisFrame.size(); i++) {
-      const CesiumUtility::Credit& credit = creditsToShowThisFrame[i];
-
-      FString creditRtf;
-      const std::string& html = _pCreditSystem->getHtml(credit);
+    for (size_t i = 0; i < this->_creditLayouts.size(); i++) {
+      const CreditLayout& layout = this->_creditLayouts[i];
 
-      auto htmlFind = _htmlToRtf.find(html);
-      if (htmlFind != _htmlToRtf.end()) {
-        creditRtf = htmlFind->second;
-      } else {
-        creditRtf = ConvertHtmlToRtf(html);
-        _htmlToRtf.insert({html, creditRtf});
-      }
-
-      if (creditRtf.IsEmpty()) {
+      if (layout.rtf.IsEmpty()) {
         continue;
       }
 
-      if (_pCreditSystem->shouldBeShownOnScreen(credit)) {
+      if (layout.showOnScreen) {
         if (firstCreditOnScreen) {
           firstCreditOnScreen = false;
         } else {
           OnScreenCredits += TEXT(" \u2022 ");
         }
 
-        OnScreenCredits += creditRtf;
+        OnScreenCredits += layout.rtf;
       } else {
         if (i != 0) {
           Credits += "\n";
         }
 
-        Credits += creditRtf;
+        Credits += layout.rtf;
       }
     }
 
@@ -380,6 +383,44 @@ void ACesiumCreditSystem::Tick(float DeltaTime) {
   }
 }
 
+bool ACesiumCreditSystem::_creditsChanged(
+    const std::vector<CesiumUtility::Credit>& creditsToShowThisFrame) const {
+  if (creditsToShowThisFrame.size() != this->_creditLayouts.size()) {
+    return true;
+  }
+
+  for (size_t i = 0; i < creditsToShowThisFrame.size(); ++i) {
+    const CreditLayout& layout = this->_creditLayouts[i];
+    if (!(creditsToShowThisFrame[i] == layout.credit) ||
+        _pCreditSystem->shouldBeShownOnScreen(creditsToShowThisFrame[i]) !=
+            layout.showOnScreen) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+const FString&
+ACesiumCreditSystem::_getCreditRtf(const CesiumUtility::Credit& credit) {
+  // Reuse the text of credits that were already shown, which avoids even
+  // looking up their HTML.
+  for (const CreditLayout& layout : this->_creditLayouts) {
+    if (layout.credit == credit) {
+      return layout.rtf;
+    }
+  }
+
+  const std::string& html = _pCreditSystem->getHtml(credit);
+
+  auto htmlFind = _htmlToRtf.find(html);
+  if (htmlFind != _htmlToRtf.end()) {
+    return htmlFind->second;
+  }
+
+  return _htmlToRtf.emplace(html, ConvertHtmlToRtf(html)).first->second;
+}
+
 namespace {
 void convertHtmlToRtf(
     std::string& output,
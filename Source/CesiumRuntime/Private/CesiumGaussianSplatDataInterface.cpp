@@ -5,6 +5,7 @@
 #include "CesiumGaussianSplatSubsystem.h"
 #include "CesiumGltfGaussianSplatComponent.h"
 #include "CesiumRuntime.h"
+#include "CesiumRuntimeSettings.h"
 
 #include "Containers/Map.h"
 #include "CoreMinimal.h"
@@ -21,9 +22,12 @@
 #include "RHICommandList.h"
 #include "ShaderCore.h"
 
+#include <algorithm>
+#include <bit>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/mat4x4.hpp>
+#include <optional>
 
 const FString ComputeSplatFunctionName = TEXT("ComputeSplat");
 
@@ -40,6 +44,10 @@ FNiagaraDataInterfaceProxyCesiumGaussianSplats::
 }
 
 namespace {
+/**
+ * Writes the transforms of the given tiles, indexed by tile slot. Slots that
+ * are not in use are null, and are written as invisible.
+ */
 void updateTileTransforms(
     FRHICommandListImmediate& RHICmdList,
     const TArray<const UCesiumGltfGaussianSplatComponent*>& Components,
@@ -85,10 +93,15 @@ void updateTileTransforms(
 
   for (int32 i = 0; i < Components.Num(); i++) {
     const UCesiumGltfGaussianSplatComponent* pComponent = Components[i];
-    check(pComponent);
-
     const int32 Offset = i * vectorsPerComponent;
 
+    if (!pComponent) {
+      for (int32 j = 0; j < vectorsPerComponent; j++) {
+        pBufferData[Offset + j] = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+      }
+      continue;
+    }
+
     glm::mat4 tileMatrix(pComponent->GetMatrix());
     const FTransform& componentToWorld = pComponent->GetComponentToWorld();
     FVector tileScale = componentToWorld.GetScale3D();
@@ -156,198 +169,361 @@ void updateTileTransforms(
   RHICmdList.UnlockBuffer(Buffer.Buffer);
 }
 
-void updatePerSplatData(
+/**
+ * The tile index written for splats that do not belong to any tile, because
+ * the tile that owned them has been unloaded.
+ */
+constexpr uint32 EmptySplatTileIndex = 0xFFFFFFFF;
+
+/**
+ * Buffers are grown to this multiple of the required size, so that tiles
+ * loaded afterward can usually be added without reallocating.
+ */
+constexpr double BufferGrowthFactor = 1.5;
+
+/**
+ * The minimum number of splats that the per-splat buffers are sized to hold.
+ */
+constexpr int32 MinimumSplatCapacity = 65536;
+
+/**
+ * The buffers are compacted when more than this fraction of the splat indices
+ * in use belong to unloaded tiles.
+ */
+constexpr double MaximumFragmentation = 0.25;
+
+int32 getGrownCapacity(int64 required, int32 minimum) {
+  if (required == 0) {
+    return 0;
+  }
+
+  const int64 grown =
+      FMath::Max(int64(double(required) * BufferGrowthFactor), int64(minimum));
+  return int32(FMath::Min(grown, int64(MAX_int32 / sizeof(FVector4f))));
+}
+
+void initializeBuffer(
     FRHICommandListImmediate& RHICmdList,
-    const TArray<const UCesiumGltfGaussianSplatComponent*>& Components,
-    int32 ShCoefficientCount,
+    FReadBuffer& Buffer,
+    const TCHAR* Name,
+    uint32 BytesPerElement,
+    int32 NumElements,
+    EPixelFormat Format) {
+  Buffer.Release();
+  if (NumElements > 0) {
+    Buffer.Initialize(
+        RHICmdList,
+        Name,
+        BytesPerElement,
+        NumElements,
+        Format,
+        BUF_Static);
+  }
+}
+
+void uploadRange(
+    FRHICommandListImmediate& RHICmdList,
+    FReadBuffer& Buffer,
+    uint32 ByteOffset,
+    const void* pData,
+    uint32 NumBytes) {
+  if (NumBytes == 0 || !Buffer.Buffer) {
+    return;
+  }
+
+  check(ByteOffset + NumBytes <= Buffer.NumBytes);
+  void* pBufferData = RHICmdList.LockBuffer(
+      Buffer.Buffer,
+      ByteOffset,
+      NumBytes,
+      EResourceLockMode::RLM_WriteOnly);
+  FPlatformMemory::Memcpy(pBufferData, pData, NumBytes);
+  RHICmdList.UnlockBuffer(Buffer.Buffer);
+}
+
+void fillTileIndices(
+    FRHICommandListImmediate& RHICmdList,
+    FReadBuffer& Buffer,
+    int32 SplatOffset,
     int32 SplatCount,
-    FNiagaraDataInterfaceProxyCesiumGaussianSplats& Proxy) {
-  if (Components.IsEmpty()) {
-    Proxy.PositionsBuffer.Release();
-    Proxy.ScalesBuffer.Release();
-    Proxy.OrientationsBuffer.Release();
-    Proxy.ColorsBuffer.Release();
-    Proxy.TileIndicesBuffer.Release();
-    Proxy.SHNonZeroCoeffsBuffer.Release();
-    Proxy.SplatSHDegreesBuffer.Release();
+    uint32 TileIndex) {
+  if (SplatCount == 0 || !Buffer.Buffer) {
     return;
   }
 
-  const int32 requiredPositionBytes = SplatCount * sizeof(FVector4f);
-  const int32 requiredDegreesBytes = Components.Num() * 3 * sizeof(uint32);
-  const int32 requiredShCoeffBytes = ShCoefficientCount * 2 * sizeof(float);
+  check((SplatOffset + SplatCount) * sizeof(uint32) <= Buffer.NumBytes);
+  uint32* pBufferData = static_cast<uint32*>(RHICmdList.LockBuffer(
+      Buffer.Buffer,
+      SplatOffset * sizeof(uint32),
+      SplatCount * sizeof(uint32),
+      EResourceLockMode::RLM_WriteOnly));
+  std::fill_n(pBufferData, SplatCount, TileIndex);
+  RHICmdList.UnlockBuffer(Buffer.Buffer);
+}
+
+/**
+ * The number of values per tile in the SH degrees buffer: the number of SH
+ * coefficients per splat, the offset of the tile's first coefficient, the
+ * offset of the tile's first splat, and the minimum and range used to
+ * dequantize the tile's coefficients (as float bits).
+ */
+constexpr int32 TileSHStride = 5;
+
+/**
+ * The element layout of one of the per-splat buffers. The shader reads every
+ * buffer as float4, so normalized and half-precision formats are decoded by
+ * the hardware.
+ */
+struct SplatBufferFormat {
+  uint32 bytesPerElement;
+  EPixelFormat pixelFormat;
+};
+
+constexpr SplatBufferFormat FullPrecisionFormat{
+    sizeof(FVector4f),
+    EPixelFormat::PF_A32B32G32R32F};
+constexpr SplatBufferFormat HalfPrecisionFormat{
+    4 * sizeof(FFloat16),
+    EPixelFormat::PF_FloatRGBA};
+constexpr SplatBufferFormat SignedNormalizedFormat{
+    4 * sizeof(int8),
+    EPixelFormat::PF_R8G8B8A8_SNORM};
+constexpr SplatBufferFormat UnsignedNormalizedFormat{
+    4 * sizeof(uint8),
+    EPixelFormat::PF_R8G8B8A8};
+
+struct SplatBufferFormats {
+  SplatBufferFormat scales;
+  SplatBufferFormat orientations;
+  SplatBufferFormat colors;
+  SplatBufferFormat sphericalHarmonics;
+};
+
+SplatBufferFormats getSplatBufferFormats(bool compact) {
+  if (compact) {
+    return SplatBufferFormats{
+        HalfPrecisionFormat,
+        SignedNormalizedFormat,
+        HalfPrecisionFormat,
+        UnsignedNormalizedFormat};
+  }
+
+  return SplatBufferFormats{
+      FullPrecisionFormat,
+      FullPrecisionFormat,
+      FullPrecisionFormat,
+      FullPrecisionFormat};
+}
+
+template <typename T> uint32 getNumBytes(const TArray<T>& Array) {
+  return static_cast<uint32>(Array.Num() * sizeof(T));
+}
+} // namespace
 
-  if (Proxy.PositionsBuffer.NumBytes != requiredPositionBytes) {
-    Proxy.PositionsBuffer.Release();
-    Proxy.ScalesBuffer.Release();
-    Proxy.OrientationsBuffer.Release();
-    Proxy.ColorsBuffer.Release();
-    Proxy.TileIndicesBuffer.Release();
+/**
+ * The changes to the per-splat GPU buffers computed on the game thread, to be
+ * applied on the render thread.
+ */
+struct FCesiumGaussianSplatBufferUpdate {
+  /**
+   * Whether the per-splat buffers must be recreated with new capacities. When
+   * this is true, every loaded tile is included in `Uploads`.
+   */
+  bool bReallocate = false;
+
+  /**
+   * Whether the buffers use the compact formats. Only tiles whose data is in
+   * the same form are uploaded.
+   */
+  bool bCompact = false;
+
+  int32 SplatCapacity = 0;
+  int32 CoefficientCapacity = 0;
+
+  /**
+   * The splat ranges of unloaded tiles, as (offset, count) pairs, which must
+   * be marked empty so that they are not rendered.
+   */
+  TArray<TPair<int32, int32>> ClearedRanges;
+
+  /**
+   * The tiles whose splats must be copied into the buffers.
+   */
+  TArray<TPair<
+      const UCesiumGltfGaussianSplatComponent*,
+      FCesiumGaussianSplatAllocation>>
+      Uploads;
+
+  /**
+   * The complete contents of the SH degrees buffer, `TileSHStride` values per
+   * tile slot. This is small enough to rewrite on every update.
+   */
+  TArray<uint32> SHDegrees;
+};
+
+namespace {
+void updatePerSplatData(
+    FRHICommandListImmediate& RHICmdList,
+    const FCesiumGaussianSplatBufferUpdate& Update,
+    FNiagaraDataInterfaceProxyCesiumGaussianSplats& Proxy) {
+  const SplatBufferFormats formats = getSplatBufferFormats(Update.bCompact);
 
-    Proxy.PositionsBuffer.Initialize(
+  if (Update.bReallocate) {
+    initializeBuffer(
         RHICmdList,
+        Proxy.PositionsBuffer,
         TEXT("FNiagaraDataInterfaceProxyCesiumGaussianSplat_Positions"),
         sizeof(FVector4f),
-        SplatCount,
-        EPixelFormat::PF_A32B32G32R32F,
-        BUF_Static);
-    Proxy.ScalesBuffer.Initialize(
+        Update.SplatCapacity,
+        EPixelFormat::PF_A32B32G32R32F);
+    initializeBuffer(
         RHICmdList,
+        Proxy.ScalesBuffer,
         TEXT("FNiagaraDataInterfaceProxyCesiumGaussianSplat_Scales"),
-        sizeof(FVector4f),
-        SplatCount,
-        EPixelFormat::PF_A32B32G32R32F,
-        BUF_Static);
-    Proxy.OrientationsBuffer.Initialize(
+        formats.scales.bytesPerElement,
+        Update.SplatCapacity,
+        formats.scales.pixelFormat);
+    initializeBuffer(
         RHICmdList,
+        Proxy.OrientationsBuffer,
         TEXT("FNiagaraDataInterfaceProxyCesiumGaussianSplat_Orientations"),
-        sizeof(FVector4f),
-        SplatCount,
-        EPixelFormat::PF_A32B32G32R32F,
-        BUF_Static);
-    Proxy.ColorsBuffer.Initialize(
+        formats.orientations.bytesPerElement,
+        Update.SplatCapacity,
+        formats.orientations.pixelFormat);
+    initializeBuffer(
         RHICmdList,
+        Proxy.ColorsBuffer,
         TEXT("FNiagaraDataInterfaceProxyCesiumGaussianSplat_Colors"),
-        sizeof(FVector4f),
-        SplatCount,
-        EPixelFormat::PF_A32B32G32R32F,
-        BUF_Static);
-
-    if (ShCoefficientCount > 0) {
-      Proxy.SHNonZeroCoeffsBuffer.Initialize(
-          RHICmdList,
-          TEXT(
-              "FNiagaraDataInterfaceProxyCesiumGaussianSplat_SHNonZeroCoeffsBuffer"),
-          sizeof(FVector4f),
-          ShCoefficientCount,
-          EPixelFormat::PF_A32B32G32R32F,
-          BUF_Static);
-    }
-    Proxy.TileIndicesBuffer.Initialize(
+        formats.colors.bytesPerElement,
+        Update.SplatCapacity,
+        formats.colors.pixelFormat);
+    initializeBuffer(
         RHICmdList,
+        Proxy.TileIndicesBuffer,
         TEXT(
             "FNiagaraDataInterfaceProxyCesiumGaussianSplat_SplatIndicesBuffer"),
         sizeof(uint32),
-        SplatCount,
-        EPixelFormat::PF_R32_UINT,
-        BUF_Static);
-  }
-
-  if (Proxy.SplatSHDegreesBuffer.NumBytes != requiredDegreesBytes) {
-    Proxy.SplatSHDegreesBuffer.Release();
-    Proxy.SplatSHDegreesBuffer.Initialize(
+        Update.SplatCapacity,
+        EPixelFormat::PF_R32_UINT);
+    initializeBuffer(
         RHICmdList,
-        TEXT("FNiagaraDataInterfaceProxyCesiumGaussianSplat_SplatSHDegrees"),
-        sizeof(uint32),
-        Components.Num() * 3,
-        EPixelFormat::PF_R32_UINT,
-        BUF_Static);
+        Proxy.SHNonZeroCoeffsBuffer,
+        TEXT(
+            "FNiagaraDataInterfaceProxyCesiumGaussianSplat_SHNonZeroCoeffsBuffer"),
+        formats.sphericalHarmonics.bytesPerElement,
+        Update.CoefficientCapacity,
+        formats.sphericalHarmonics.pixelFormat);
   }
 
-  if (Proxy.SHNonZeroCoeffsBuffer.NumBytes != requiredShCoeffBytes) {
-    Proxy.SHNonZeroCoeffsBuffer.Release();
-    if (ShCoefficientCount > 0) {
-      Proxy.SHNonZeroCoeffsBuffer.Initialize(
-          RHICmdList,
-          TEXT(
-              "FNiagaraDataInterfaceProxyCesiumGaussianSplat_SHNonZeroCoeffsBuffer"),
-          sizeof(FVector4f),
-          ShCoefficientCount,
-          EPixelFormat::PF_A32B32G32R32F,
-          BUF_Static);
-    }
+  // Clear before uploading, because a new tile may reuse a cleared range.
+  for (const TPair<int32, int32>& range : Update.ClearedRanges) {
+    fillTileIndices(
+        RHICmdList,
+        Proxy.TileIndicesBuffer,
+        range.Key,
+        range.Value,
+        EmptySplatTileIndex);
   }
 
-  float* pPositionsBuffer = static_cast<float*>(RHICmdList.LockBuffer(
-      Proxy.PositionsBuffer.Buffer,
-      0,
-      requiredPositionBytes,
-      EResourceLockMode::RLM_WriteOnly));
-  float* pScalesBuffer = static_cast<float*>(RHICmdList.LockBuffer(
-      Proxy.ScalesBuffer.Buffer,
-      0,
-      requiredPositionBytes,
-      EResourceLockMode::RLM_WriteOnly));
-  float* pOrientationsBuffer = static_cast<float*>(RHICmdList.LockBuffer(
-      Proxy.OrientationsBuffer.Buffer,
-      0,
-      requiredPositionBytes,
-      EResourceLockMode::RLM_WriteOnly));
-  float* pColorsBuffer = static_cast<float*>(RHICmdList.LockBuffer(
-      Proxy.ColorsBuffer.Buffer,
-      0,
-      requiredPositionBytes,
-      EResourceLockMode::RLM_WriteOnly));
-  float* pSHNonZeroCoeffsBuffer =
-      ShCoefficientCount > 0 ? static_cast<float*>(RHICmdList.LockBuffer(
-                                   Proxy.SHNonZeroCoeffsBuffer.Buffer,
-                                   0,
-                                   ShCoefficientCount * 4 * sizeof(float),
-                                   EResourceLockMode::RLM_WriteOnly))
-                             : nullptr;
-  uint32* pIndexBuffer = static_cast<uint32*>(RHICmdList.LockBuffer(
-      Proxy.TileIndicesBuffer.Buffer,
-      0,
-      SplatCount * sizeof(uint32),
-      EResourceLockMode::RLM_WriteOnly));
-  uint32* pSHDegreesBuffer = static_cast<uint32*>(RHICmdList.LockBuffer(
-      Proxy.SplatSHDegreesBuffer.Buffer,
-      0,
-      Components.Num() * sizeof(uint32) * 3,
-      EResourceLockMode::RLM_WriteOnly));
-
-  int32 coeffCountWritten = 0;
-  int32 splatCountWritten = 0;
-  for (int32 i = 0; i < Components.Num(); i++) {
-    const UCesiumGltfGaussianSplatComponent* pComponent = Components[i];
+  for (const auto& [pComponent, allocation] : Update.Uploads) {
     check(pComponent);
+    const FCesiumGltfGaussianSplatData& data = pComponent->Data;
+    check(data.bIsCompact == Update.bCompact);
 
-    FPlatformMemory::Memcpy(
-        reinterpret_cast<void*>(pPositionsBuffer + splatCountWritten * 4),
-        pComponent->Data.Positions.GetData(),
-        pComponent->Data.Positions.Num() * sizeof(float));
-    FPlatformMemory::Memcpy(
-        reinterpret_cast<void*>(pScalesBuffer + splatCountWritten * 4),
-        pComponent->Data.Scales.GetData(),
-        pComponent->Data.Scales.Num() * sizeof(float));
-    FPlatformMemory::Memcpy(
-        reinterpret_cast<void*>(pOrientationsBuffer + splatCountWritten * 4),
-        pComponent->Data.Orientations.GetData(),
-        pComponent->Data.Orientations.Num() * sizeof(float));
-    FPlatformMemory::Memcpy(
-        reinterpret_cast<void*>(pColorsBuffer + splatCountWritten * 4),
-        pComponent->Data.Colors.GetData(),
-        pComponent->Data.Colors.Num() * sizeof(float));
-    if (ShCoefficientCount > 0) {
-      FPlatformMemory::Memcpy(
-          reinterpret_cast<void*>(
-              pSHNonZeroCoeffsBuffer + coeffCountWritten * 4),
-          pComponent->Data.SphericalHarmonics.GetData(),
-          pComponent->Data.SphericalHarmonics.Num() * sizeof(float));
-    }
-    for (int32 j = 0; j < pComponent->Data.NumSplats; j++) {
-      pIndexBuffer[splatCountWritten + j] = static_cast<uint32>(i);
+    uploadRange(
+        RHICmdList,
+        Proxy.PositionsBuffer,
+        allocation.SplatOffset * sizeof(FVector4f),
+        data.Positions.GetData(),
+        getNumBytes(data.Positions));
+
+    const uint32 scalesOffset =
+        allocation.SplatOffset * formats.scales.bytesPerElement;
+    const uint32 orientationsOffset =
+        allocation.SplatOffset * formats.orientations.bytesPerElement;
+    const uint32 colorsOffset =
+        allocation.SplatOffset * formats.colors.bytesPerElement;
+    const uint32 sphericalHarmonicsOffset =
+        allocation.CoefficientOffset *
+        formats.sphericalHarmonics.bytesPerElement;
+
+    if (data.bIsCompact) {
+      uploadRange(
+          RHICmdList,
+          Proxy.ScalesBuffer,
+          scalesOffset,
+          data.CompactScales.GetData(),
+          getNumBytes(data.CompactScales));
+      uploadRange(
+          RHICmdList,
+          Proxy.OrientationsBuffer,
+          orientationsOffset,
+          data.CompactOrientations.GetData(),
+          getNumBytes(data.CompactOrientations));
+      uploadRange(
+          RHICmdList,
+          Proxy.ColorsBuffer,
+          colorsOffset,
+          data.CompactColors.GetData(),
+          getNumBytes(data.CompactColors));
+      uploadRange(
+          RHICmdList,
+          Proxy.SHNonZeroCoeffsBuffer,
+          sphericalHarmonicsOffset,
+          data.CompactSphericalHarmonics.GetData(),
+          getNumBytes(data.CompactSphericalHarmonics));
+    } else {
+      uploadRange(
+          RHICmdList,
+          Proxy.ScalesBuffer,
+          scalesOffset,
+          data.Scales.GetData(),
+          getNumBytes(data.Scales));
+      uploadRange(
+          RHICmdList,
+          Proxy.OrientationsBuffer,
+          orientationsOffset,
+          data.Orientations.GetData(),
+          getNumBytes(data.Orientations));
+      uploadRange(
+          RHICmdList,
+          Proxy.ColorsBuffer,
+          colorsOffset,
+          data.Colors.GetData(),
+          getNumBytes(data.Colors));
+      uploadRange(
+          RHICmdList,
+          Proxy.SHNonZeroCoeffsBuffer,
+          sphericalHarmonicsOffset,
+          data.SphericalHarmonics.GetData(),
+          getNumBytes(data.SphericalHarmonics));
     }
 
-    pSHDegreesBuffer[i * 3] =
-        static_cast<uint32>(pComponent->Data.NumCoefficients);
-    pSHDegreesBuffer[i * 3 + 1] = static_cast<uint32>(coeffCountWritten);
-    pSHDegreesBuffer[i * 3 + 2] = static_cast<uint32>(splatCountWritten);
-
-    splatCountWritten += pComponent->Data.NumSplats;
-    coeffCountWritten +=
-        pComponent->Data.NumSplats * pComponent->Data.NumCoefficients;
+    fillTileIndices(
+        RHICmdList,
+        Proxy.TileIndicesBuffer,
+        allocation.SplatOffset,
+        allocation.SplatCount,
+        static_cast<uint32>(allocation.TileSlot));
   }
 
-  RHICmdList.UnlockBuffer(Proxy.PositionsBuffer.Buffer);
-  RHICmdList.UnlockBuffer(Proxy.ScalesBuffer.Buffer);
-  RHICmdList.UnlockBuffer(Proxy.OrientationsBuffer.Buffer);
-  RHICmdList.UnlockBuffer(Proxy.ColorsBuffer.Buffer);
-  if (ShCoefficientCount > 0) {
-    RHICmdList.UnlockBuffer(Proxy.SHNonZeroCoeffsBuffer.Buffer);
+  const uint32 requiredDegreesBytes = Update.SHDegrees.Num() * sizeof(uint32);
+  if (Proxy.SplatSHDegreesBuffer.NumBytes != requiredDegreesBytes) {
+    initializeBuffer(
+        RHICmdList,
+        Proxy.SplatSHDegreesBuffer,
+        TEXT("FNiagaraDataInterfaceProxyCesiumGaussianSplat_SplatSHDegrees"),
+        sizeof(uint32),
+        Update.SHDegrees.Num(),
+        EPixelFormat::PF_R32_UINT);
   }
-  RHICmdList.UnlockBuffer(Proxy.TileIndicesBuffer.Buffer);
-  RHICmdList.UnlockBuffer(Proxy.SplatSHDegreesBuffer.Buffer);
+
+  uploadRange(
+      RHICmdList,
+      Proxy.SplatSHDegreesBuffer,
+      0,
+      Update.SHDegrees.GetData(),
+      requiredDegreesBytes);
 }
 } // namespace
 
@@ -605,11 +781,9 @@ bool UCesiumGaussianSplatDataInterface::PerInstanceTick(
   }
 
   TArray<const UCesiumGltfGaussianSplatComponent*> components;
-  int32 shCoefficientCount = 0;
-  int32 splatCount = 0;
 
-  // In PIE mode, components can belong to different worlds. This pre-counts
-  // components to measure how much should actually be allocated.
+  // In PIE mode, components can belong to different worlds. Only those in this
+  // world are rendered.
   for (const UCesiumGltfGaussianSplatComponent* pSplatComponent :
        pSplatSystem->SplatComponents) {
     check(pSplatComponent);
@@ -618,9 +792,6 @@ bool UCesiumGaussianSplatDataInterface::PerInstanceTick(
     }
 
     components.Add(pSplatComponent);
-    shCoefficientCount +=
-        pSplatComponent->Data.NumCoefficients * pSplatComponent->Data.NumSplats;
-    splatCount += pSplatComponent->Data.NumSplats;
   }
 
   FNiagaraDataInterfaceProxyCesiumGaussianSplats* RT_Proxy =
@@ -629,16 +800,14 @@ bool UCesiumGaussianSplatDataInterface::PerInstanceTick(
   if (this->_splatsDirty && !isUpdatingSplats) {
     this->_splatsDirty = false;
 
+    FCesiumGaussianSplatBufferUpdate update;
+    this->updateAllocations(components, update);
+
     pData->SplatsFence.reset();
     ENQUEUE_RENDER_COMMAND(FUpdateGaussianSplatBuffers)
-    ([RT_Proxy, components, shCoefficientCount, splatCount](
-         FRHICommandListImmediate& RHICmdList) {
-      updatePerSplatData(
-          RHICmdList,
-          components,
-          shCoefficientCount,
-          splatCount,
-          *RT_Proxy);
+    ([RT_Proxy,
+      update = MoveTemp(update)](FRHICommandListImmediate& RHICmdList) {
+      updatePerSplatData(RHICmdList, update, *RT_Proxy);
     });
     pData->SplatsFence.emplace().BeginFence();
   }
@@ -646,14 +815,16 @@ bool UCesiumGaussianSplatDataInterface::PerInstanceTick(
   if (this->_tilesDirty && !isUpdatingMatrices) {
     this->_tilesDirty = false;
 
+    TArray<const UCesiumGltfGaussianSplatComponent*> tiles;
+    tiles.SetNumZeroed(this->_tileSlots.getEnd());
+    for (const auto& [pComponent, allocation] : this->_allocations) {
+      tiles[allocation.TileSlot] = pComponent.Get();
+    }
+
     pData->MatricesFence.reset();
     ENQUEUE_RENDER_COMMAND(FUpdateCesiumGaussianSplatMatrices)
-    ([RT_Proxy,
-      components = MoveTemp(components)](FRHICommandListImmediate& RHICmdList) {
-      updateTileTransforms(
-          RHICmdList,
-          components,
-          RT_Proxy->TileTransformsBuffer);
+    ([RT_Proxy, tiles = MoveTemp(tiles)](FRHICommandListImmediate& RHICmdList) {
+      updateTileTransforms(RHICmdList, tiles, RT_Proxy->TileTransformsBuffer);
     });
     pData->MatricesFence.emplace().BeginFence();
   }
@@ -661,6 +832,159 @@ bool UCesiumGaussianSplatDataInterface::PerInstanceTick(
   return false;
 }
 
+void UCesiumGaussianSplatDataInterface::updateAllocations(
+    const TArray<const UCesiumGltfGaussianSplatComponent*>& Components,
+    FCesiumGaussianSplatBufferUpdate& Update) {
+  // Tiles loaded before the compact setting was changed can't share buffers
+  // with those loaded after, so they are not rendered until they are reloaded.
+  const bool useCompactFormat =
+      GetDefault<UCesiumRuntimeSettings>()->UseCompactGaussianSplats;
+  TArray<const UCesiumGltfGaussianSplatComponent*> renderable;
+  renderable.Reserve(Components.Num());
+  for (const UCesiumGltfGaussianSplatComponent* pComponent : Components) {
+    if (pComponent->Data.bIsCompact == useCompactFormat) {
+      renderable.Add(pComponent);
+    }
+  }
+
+  if (renderable.Num() != Components.Num()) {
+    UE_LOG(
+        LogCesium,
+        Warning,
+        TEXT(
+            "%d Gaussian splat tiles were loaded with a different Use Compact Gaussian Splats setting and will not be rendered until their tilesets are refreshed."),
+        Components.Num() - renderable.Num());
+  }
+
+  Update.bCompact = useCompactFormat;
+
+  TSet<const UCesiumGltfGaussianSplatComponent*> current(renderable);
+
+  // Free the ranges of tiles that are no longer loaded. A stale weak pointer
+  // means the component was destroyed; if a new component has since been
+  // allocated at the same address, it will not match.
+  for (auto it = this->_allocations.CreateIterator(); it; ++it) {
+    const UCesiumGltfGaussianSplatComponent* pComponent = it->Key.Get();
+    if (pComponent && current.Contains(pComponent)) {
+      continue;
+    }
+
+    const FCesiumGaussianSplatAllocation& allocation = it->Value;
+    this->_splatRanges.free(allocation.SplatOffset, allocation.SplatCount);
+    this->_coefficientRanges.free(
+        allocation.CoefficientOffset,
+        allocation.CoefficientCount);
+    this->_tileSlots.free(allocation.TileSlot, 1);
+    Update.ClearedRanges.Emplace(allocation.SplatOffset, allocation.SplatCount);
+    it.RemoveCurrent();
+  }
+
+  bool needsReallocation = useCompactFormat != this->_compactFormat;
+  for (const UCesiumGltfGaussianSplatComponent* pComponent : renderable) {
+    if (needsReallocation) {
+      break;
+    }
+
+    if (this->_allocations.Contains(pComponent)) {
+      continue;
+    }
+
+    const FCesiumGltfGaussianSplatData& data = pComponent->Data;
+    FCesiumGaussianSplatAllocation allocation;
+    allocation.SplatCount = data.NumSplats;
+    allocation.CoefficientCount = data.NumSplats * data.NumCoefficients;
+
+    std::optional<int32> splatOffset =
+        this->_splatRanges.allocate(allocation.SplatCount);
+    if (!splatOffset) {
+      needsReallocation = true;
+      break;
+    }
+
+    std::optional<int32> coefficientOffset =
+        this->_coefficientRanges.allocate(allocation.CoefficientCount);
+    if (!coefficientOffset) {
+      this->_splatRanges.free(*splatOffset, allocation.SplatCount);
+      needsReallocation = true;
+      break;
+    }
+
+    allocation.SplatOffset = *splatOffset;
+    allocation.CoefficientOffset = *coefficientOffset;
+    allocation.TileSlot = *this->_tileSlots.allocate(1);
+
+    this->_allocations.Emplace(pComponent, allocation);
+    Update.Uploads.Emplace(pComponent, allocation);
+  }
+
+  // Compact the buffers once too many of the splats that the Niagara system
+  // iterates over belong to unloaded tiles.
+  const int32 splatEnd = this->_splatRanges.getEnd();
+  const bool tooFragmented =
+      this->_splatRanges.getFreeCountBeforeEnd() >
+      int32(double(splatEnd) * MaximumFragmentation);
+
+  if (needsReallocation || tooFragmented || renderable.IsEmpty()) {
+    this->_compactFormat = useCompactFormat;
+    this->reallocate(renderable, Update);
+  }
+
+  Update.SHDegrees.SetNumZeroed(this->_tileSlots.getEnd() * TileSHStride);
+  for (const auto& [pComponent, allocation] : this->_allocations) {
+    const FCesiumGltfGaussianSplatData& data = pComponent.Get()->Data;
+    uint32* pTile = &Update.SHDegrees[allocation.TileSlot * TileSHStride];
+    pTile[0] = static_cast<uint32>(data.NumCoefficients);
+    pTile[1] = static_cast<uint32>(allocation.CoefficientOffset);
+    pTile[2] = static_cast<uint32>(allocation.SplatOffset);
+    // Full-precision coefficients pass through the dequantization unchanged.
+    pTile[3] = std::bit_cast<uint32>(
+        data.bIsCompact ? data.SphericalHarmonicsMinimum : 0.0f);
+    pTile[4] = std::bit_cast<uint32>(
+        data.bIsCompact ? data.SphericalHarmonicsRange : 1.0f);
+  }
+}
+
+void UCesiumGaussianSplatDataInterface::reallocate(
+    const TArray<const UCesiumGltfGaussianSplatComponent*>& Components,
+    FCesiumGaussianSplatBufferUpdate& Update) {
+  int64 splatCount = 0;
+  int64 coefficientCount = 0;
+  for (const UCesiumGltfGaussianSplatComponent* pComponent : Components) {
+    splatCount += pComponent->Data.NumSplats;
+    coefficientCount +=
+        int64(pComponent->Data.NumSplats) * pComponent->Data.NumCoefficients;
+  }
+
+  this->_allocations.Reset();
+  this->_splatRanges.reset(
+      getGrownCapacity(splatCount, MinimumSplatCapacity));
+  this->_coefficientRanges.reset(getGrownCapacity(coefficientCount, 0));
+  this->_tileSlots.reset(MAX_int32);
+
+  Update.bReallocate = true;
+  Update.SplatCapacity = this->_splatRanges.getCapacity();
+  Update.CoefficientCapacity = this->_coefficientRanges.getCapacity();
+  // Every range in the new buffers is either uploaded or beyond the end.
+  Update.ClearedRanges.Reset();
+  Update.Uploads.Reset();
+
+  for (const UCesiumGltfGaussianSplatComponent* pComponent : Components) {
+    FCesiumGaussianSplatAllocation allocation;
+    allocation.SplatCount = pComponent->Data.NumSplats;
+    allocation.CoefficientCount =
+        pComponent->Data.NumSplats * pComponent->Data.NumCoefficients;
+    allocation.SplatOffset =
+        this->_splatRanges.allocate(allocation.SplatCount).value_or(0);
+    allocation.CoefficientOffset =
+        this->_coefficientRanges.allocate(allocation.CoefficientCount)
+            .value_or(0);
+    allocation.TileSlot = *this->_tileSlots.allocate(1);
+
+    this->_allocations.Emplace(pComponent, allocation);
+    Update.Uploads.Emplace(pComponent, allocation);
+  }
+}
+
 int32 UCesiumGaussianSplatDataInterface::PerInstanceDataSize() const {
   return sizeof(FNDICesiumGaussianSplats_InstanceData);
 }
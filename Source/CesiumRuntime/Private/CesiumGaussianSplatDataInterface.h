@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "CesiumRangeAllocator.h"
 #include "CoreMinimal.h"
 #include "NiagaraDataInterface.h"
 #include "NiagaraDataInterfaceBase.h"
@@ -12,6 +13,8 @@
 #include "CesiumGaussianSplatDataInterface.generated.h"
 
 class UCesiumGaussianSplatSubsystem;
+class UCesiumGltfGaussianSplatComponent;
+struct FCesiumGaussianSplatBufferUpdate;
 
 struct FNiagaraDataInterfaceProxyCesiumGaussianSplats
     : public FNiagaraDataInterfaceProxy {
@@ -31,6 +34,25 @@ struct FNiagaraDataInterfaceProxyCesiumGaussianSplats
   FReadBuffer SHNonZeroCoeffsBuffer;
 };
 
+/**
+ * The location of a single tile's splats within the data interface's GPU
+ * buffers.
+ */
+struct FCesiumGaussianSplatAllocation {
+  /**
+   * The index of the tile in the tile transforms and SH degrees buffers.
+   */
+  int32 TileSlot = 0;
+  int32 SplatOffset = 0;
+  int32 SplatCount = 0;
+  /**
+   * The offset and count of the tile's spherical harmonic coefficients, in
+   * units of float4.
+   */
+  int32 CoefficientOffset = 0;
+  int32 CoefficientCount = 0;
+};
+
 struct FNDICesiumGaussianSplats_InstanceData {
   std::optional<FRenderCommandFence> SplatsFence;
   std::optional<FRenderCommandFence> MatricesFence;
@@ -87,6 +109,13 @@ public:
 
   bool IsDirty() const { return this->_tilesDirty || this->_splatsDirty; }
 
+  /**
+   * Gets the number of splat indices that the Niagara system must iterate
+   * over. Because the splats of unloaded tiles leave gaps in the buffers until
+   * they are compacted, this may be larger than the number of loaded splats.
+   */
+  int32 GetSplatIndexCount() const { return this->_splatRanges.getEnd(); }
+
   /**
    * Whether any render command updates are currently in progress for the given
    * world.
@@ -119,8 +148,38 @@ protected:
   virtual void PostInitProperties() override;
 
 private:
+  /**
+   * Updates the allocations to match the given set of components, recording
+   * the GPU buffer changes needed to do so. Tiles that are still loaded keep
+   * their existing allocations, unless the buffers must be grown or compacted.
+   */
+  void updateAllocations(
+      const TArray<const UCesiumGltfGaussianSplatComponent*>& Components,
+      FCesiumGaussianSplatBufferUpdate& Update);
+
+  /**
+   * Discards all allocations and packs the given components tightly into
+   * newly-sized buffers.
+   */
+  void reallocate(
+      const TArray<const UCesiumGltfGaussianSplatComponent*>& Components,
+      FCesiumGaussianSplatBufferUpdate& Update);
+
   bool _splatsDirty = true;
   bool _tilesDirty = true;
 
+  /**
+   * Whether the per-splat buffers currently use the compact formats.
+   */
+  bool _compactFormat = false;
+
+  TMap<
+      TWeakObjectPtr<const UCesiumGltfGaussianSplatComponent>,
+      FCesiumGaussianSplatAllocation>
+      _allocations;
+  CesiumRangeAllocator _splatRanges;
+  CesiumRangeAllocator _coefficientRanges;
+  CesiumRangeAllocator _tileSlots;
+
   TMap<UWorld*, FNDICesiumGaussianSplats_InstanceData*> _worldToProxyData;
 };
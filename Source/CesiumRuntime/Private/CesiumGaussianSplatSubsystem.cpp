@@ -133,7 +133,6 @@ void UCesiumGaussianSplatSubsystem::RegisterSplat(
     UCesiumGltfGaussianSplatComponent* Component) {
   check(Component);
   this->SplatComponents.Add(Component);
-  this->_splatCount += Component->Data.NumSplats;
   this->makeInterfaceDirty();
 }
 
@@ -141,7 +140,6 @@ void UCesiumGaussianSplatSubsystem::UnregisterSplat(
     UCesiumGltfGaussianSplatComponent* Component) {
   check(Component);
   this->SplatComponents.Remove(Component);
-  this->_splatCount -= Component->Data.NumSplats;
   this->makeInterfaceDirty();
 }
 
@@ -278,10 +276,14 @@ void UCesiumGaussianSplatSubsystem::Tick(float DeltaTime) {
     // update.
     this->_pNiagaraComponent->SetPaused(true);
   } else {
-    this->_splatInterfaceDirty = false;
-    this->_pNiagaraComponent->SetVariableInt(
-        FName(TEXT("SplatCount")),
-        this->_splatCount);
+    // The interface is still dirty if it has not yet ticked to start its
+    // update, in which case the system must keep running so that it does.
+    if (!pDataInterface->IsDirty()) {
+      this->_splatInterfaceDirty = false;
+      this->_pNiagaraComponent->SetVariableInt(
+          FName(TEXT("SplatCount")),
+          pDataInterface->GetSplatIndexCount());
+    }
     this->_pNiagaraComponent->SetPaused(false);
   }
 }
@@ -312,7 +314,6 @@ void UCesiumGaussianSplatSubsystem::reset() {
   this->_pLastCreatedWorld = nullptr;
 
   this->SplatComponents.Empty();
-  this->_splatCount = 0;
   this->makeInterfaceDirty();
 }
 
@@ -81,7 +81,6 @@ private:
   UWorld* _pLastCreatedWorld = nullptr;
   bool _isTickEnabled = false;
 
-  int32 _splatCount = 0;
   bool _splatInterfaceDirty = true;
 
   static constexpr TCHAR NiagaraSystemAssetPath[] = TEXT(
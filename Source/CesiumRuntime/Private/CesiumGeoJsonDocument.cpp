@@ -1,17 +1,24 @@
 #include "CesiumGeoJsonDocument.h"
+#include "CesiumGeoJsonSpatialIndex.h"
 #include "CesiumIonServer.h"
 #include "CesiumRuntime.h"
 
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumUtility/Result.h>
 
+#include <optional>
 #include <span>
 
-FCesiumGeoJsonDocument::FCesiumGeoJsonDocument() : _pDocument(nullptr) {}
+FCesiumGeoJsonDocument::FCesiumGeoJsonDocument()
+    : _pDocument(nullptr),
+      _pSpatialIndex(nullptr),
+      _pGeometryColumns(nullptr) {}
 
 FCesiumGeoJsonDocument::FCesiumGeoJsonDocument(
     std::shared_ptr<CesiumVectorData::GeoJsonDocument>&& document)
-    : _pDocument(std::move(document)) {}
+    : _pDocument(std::move(document)),
+      _pSpatialIndex(nullptr),
+      _pGeometryColumns(nullptr) {}
 
 bool FCesiumGeoJsonDocument::IsValid() const {
   return this->_pDocument != nullptr;
@@ -22,6 +29,58 @@ FCesiumGeoJsonDocument::GetDocument() const {
   return this->_pDocument;
 }
 
+void FCesiumGeoJsonDocument::BuildSpatialIndex() {
+  if (!this->_pDocument) {
+    this->_pSpatialIndex = nullptr;
+    return;
+  }
+
+  this->_pSpatialIndex = std::make_shared<const CesiumGeoJsonSpatialIndex>(
+      this->_pDocument->rootObject);
+}
+
+bool FCesiumGeoJsonDocument::HasSpatialIndex() const {
+  return this->_pSpatialIndex != nullptr;
+}
+
+const std::shared_ptr<const CesiumGeoJsonSpatialIndex>&
+FCesiumGeoJsonDocument::GetSpatialIndex() const {
+  return this->_pSpatialIndex;
+}
+
+void FCesiumGeoJsonDocument::BuildGeometryColumns(
+    const TFunction<void(float)>& onProgress) {
+  if (!this->_pDocument) {
+    this->_pGeometryColumns = nullptr;
+    return;
+  }
+
+  this->_pGeometryColumns =
+      std::make_shared<const FCesiumGeoJsonGeometryColumns>(
+          this->_pDocument->rootObject,
+          onProgress);
+}
+
+void FCesiumGeoJsonDocument::MoveGeometryToColumns(
+    const TFunction<void(float)>& onProgress) {
+  if (!this->_pDocument) {
+    this->_pGeometryColumns = nullptr;
+    return;
+  }
+
+  this->_pSpatialIndex = nullptr;
+  this->_pGeometryColumns =
+      std::make_shared<const FCesiumGeoJsonGeometryColumns>(
+          FCesiumGeoJsonGeometryColumns::MoveFromDocument(
+              this->_pDocument->rootObject,
+              onProgress));
+}
+
+const std::shared_ptr<const FCesiumGeoJsonGeometryColumns>&
+FCesiumGeoJsonDocument::GetGeometryColumns() const {
+  return this->_pGeometryColumns;
+}
+
 bool UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
     const FString& InString,
     FCesiumGeoJsonDocument& OutGeoJsonDocument) {
@@ -65,16 +124,346 @@ FCesiumGeoJsonObject UCesiumGeoJsonDocumentBlueprintLibrary::GetRootObject(
       &InGeoJsonDocument._pDocument->rootObject);
 }
 
+void UCesiumGeoJsonDocumentBlueprintLibrary::BuildSpatialIndex(
+    UPARAM(Ref) FCesiumGeoJsonDocument& InGeoJsonDocument) {
+  InGeoJsonDocument.BuildSpatialIndex();
+}
+
+bool UCesiumGeoJsonDocumentBlueprintLibrary::HasSpatialIndex(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument) {
+  return InGeoJsonDocument.HasSpatialIndex();
+}
+
+namespace {
+TArray<FCesiumGeoJsonFeature> toFeatureArray(
+    const std::shared_ptr<CesiumVectorData::GeoJsonDocument>& pDocument,
+    const std::vector<const CesiumVectorData::GeoJsonFeature*>& features) {
+  TArray<FCesiumGeoJsonFeature> result;
+  result.Reserve(features.size());
+  for (const CesiumVectorData::GeoJsonFeature* pFeature : features) {
+    result.Emplace(pDocument, pFeature);
+  }
+  return result;
+}
+} // namespace
+
+TArray<FCesiumGeoJsonFeature>
+UCesiumGeoJsonDocumentBlueprintLibrary::FindFeaturesAtPosition(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument,
+    const FVector& LongitudeLatitude) {
+  if (!InGeoJsonDocument._pDocument) {
+    return {};
+  }
+
+  const glm::dvec2 point(LongitudeLatitude.X, LongitudeLatitude.Y);
+  const std::shared_ptr<const CesiumGeoJsonSpatialIndex>& pIndex =
+      InGeoJsonDocument._pSpatialIndex;
+  return toFeatureArray(
+      InGeoJsonDocument._pDocument,
+      pIndex ? pIndex->findContaining(point)
+             : CesiumGeoJsonSpatialIndex::scanContaining(
+                   InGeoJsonDocument._pDocument->rootObject,
+                   point));
+}
+
+TArray<FCesiumGeoJsonFeature>
+UCesiumGeoJsonDocumentBlueprintLibrary::FindFeaturesInBox(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument,
+    const FBox& LongitudeLatitudeBox) {
+  if (!InGeoJsonDocument._pDocument) {
+    return {};
+  }
+
+  const CesiumGeoJsonSpatialIndex::Rectangle rectangle{
+      LongitudeLatitudeBox.Min.X,
+      LongitudeLatitudeBox.Min.Y,
+      LongitudeLatitudeBox.Max.X,
+      LongitudeLatitudeBox.Max.Y};
+  const std::shared_ptr<const CesiumGeoJsonSpatialIndex>& pIndex =
+      InGeoJsonDocument._pSpatialIndex;
+  return toFeatureArray(
+      InGeoJsonDocument._pDocument,
+      pIndex ? pIndex->findIntersecting(rectangle)
+             : CesiumGeoJsonSpatialIndex::scanIntersecting(
+                   InGeoJsonDocument._pDocument->rootObject,
+                   rectangle));
+}
+
+FCesiumGeoJsonFeature
+UCesiumGeoJsonDocumentBlueprintLibrary::FindNearestFeature(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument,
+    const FVector& LongitudeLatitude,
+    EHasValue& Branches) {
+  Branches = EHasValue::NoValue;
+  if (!InGeoJsonDocument._pDocument) {
+    return FCesiumGeoJsonFeature();
+  }
+
+  const glm::dvec2 point(LongitudeLatitude.X, LongitudeLatitude.Y);
+  const std::shared_ptr<const CesiumGeoJsonSpatialIndex>& pIndex =
+      InGeoJsonDocument._pSpatialIndex;
+  const CesiumVectorData::GeoJsonFeature* pFeature =
+      pIndex ? pIndex->findNearest(point)
+             : CesiumGeoJsonSpatialIndex::scanNearest(
+                   InGeoJsonDocument._pDocument->rootObject,
+                   point);
+  if (!pFeature) {
+    return FCesiumGeoJsonFeature();
+  }
+
+  Branches = EHasValue::HasValue;
+  return FCesiumGeoJsonFeature(InGeoJsonDocument._pDocument, pFeature);
+}
+
+namespace {
+const FCesiumGeoJsonGeometryColumns*
+getColumnsWithFeature(const FCesiumGeoJsonDocument& document, int32 feature) {
+  const FCesiumGeoJsonGeometryColumns* pColumns =
+      document.GetGeometryColumns().get();
+  if (!pColumns || feature < 0 || feature >= pColumns->GetFeatureCount()) {
+    return nullptr;
+  }
+  return pColumns;
+}
+} // namespace
+
+bool UCesiumGeoJsonDocumentBlueprintLibrary::HasGeometryColumns(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument) {
+  return InGeoJsonDocument._pGeometryColumns != nullptr;
+}
+
+int32 UCesiumGeoJsonDocumentBlueprintLibrary::GetGeometryColumnsFeatureCount(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument) {
+  const FCesiumGeoJsonGeometryColumns* pColumns =
+      InGeoJsonDocument._pGeometryColumns.get();
+  return pColumns ? pColumns->GetFeatureCount() : 0;
+}
+
+FCesiumGeoJsonFeature
+UCesiumGeoJsonDocumentBlueprintLibrary::GetGeometryColumnsFeature(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument,
+    int32 FeatureIndex) {
+  const FCesiumGeoJsonGeometryColumns* pColumns =
+      getColumnsWithFeature(InGeoJsonDocument, FeatureIndex);
+  if (!pColumns) {
+    return FCesiumGeoJsonFeature();
+  }
+
+  return FCesiumGeoJsonFeature(
+      InGeoJsonDocument._pDocument,
+      pColumns->GetFeature(FeatureIndex));
+}
+
+int32 UCesiumGeoJsonDocumentBlueprintLibrary::GetGeometryColumnsPartCount(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument,
+    int32 FeatureIndex) {
+  const FCesiumGeoJsonGeometryColumns* pColumns =
+      getColumnsWithFeature(InGeoJsonDocument, FeatureIndex);
+  return pColumns ? pColumns->GetPartCount(FeatureIndex) : 0;
+}
+
+int32 UCesiumGeoJsonDocumentBlueprintLibrary::GetGeometryColumnsLineCount(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument,
+    int32 FeatureIndex,
+    int32 PartIndex) {
+  const FCesiumGeoJsonGeometryColumns* pColumns =
+      getColumnsWithFeature(InGeoJsonDocument, FeatureIndex);
+  if (!pColumns || PartIndex < 0 ||
+      PartIndex >= pColumns->GetPartCount(FeatureIndex)) {
+    return 0;
+  }
+  return pColumns->GetLineCount(FeatureIndex, PartIndex);
+}
+
+int32 UCesiumGeoJsonDocumentBlueprintLibrary::GetGeometryColumnsPointCount(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument,
+    int32 FeatureIndex,
+    int32 PartIndex,
+    int32 LineIndex) {
+  if (LineIndex < 0 ||
+      LineIndex >=
+          GetGeometryColumnsLineCount(
+              InGeoJsonDocument,
+              FeatureIndex,
+              PartIndex)) {
+    return 0;
+  }
+  return InGeoJsonDocument._pGeometryColumns
+      ->GetLine(FeatureIndex, PartIndex, LineIndex)
+      .Num();
+}
+
+FVector UCesiumGeoJsonDocumentBlueprintLibrary::GetGeometryColumnsPoint(
+    const FCesiumGeoJsonDocument& InGeoJsonDocument,
+    int32 FeatureIndex,
+    int32 PartIndex,
+    int32 LineIndex,
+    int32 PointIndex) {
+  if (LineIndex < 0 ||
+      LineIndex >=
+          GetGeometryColumnsLineCount(
+              InGeoJsonDocument,
+              FeatureIndex,
+              PartIndex)) {
+    return FVector::ZeroVector;
+  }
+
+  const FCesiumGeoJsonGeometryColumns& columns =
+      *InGeoJsonDocument._pGeometryColumns;
+  const TConstArrayView<FVector3f> line =
+      columns.GetLine(FeatureIndex, PartIndex, LineIndex);
+  if (!line.IsValidIndex(PointIndex)) {
+    return FVector::ZeroVector;
+  }
+  return columns.GetPosition(FeatureIndex, line[PointIndex]);
+}
+
+namespace {
+/**
+ * Options for processing a GeoJSON document after it is parsed, along with a
+ * function that reports the progress of that processing to the game thread.
+ */
+struct DocumentProcessingOptions {
+  bool buildSpatialIndex;
+  bool buildGeometryColumns;
+  FCesiumGeoJsonDocumentProcessingProgressDelegate onProgress;
+
+  void reportProgress(float progress) const {
+    if (!this->onProgress.IsBound()) {
+      return;
+    }
+
+    // Main thread tasks run in order, so progress always arrives before the
+    // load result.
+    getAsyncSystem().runInMainThread(
+        [onProgress = this->onProgress, progress]() {
+          onProgress.Broadcast(progress);
+        });
+  }
+};
+
+/**
+ * Converts the result of loading a GeoJSON document, building its spatial
+ * index and geometry columns if requested. This is called in a worker thread.
+ */
+std::optional<FCesiumGeoJsonDocument> createDocumentFromResult(
+    CesiumUtility::Result<CesiumVectorData::GeoJsonDocument>&& result,
+    const DocumentProcessingOptions& options) {
+  if (result.errors.hasErrors()) {
+    result.errors.logError(spdlog::default_logger(), "Errors loading GeoJSON");
+    result.errors.logWarning(
+        spdlog::default_logger(),
+        "Warnings loading GeoJSON");
+  }
+
+  if (!result.value) {
+    return std::nullopt;
+  }
+
+  FCesiumGeoJsonDocument document(
+      std::make_shared<CesiumVectorData::GeoJsonDocument>(
+          std::move(*result.value)));
+
+  // Each of the requested steps counts equally toward progress. Parsing has
+  // already finished, and is not counted.
+  const float stageCount = FMath::Max(
+      float(options.buildGeometryColumns) + float(options.buildSpatialIndex),
+      1.0f);
+  float stagesComplete = 0.0f;
+  options.reportProgress(0.0f);
+
+  if (options.buildSpatialIndex) {
+    document.BuildSpatialIndex();
+    stagesComplete += 1.0f;
+    options.reportProgress(stagesComplete / stageCount);
+  }
+
+  if (options.buildGeometryColumns) {
+    auto onColumnProgress = [&options, stagesComplete, stageCount](
+                                float fraction) {
+      options.reportProgress((stagesComplete + fraction) / stageCount);
+    };
+
+    // Nothing else refers to the document yet, so unless the spatial index
+    // needs it, the geometry can be moved into the columns rather than kept
+    // in both places.
+    if (options.buildSpatialIndex) {
+      document.BuildGeometryColumns(onColumnProgress);
+    } else {
+      document.MoveGeometryToColumns(onColumnProgress);
+    }
+  }
+
+  options.reportProgress(1.0f);
+  return document;
+}
+
+CesiumAsync::Future<void> processAndBroadcastDocument(
+    CesiumAsync::Future<
+        CesiumUtility::Result<CesiumVectorData::GeoJsonDocument>>&& future,
+    DocumentProcessingOptions&& options,
+    const FCesiumGeoJsonDocumentAsyncLoadDelegate& callback) {
+  return std::move(future)
+      .thenInWorkerThread(
+          [options = std::move(options)](
+              CesiumUtility::Result<CesiumVectorData::GeoJsonDocument>&&
+                  result) {
+            return createDocumentFromResult(std::move(result), options);
+          })
+      .thenInMainThread(
+          [callback](std::optional<FCesiumGeoJsonDocument>&& document) {
+            if (document) {
+              callback.Broadcast(true, MoveTemp(*document));
+            } else {
+              callback.Broadcast(false, {});
+            }
+          });
+}
+} // namespace
+
+UCesiumLoadGeoJsonDocumentFromStringAsyncAction*
+UCesiumLoadGeoJsonDocumentFromStringAsyncAction::LoadFromString(
+    const FString& InString,
+    bool BuildSpatialIndex,
+    bool BuildGeometryColumns) {
+  UCesiumLoadGeoJsonDocumentFromStringAsyncAction* pAction =
+      NewObject<UCesiumLoadGeoJsonDocumentFromStringAsyncAction>();
+  pAction->String = InString;
+  pAction->BuildSpatialIndex = BuildSpatialIndex;
+  pAction->BuildGeometryColumns = BuildGeometryColumns;
+  return pAction;
+}
+
+void UCesiumLoadGeoJsonDocumentFromStringAsyncAction::Activate() {
+  processAndBroadcastDocument(
+      getAsyncSystem().runInWorkerThread([String = MoveTemp(this->String)]() {
+        const std::string str = TCHAR_TO_UTF8(*String);
+        std::span<const std::byte> bytes(
+            reinterpret_cast<const std::byte*>(str.data()),
+            str.size());
+        return CesiumVectorData::GeoJsonDocument::fromGeoJson(bytes);
+      }),
+      DocumentProcessingOptions{
+          this->BuildSpatialIndex,
+          this->BuildGeometryColumns,
+          this->OnProcessingProgress},
+      this->OnLoadResult);
+}
+
 UCesiumLoadGeoJsonDocumentFromIonAsyncAction*
 UCesiumLoadGeoJsonDocumentFromIonAsyncAction::LoadFromIon(
     int64 AssetId,
     const FString& IonAccessToken,
-    const UCesiumIonServer* CesiumIonServer) {
+    const UCesiumIonServer* CesiumIonServer,
+    bool BuildSpatialIndex,
+    bool BuildGeometryColumns) {
   UCesiumLoadGeoJsonDocumentFromIonAsyncAction* pAction =
       NewObject<UCesiumLoadGeoJsonDocumentFromIonAsyncAction>();
   pAction->AssetId = AssetId;
   pAction->IonAccessToken = IonAccessToken;
   pAction->CesiumIonServer = CesiumIonServer;
+  pAction->BuildSpatialIndex = BuildSpatialIndex;
+  pAction->BuildGeometryColumns = BuildGeometryColumns;
   return pAction;
 }
 
@@ -88,45 +477,32 @@ void UCesiumLoadGeoJsonDocumentFromIonAsyncAction::Activate() {
       this->IonAccessToken.IsEmpty()
           ? TCHAR_TO_UTF8(*this->CesiumIonServer->DefaultIonAccessToken)
           : TCHAR_TO_UTF8(*this->IonAccessToken));
-  CesiumVectorData::GeoJsonDocument::fromCesiumIonAsset(
-      getAsyncSystem(),
-      getAssetAccessor(),
-      this->AssetId,
-      token,
-      std::string(TCHAR_TO_UTF8(*this->CesiumIonServer->ApiUrl)) + "/")
-      .thenInMainThread(
-          [Callback = this->OnLoadResult](
-              CesiumUtility::Result<CesiumVectorData::GeoJsonDocument>&&
-                  result) {
-            if (result.errors.hasErrors()) {
-              result.errors.logError(
-                  spdlog::default_logger(),
-                  "Errors loading GeoJSON");
-              result.errors.logWarning(
-                  spdlog::default_logger(),
-                  "Warnings loading GeoJSON");
-            }
-
-            if (result.value) {
-              Callback.Broadcast(
-                  true,
-                  FCesiumGeoJsonDocument(
-                      std::make_shared<CesiumVectorData::GeoJsonDocument>(
-                          std::move(*result.value))));
-            } else {
-              Callback.Broadcast(false, {});
-            }
-          });
+  processAndBroadcastDocument(
+      CesiumVectorData::GeoJsonDocument::fromCesiumIonAsset(
+          getAsyncSystem(),
+          getAssetAccessor(),
+          this->AssetId,
+          token,
+          std::string(TCHAR_TO_UTF8(*this->CesiumIonServer->ApiUrl)) + "/"),
+      DocumentProcessingOptions{
+          this->BuildSpatialIndex,
+          this->BuildGeometryColumns,
+          this->OnProcessingProgress},
+      this->OnLoadResult);
 }
 
 UCesiumLoadGeoJsonDocumentFromUrlAsyncAction*
 UCesiumLoadGeoJsonDocumentFromUrlAsyncAction::LoadFromUrl(
     const FString& Url,
-    const TMap<FString, FString>& Headers) {
+    const TMap<FString, FString>& Headers,
+    bool BuildSpatialIndex,
+    bool BuildGeometryColumns) {
   UCesiumLoadGeoJsonDocumentFromUrlAsyncAction* pAction =
       NewObject<UCesiumLoadGeoJsonDocumentFromUrlAsyncAction>();
   pAction->Url = Url;
   pAction->Headers = Headers;
+  pAction->BuildSpatialIndex = BuildSpatialIndex;
+  pAction->BuildGeometryColumns = BuildGeometryColumns;
   return pAction;
 }
 
@@ -140,32 +516,15 @@ void UCesiumLoadGeoJsonDocumentFromUrlAsyncAction::Activate() {
         TCHAR_TO_UTF8(*Value)});
   }
 
-  CesiumVectorData::GeoJsonDocument::fromUrl(
-      getAsyncSystem(),
-      getAssetAccessor(),
-      TCHAR_TO_UTF8(*this->Url),
-      std::move(requestHeaders))
-      .thenInMainThread(
-          [Callback = this->OnLoadResult](
-              CesiumUtility::Result<CesiumVectorData::GeoJsonDocument>&&
-                  result) {
-            if (result.errors.hasErrors()) {
-              result.errors.logError(
-                  spdlog::default_logger(),
-                  "Errors loading GeoJSON");
-              result.errors.logWarning(
-                  spdlog::default_logger(),
-                  "Warnings loading GeoJSON");
-            }
-
-            if (result.value) {
-              Callback.Broadcast(
-                  true,
-                  FCesiumGeoJsonDocument(
-                      std::make_shared<CesiumVectorData::GeoJsonDocument>(
-                          std::move(*result.value))));
-            } else {
-              Callback.Broadcast(false, {});
-            }
-          });
+  processAndBroadcastDocument(
+      CesiumVectorData::GeoJsonDocument::fromUrl(
+          getAsyncSystem(),
+          getAssetAccessor(),
+          TCHAR_TO_UTF8(*this->Url),
+          std::move(requestHeaders)),
+      DocumentProcessingOptions{
+          this->BuildSpatialIndex,
+          this->BuildGeometryColumns,
+          this->OnProcessingProgress},
+      this->OnLoadResult);
 }
@@ -0,0 +1,157 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumGeoJsonGeometryColumns.h"
+
+using namespace CesiumVectorData;
+
+FCesiumGeoJsonGeometryColumns::FCesiumGeoJsonGeometryColumns(
+    const GeoJsonObject& rootObject,
+    const TFunction<void(float)>& onProgress)
+    : FCesiumGeoJsonGeometryColumns(rootObject, onProgress, false) {}
+
+/*static*/ FCesiumGeoJsonGeometryColumns
+FCesiumGeoJsonGeometryColumns::MoveFromDocument(
+    GeoJsonObject& rootObject,
+    const TFunction<void(float)>& onProgress) {
+  return FCesiumGeoJsonGeometryColumns(rootObject, onProgress, true);
+}
+
+FCesiumGeoJsonGeometryColumns::FCesiumGeoJsonGeometryColumns(
+    const GeoJsonObject& rootObject,
+    const TFunction<void(float)>& onProgress,
+    bool releaseGeometry) {
+  for (ConstGeoJsonObjectIterator it(rootObject); !it.isEnded(); ++it) {
+    const GeoJsonFeature* pFeature = (*it).getIf<GeoJsonFeature>();
+    if (pFeature) {
+      this->_features.Add(pFeature);
+    }
+  }
+
+  const int32 featureCount = this->_features.Num();
+  this->_featureOrigins.Reserve(featureCount);
+  this->_featurePartOffsets.Reserve(featureCount + 1);
+  this->_featurePartOffsets.Add(0);
+  this->_partLineOffsets.Add(0);
+  this->_lineCoordinateOffsets.Add(0);
+
+  // Report progress about twenty times over the whole document.
+  const int32 progressInterval = FMath::Max(featureCount / 20, 1);
+
+  for (int32 i = 0; i < featureCount; ++i) {
+    const GeoJsonFeature* pFeature = this->_features[i];
+    if (pFeature->geometry) {
+      this->_addGeometry(*pFeature->geometry);
+      if (releaseGeometry) {
+        // Only MoveFromDocument releases geometry, and it was given a
+        // non-const root, so the feature itself is not const.
+        const_cast<GeoJsonFeature*>(pFeature)->geometry.reset();
+      }
+    }
+    this->_endFeature();
+
+    if (onProgress && (i + 1) % progressInterval == 0) {
+      onProgress(float(i + 1) / float(featureCount));
+    }
+  }
+
+  this->_featureCoordinates.Empty();
+  this->_partLineOffsets.Shrink();
+  this->_lineCoordinateOffsets.Shrink();
+  this->_partTypes.Shrink();
+  this->_coordinates.Shrink();
+}
+
+SIZE_T FCesiumGeoJsonGeometryColumns::GetAllocatedSize() const {
+  return sizeof(*this) + this->_features.GetAllocatedSize() +
+         this->_featureOrigins.GetAllocatedSize() +
+         this->_featurePartOffsets.GetAllocatedSize() +
+         this->_partLineOffsets.GetAllocatedSize() +
+         this->_lineCoordinateOffsets.GetAllocatedSize() +
+         this->_partTypes.GetAllocatedSize() +
+         this->_coordinates.GetAllocatedSize();
+}
+
+void FCesiumGeoJsonGeometryColumns::_addGeometry(
+    const GeoJsonObject& geometry) {
+  if (const GeoJsonPoint* pPoint = geometry.getIf<GeoJsonPoint>()) {
+    this->_addLine(&pPoint->coordinates, 1);
+    this->_endPart(ECesiumGeoJsonObjectType::Point);
+  } else if (
+      const GeoJsonMultiPoint* pMultiPoint =
+          geometry.getIf<GeoJsonMultiPoint>()) {
+    this->_addLine(
+        pMultiPoint->coordinates.data(),
+        pMultiPoint->coordinates.size());
+    this->_endPart(ECesiumGeoJsonObjectType::MultiPoint);
+  } else if (
+      const GeoJsonLineString* pLineString =
+          geometry.getIf<GeoJsonLineString>()) {
+    this->_addLine(
+        pLineString->coordinates.data(),
+        pLineString->coordinates.size());
+    this->_endPart(ECesiumGeoJsonObjectType::LineString);
+  } else if (
+      const GeoJsonMultiLineString* pMultiLineString =
+          geometry.getIf<GeoJsonMultiLineString>()) {
+    for (const std::vector<glm::dvec3>& line : pMultiLineString->coordinates) {
+      this->_addLine(line.data(), line.size());
+      this->_endPart(ECesiumGeoJsonObjectType::MultiLineString);
+    }
+  } else if (
+      const GeoJsonPolygon* pPolygon = geometry.getIf<GeoJsonPolygon>()) {
+    for (const std::vector<glm::dvec3>& ring : pPolygon->coordinates) {
+      this->_addLine(ring.data(), ring.size());
+    }
+    this->_endPart(ECesiumGeoJsonObjectType::Polygon);
+  } else if (
+      const GeoJsonMultiPolygon* pMultiPolygon =
+          geometry.getIf<GeoJsonMultiPolygon>()) {
+    for (const std::vector<std::vector<glm::dvec3>>& polygon :
+         pMultiPolygon->coordinates) {
+      for (const std::vector<glm::dvec3>& ring : polygon) {
+        this->_addLine(ring.data(), ring.size());
+      }
+      this->_endPart(ECesiumGeoJsonObjectType::MultiPolygon);
+    }
+  } else if (
+      const GeoJsonGeometryCollection* pCollection =
+          geometry.getIf<GeoJsonGeometryCollection>()) {
+    for (const GeoJsonObject& child : pCollection->geometries) {
+      this->_addGeometry(child);
+    }
+  }
+}
+
+void FCesiumGeoJsonGeometryColumns::_addLine(
+    const glm::dvec3* pCoordinates,
+    size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    const glm::dvec3& coordinates = pCoordinates[i];
+    this->_featureCoordinates.Emplace(
+        coordinates.x,
+        coordinates.y,
+        coordinates.z);
+  }
+  this->_lineCoordinateOffsets.Add(
+      this->_coordinates.Num() + this->_featureCoordinates.Num());
+}
+
+void FCesiumGeoJsonGeometryColumns::_endPart(ECesiumGeoJsonObjectType type) {
+  this->_partTypes.Add(type);
+  this->_partLineOffsets.Add(this->_lineCoordinateOffsets.Num() - 1);
+}
+
+void FCesiumGeoJsonGeometryColumns::_endFeature() {
+  FVector origin = FVector::ZeroVector;
+  if (!this->_featureCoordinates.IsEmpty()) {
+    origin = FBox(this->_featureCoordinates).GetCenter();
+  }
+
+  this->_featureOrigins.Add(origin);
+  for (const FVector& coordinates : this->_featureCoordinates) {
+    this->_coordinates.Emplace(coordinates - origin);
+  }
+  this->_featureCoordinates.Reset();
+
+  this->_featurePartOffsets.Add(this->_partTypes.Num());
+}
@@ -4,6 +4,7 @@
 #include "Dom/JsonObject.h"
 #include "VecMath.h"
 
+#include <span>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -306,6 +307,46 @@ UCesiumGeoJsonObjectBlueprintLibrary::GetObjectAsLineString(
   return FCesiumGeoJsonLineString(MoveTemp(Points));
 }
 
+namespace {
+std::span<const glm::dvec3>
+getPointCoordinates(const FCesiumGeoJsonObject& object) {
+  if (!object.getDocument() || !object.getObject()) {
+    return {};
+  }
+
+  const CesiumVectorData::GeoJsonObject& value = *object.getObject();
+  if (const CesiumVectorData::GeoJsonPoint* pPoint =
+          value.getIf<CesiumVectorData::GeoJsonPoint>()) {
+    return std::span<const glm::dvec3>(&pPoint->coordinates, 1);
+  }
+  if (const CesiumVectorData::GeoJsonMultiPoint* pMultiPoint =
+          value.getIf<CesiumVectorData::GeoJsonMultiPoint>()) {
+    return pMultiPoint->coordinates;
+  }
+  if (const CesiumVectorData::GeoJsonLineString* pLineString =
+          value.getIf<CesiumVectorData::GeoJsonLineString>()) {
+    return pLineString->coordinates;
+  }
+  return {};
+}
+} // namespace
+
+int32 UCesiumGeoJsonObjectBlueprintLibrary::GetObjectPointCount(
+    const FCesiumGeoJsonObject& InObject) {
+  return int32(getPointCoordinates(InObject).size());
+}
+
+FVector UCesiumGeoJsonObjectBlueprintLibrary::GetObjectPointAt(
+    const FCesiumGeoJsonObject& InObject,
+    int32 Index) {
+  const std::span<const glm::dvec3> coordinates =
+      getPointCoordinates(InObject);
+  if (Index < 0 || size_t(Index) >= coordinates.size()) {
+    return FVector::ZeroVector;
+  }
+  return VecMath::createVector(coordinates[size_t(Index)]);
+}
+
 TArray<FCesiumGeoJsonLineString>
 UCesiumGeoJsonObjectBlueprintLibrary::GetObjectAsMultiLineString(
     const FCesiumGeoJsonObject& InObject) {
@@ -0,0 +1,459 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumGeoJsonSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <utility>
+
+using namespace CesiumVectorData;
+
+namespace {
+
+// The maximum number of children of each node in the tree.
+constexpr size_t NodeSize = 16;
+
+using Rectangle = CesiumGeoJsonSpatialIndex::Rectangle;
+
+Rectangle createEmptyRectangle() {
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+  return Rectangle{infinity, infinity, -infinity, -infinity};
+}
+
+bool isEmpty(const Rectangle& rectangle) {
+  return rectangle.minimumX > rectangle.maximumX;
+}
+
+Rectangle computeBounds(const GeoJsonObject& geometry) {
+  Rectangle bounds = createEmptyRectangle();
+  for (ConstGeoJsonPointIterator it(geometry);
+       it != ConstGeoJsonPointIterator();
+       ++it) {
+    const glm::dvec3& point = *it;
+    bounds.expandToInclude(Rectangle{point.x, point.y, point.x, point.y});
+  }
+  return bounds;
+}
+
+double distanceSquared(const glm::dvec2& a, const glm::dvec3& b) {
+  const double dx = a.x - b.x;
+  const double dy = a.y - b.y;
+  return dx * dx + dy * dy;
+}
+
+double segmentDistanceSquared(
+    const glm::dvec2& point,
+    const glm::dvec3& a,
+    const glm::dvec3& b) {
+  const glm::dvec2 ab(b.x - a.x, b.y - a.y);
+  const glm::dvec2 ap(point.x - a.x, point.y - a.y);
+  const double lengthSquared = ab.x * ab.x + ab.y * ab.y;
+  if (lengthSquared == 0.0) {
+    return distanceSquared(point, a);
+  }
+
+  const double t =
+      std::clamp((ap.x * ab.x + ap.y * ab.y) / lengthSquared, 0.0, 1.0);
+  const double dx = ap.x - t * ab.x;
+  const double dy = ap.y - t * ab.y;
+  return dx * dx + dy * dy;
+}
+
+double polylineDistanceSquared(
+    const glm::dvec2& point,
+    const std::vector<glm::dvec3>& points) {
+  if (points.size() == 1) {
+    return distanceSquared(point, points[0]);
+  }
+
+  double result = std::numeric_limits<double>::infinity();
+  for (size_t i = 1; i < points.size(); ++i) {
+    result = std::min(
+        result,
+        segmentDistanceSquared(point, points[i - 1], points[i]));
+  }
+  return result;
+}
+
+/**
+ * Tests whether a point is inside a polygon with the even-odd rule, so that
+ * points inside holes are outside the polygon.
+ */
+bool polygonContains(
+    const std::vector<std::vector<glm::dvec3>>& rings,
+    const glm::dvec2& point) {
+  bool inside = false;
+  for (const std::vector<glm::dvec3>& ring : rings) {
+    for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+      const glm::dvec3& a = ring[i];
+      const glm::dvec3& b = ring[j];
+      if ((a.y > point.y) != (b.y > point.y) &&
+          point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x) {
+        inside = !inside;
+      }
+    }
+  }
+  return inside;
+}
+
+bool geometryContains(const GeoJsonObject& geometry, const glm::dvec2& point) {
+  if (const GeoJsonPolygon* pPolygon = geometry.getIf<GeoJsonPolygon>()) {
+    return polygonContains(pPolygon->coordinates, point);
+  }
+
+  if (const GeoJsonMultiPolygon* pMultiPolygon =
+          geometry.getIf<GeoJsonMultiPolygon>()) {
+    for (const std::vector<std::vector<glm::dvec3>>& polygon :
+         pMultiPolygon->coordinates) {
+      if (polygonContains(polygon, point)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  if (const GeoJsonGeometryCollection* pCollection =
+          geometry.getIf<GeoJsonGeometryCollection>()) {
+    for (const GeoJsonObject& child : pCollection->geometries) {
+      if (geometryContains(child, point)) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+double polygonDistanceSquared(
+    const std::vector<std::vector<glm::dvec3>>& rings,
+    const glm::dvec2& point) {
+  if (polygonContains(rings, point)) {
+    return 0.0;
+  }
+
+  double result = std::numeric_limits<double>::infinity();
+  for (const std::vector<glm::dvec3>& ring : rings) {
+    result = std::min(result, polylineDistanceSquared(point, ring));
+  }
+  return result;
+}
+
+double geometryDistanceSquared(
+    const GeoJsonObject& geometry,
+    const glm::dvec2& point) {
+  double result = std::numeric_limits<double>::infinity();
+
+  if (const GeoJsonPoint* pPoint = geometry.getIf<GeoJsonPoint>()) {
+    result = distanceSquared(point, pPoint->coordinates);
+  } else if (
+      const GeoJsonMultiPoint* pMultiPoint =
+          geometry.getIf<GeoJsonMultiPoint>()) {
+    for (const glm::dvec3& coordinates : pMultiPoint->coordinates) {
+      result = std::min(result, distanceSquared(point, coordinates));
+    }
+  } else if (
+      const GeoJsonLineString* pLineString =
+          geometry.getIf<GeoJsonLineString>()) {
+    result = polylineDistanceSquared(point, pLineString->coordinates);
+  } else if (
+      const GeoJsonMultiLineString* pMultiLineString =
+          geometry.getIf<GeoJsonMultiLineString>()) {
+    for (const std::vector<glm::dvec3>& line : pMultiLineString->coordinates) {
+      result = std::min(result, polylineDistanceSquared(point, line));
+    }
+  } else if (
+      const GeoJsonPolygon* pPolygon = geometry.getIf<GeoJsonPolygon>()) {
+    result = polygonDistanceSquared(pPolygon->coordinates, point);
+  } else if (
+      const GeoJsonMultiPolygon* pMultiPolygon =
+          geometry.getIf<GeoJsonMultiPolygon>()) {
+    for (const std::vector<std::vector<glm::dvec3>>& polygon :
+         pMultiPolygon->coordinates) {
+      result = std::min(result, polygonDistanceSquared(polygon, point));
+    }
+  } else if (
+      const GeoJsonGeometryCollection* pCollection =
+          geometry.getIf<GeoJsonGeometryCollection>()) {
+    for (const GeoJsonObject& child : pCollection->geometries) {
+      result = std::min(result, geometryDistanceSquared(child, point));
+    }
+  }
+
+  return result;
+}
+
+/**
+ * Invokes the callback with every feature under the root that has a geometry.
+ */
+template <typename Callback>
+void forEachFeatureWithGeometry(
+    const GeoJsonObject& rootObject,
+    Callback&& callback) {
+  for (ConstGeoJsonObjectIterator it(rootObject); !it.isEnded(); ++it) {
+    const GeoJsonFeature* pFeature = (*it).getIf<GeoJsonFeature>();
+    if (pFeature && pFeature->geometry) {
+      callback(*pFeature);
+    }
+  }
+}
+
+} // namespace
+
+bool CesiumGeoJsonSpatialIndex::Rectangle::intersects(
+    const Rectangle& other) const {
+  return this->minimumX <= other.maximumX && other.minimumX <= this->maximumX &&
+         this->minimumY <= other.maximumY && other.minimumY <= this->maximumY;
+}
+
+double CesiumGeoJsonSpatialIndex::Rectangle::distanceSquared(
+    const glm::dvec2& point) const {
+  const double dx =
+      std::max({this->minimumX - point.x, 0.0, point.x - this->maximumX});
+  const double dy =
+      std::max({this->minimumY - point.y, 0.0, point.y - this->maximumY});
+  return dx * dx + dy * dy;
+}
+
+void CesiumGeoJsonSpatialIndex::Rectangle::expandToInclude(
+    const Rectangle& other) {
+  this->minimumX = std::min(this->minimumX, other.minimumX);
+  this->minimumY = std::min(this->minimumY, other.minimumY);
+  this->maximumX = std::max(this->maximumX, other.maximumX);
+  this->maximumY = std::max(this->maximumY, other.maximumY);
+}
+
+CesiumGeoJsonSpatialIndex::CesiumGeoJsonSpatialIndex(
+    const GeoJsonObject& rootObject) {
+  forEachFeatureWithGeometry(rootObject, [this](const GeoJsonFeature& feature) {
+    const Rectangle bounds = computeBounds(*feature.geometry);
+    if (!isEmpty(bounds)) {
+      this->_entries.push_back(Entry{bounds, &feature});
+    }
+  });
+
+  if (this->_entries.empty()) {
+    return;
+  }
+
+  // Sort-Tile-Recursive: sort by X into vertical slices that each hold enough
+  // entries for a row of leaf nodes, then sort each slice by Y, so that
+  // consecutive runs of NodeSize entries are spatially compact.
+  const size_t entryCount = this->_entries.size();
+  const size_t leafCount = (entryCount + NodeSize - 1) / NodeSize;
+  const size_t sliceCount = size_t(std::ceil(std::sqrt(double(leafCount))));
+  const size_t sliceSize = sliceCount * NodeSize;
+
+  std::sort(
+      this->_entries.begin(),
+      this->_entries.end(),
+      [](const Entry& a, const Entry& b) {
+        return a.bounds.minimumX + a.bounds.maximumX <
+               b.bounds.minimumX + b.bounds.maximumX;
+      });
+
+  for (size_t start = 0; start < entryCount; start += sliceSize) {
+    std::sort(
+        this->_entries.begin() + start,
+        this->_entries.begin() + std::min(start + sliceSize, entryCount),
+        [](const Entry& a, const Entry& b) {
+          return a.bounds.minimumY + a.bounds.maximumY <
+                 b.bounds.minimumY + b.bounds.maximumY;
+        });
+  }
+
+  std::vector<Rectangle>& leaves = this->_levels.emplace_back();
+  leaves.reserve(entryCount);
+  for (const Entry& entry : this->_entries) {
+    leaves.push_back(entry.bounds);
+  }
+
+  while (this->_levels.back().size() > 1) {
+    const std::vector<Rectangle>& children = this->_levels.back();
+
+    std::vector<Rectangle> parents;
+    parents.reserve((children.size() + NodeSize - 1) / NodeSize);
+    for (size_t i = 0; i < children.size(); i += NodeSize) {
+      Rectangle bounds = createEmptyRectangle();
+      const size_t end = std::min(i + NodeSize, children.size());
+      for (size_t j = i; j < end; ++j) {
+        bounds.expandToInclude(children[j]);
+      }
+      parents.push_back(bounds);
+    }
+
+    this->_levels.emplace_back(std::move(parents));
+  }
+}
+
+template <typename Callback>
+void CesiumGeoJsonSpatialIndex::_forEachIntersecting(
+    const Rectangle& rectangle,
+    Callback&& callback) const {
+  if (this->_entries.empty()) {
+    return;
+  }
+
+  // Pairs of (level, node index) that remain to be visited.
+  std::vector<std::pair<size_t, size_t>> stack;
+  stack.emplace_back(this->_levels.size() - 1, 0);
+
+  while (!stack.empty()) {
+    const auto [level, index] = stack.back();
+    stack.pop_back();
+
+    if (!this->_levels[level][index].intersects(rectangle)) {
+      continue;
+    }
+
+    if (level == 0) {
+      callback(this->_entries[index]);
+      continue;
+    }
+
+    const size_t begin = index * NodeSize;
+    const size_t end =
+        std::min(begin + NodeSize, this->_levels[level - 1].size());
+    for (size_t child = begin; child < end; ++child) {
+      stack.emplace_back(level - 1, child);
+    }
+  }
+}
+
+std::vector<const GeoJsonFeature*>
+CesiumGeoJsonSpatialIndex::findContaining(const glm::dvec2& point) const {
+  std::vector<const GeoJsonFeature*> result;
+  this->_forEachIntersecting(
+      Rectangle{point.x, point.y, point.x, point.y},
+      [&result, &point](const Entry& entry) {
+        if (geometryContains(*entry.pFeature->geometry, point)) {
+          result.push_back(entry.pFeature);
+        }
+      });
+  return result;
+}
+
+std::vector<const GeoJsonFeature*>
+CesiumGeoJsonSpatialIndex::findIntersecting(const Rectangle& rectangle) const {
+  std::vector<const GeoJsonFeature*> result;
+  this->_forEachIntersecting(rectangle, [&result](const Entry& entry) {
+    result.push_back(entry.pFeature);
+  });
+  return result;
+}
+
+const GeoJsonFeature*
+CesiumGeoJsonSpatialIndex::findNearest(const glm::dvec2& point) const {
+  if (this->_entries.empty()) {
+    return nullptr;
+  }
+
+  // A best-first search. Nodes are ordered by the distance to their bounds,
+  // which is never more than the distance to any feature inside them, so the
+  // first exact feature distance to reach the front of the queue is the
+  // nearest.
+  struct Candidate {
+    double distanceSquared;
+    size_t level;
+    size_t index;
+    bool isExact;
+
+    bool operator>(const Candidate& other) const {
+      return this->distanceSquared > other.distanceSquared;
+    }
+  };
+
+  std::priority_queue<
+      Candidate,
+      std::vector<Candidate>,
+      std::greater<Candidate>>
+      queue;
+  const size_t rootLevel = this->_levels.size() - 1;
+  queue.push(Candidate{
+      this->_levels[rootLevel][0].distanceSquared(point),
+      rootLevel,
+      0,
+      false});
+
+  while (!queue.empty()) {
+    const Candidate candidate = queue.top();
+    queue.pop();
+
+    if (candidate.isExact) {
+      return this->_entries[candidate.index].pFeature;
+    }
+
+    if (candidate.level == 0) {
+      const Entry& entry = this->_entries[candidate.index];
+      queue.push(Candidate{
+          geometryDistanceSquared(*entry.pFeature->geometry, point),
+          0,
+          candidate.index,
+          true});
+      continue;
+    }
+
+    const std::vector<Rectangle>& children =
+        this->_levels[candidate.level - 1];
+    const size_t begin = candidate.index * NodeSize;
+    const size_t end = std::min(begin + NodeSize, children.size());
+    for (size_t child = begin; child < end; ++child) {
+      queue.push(Candidate{
+          children[child].distanceSquared(point),
+          candidate.level - 1,
+          child,
+          false});
+    }
+  }
+
+  return nullptr;
+}
+
+std::vector<const GeoJsonFeature*> CesiumGeoJsonSpatialIndex::scanContaining(
+    const GeoJsonObject& rootObject,
+    const glm::dvec2& point) {
+  std::vector<const GeoJsonFeature*> result;
+  forEachFeatureWithGeometry(
+      rootObject,
+      [&result, &point](const GeoJsonFeature& feature) {
+        if (geometryContains(*feature.geometry, point)) {
+          result.push_back(&feature);
+        }
+      });
+  return result;
+}
+
+std::vector<const GeoJsonFeature*> CesiumGeoJsonSpatialIndex::scanIntersecting(
+    const GeoJsonObject& rootObject,
+    const Rectangle& rectangle) {
+  std::vector<const GeoJsonFeature*> result;
+  forEachFeatureWithGeometry(
+      rootObject,
+      [&result, &rectangle](const GeoJsonFeature& feature) {
+        const Rectangle bounds = computeBounds(*feature.geometry);
+        if (!isEmpty(bounds) && bounds.intersects(rectangle)) {
+          result.push_back(&feature);
+        }
+      });
+  return result;
+}
+
+const GeoJsonFeature* CesiumGeoJsonSpatialIndex::scanNearest(
+    const GeoJsonObject& rootObject,
+    const glm::dvec2& point) {
+  const GeoJsonFeature* pNearest = nullptr;
+  double nearestDistanceSquared = std::numeric_limits<double>::infinity();
+  forEachFeatureWithGeometry(
+      rootObject,
+      [&pNearest, &nearestDistanceSquared, &point](
+          const GeoJsonFeature& feature) {
+        const double distance =
+            geometryDistanceSquared(*feature.geometry, point);
+        if (distance < nearestDistanceSquared) {
+          pNearest = &feature;
+          nearestDistanceSquared = distance;
+        }
+      });
+  return pNearest;
+}
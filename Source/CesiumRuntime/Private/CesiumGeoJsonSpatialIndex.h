@@ -0,0 +1,121 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include <CesiumVectorData/GeoJsonObject.h>
+
+#include <glm/vec2.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * A packed R-tree over the features in a GeoJSON document, which allows the
+ * features at or near a location to be found without visiting every object in
+ * the document.
+ *
+ * The tree is bulk-loaded with the Sort-Tile-Recursive algorithm and cannot be
+ * modified after it is built. All coordinates are longitude (X) and latitude
+ * (Y) in degrees, and heights are ignored. Distances are measured in degrees
+ * in this plane, so they are only meaningful for comparing nearby features.
+ *
+ * The index refers to the features of the document it was built from, so it
+ * must not outlive that document. Once built, it may be queried from any
+ * thread.
+ */
+class CesiumGeoJsonSpatialIndex {
+public:
+  /**
+   * An axis-aligned rectangle in longitude and latitude.
+   */
+  struct Rectangle {
+    double minimumX;
+    double minimumY;
+    double maximumX;
+    double maximumY;
+
+    bool intersects(const Rectangle& other) const;
+    double distanceSquared(const glm::dvec2& point) const;
+    void expandToInclude(const Rectangle& other);
+  };
+
+  /**
+   * Builds an index of every feature in the tree of objects under the given
+   * root that has a geometry.
+   */
+  explicit CesiumGeoJsonSpatialIndex(
+      const CesiumVectorData::GeoJsonObject& rootObject);
+
+  /**
+   * Gets the number of features in the index.
+   */
+  size_t getFeatureCount() const { return this->_entries.size(); }
+
+  /**
+   * Finds the features whose geometry contains the given point. Only Polygon
+   * and MultiPolygon geometries, including those inside geometry collections,
+   * can contain a point.
+   */
+  std::vector<const CesiumVectorData::GeoJsonFeature*>
+  findContaining(const glm::dvec2& point) const;
+
+  /**
+   * Finds the features whose bounding rectangles intersect the given
+   * rectangle.
+   */
+  std::vector<const CesiumVectorData::GeoJsonFeature*>
+  findIntersecting(const Rectangle& rectangle) const;
+
+  /**
+   * Finds the feature whose geometry is closest to the given point, or nullptr
+   * if the index is empty. If the point is inside a polygon, the distance to
+   * that polygon is zero.
+   */
+  const CesiumVectorData::GeoJsonFeature*
+  findNearest(const glm::dvec2& point) const;
+
+  /**
+   * Like findContaining, but visits every feature under the given root rather
+   * than using an index. This is faster than building an index for a single
+   * query.
+   */
+  static std::vector<const CesiumVectorData::GeoJsonFeature*> scanContaining(
+      const CesiumVectorData::GeoJsonObject& rootObject,
+      const glm::dvec2& point);
+
+  /**
+   * Like findIntersecting, but visits every feature under the given root
+   * rather than using an index.
+   */
+  static std::vector<const CesiumVectorData::GeoJsonFeature*>
+  scanIntersecting(
+      const CesiumVectorData::GeoJsonObject& rootObject,
+      const Rectangle& rectangle);
+
+  /**
+   * Like findNearest, but visits every feature under the given root rather
+   * than using an index.
+   */
+  static const CesiumVectorData::GeoJsonFeature* scanNearest(
+      const CesiumVectorData::GeoJsonObject& rootObject,
+      const glm::dvec2& point);
+
+private:
+  struct Entry {
+    Rectangle bounds;
+    const CesiumVectorData::GeoJsonFeature* pFeature;
+  };
+
+  template <typename Callback>
+  void _forEachIntersecting(const Rectangle& rectangle, Callback&& callback)
+      const;
+
+  // The features, in the order of the leaves of the tree.
+  std::vector<Entry> _entries;
+
+  // The bounds of the nodes at each level of the tree. Level 0 holds the
+  // bounds of _entries, and node i of level L covers nodes
+  // [i * NodeSize, (i + 1) * NodeSize) of level L - 1. The last level has a
+  // single root node.
+  std::vector<std::vector<Rectangle>> _levels;
+};
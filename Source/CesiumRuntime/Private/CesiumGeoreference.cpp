@@ -1,6 +1,7 @@
 // Copyright 2020-2026 CesiumGS, Inc. and Contributors
 
 #include "CesiumGeoreference.h"
+#include "Async/ParallelFor.h"
 #include "Camera/PlayerCameraManager.h"
 #include "Cesium3DTileset.h"
 #include "CesiumActors.h"
@@ -322,6 +323,135 @@ FVector ACesiumGeoreference::TransformUnrealDirectionToEarthCenteredEarthFixed(
       VecMath::createVector3D(UnrealDirection)));
 }
 
+namespace {
+// The number of positions transformed by each task of a batch transform. A
+// batch no larger than this is transformed entirely on the calling thread.
+constexpr int32 PositionsPerTask = 4096;
+
+template <typename TransformFunction>
+void transformPositionsInPlace(
+    TArrayView<FVector> positions,
+    const TransformFunction& transform) {
+  const int32 taskCount =
+      FMath::DivideAndRoundUp(positions.Num(), PositionsPerTask);
+  ParallelFor(taskCount, [positions, &transform](int32 task) {
+    const int32 begin = task * PositionsPerTask;
+    const int32 end = FMath::Min(begin + PositionsPerTask, positions.Num());
+    for (int32 i = begin; i < end; ++i) {
+      positions[i] = VecMath::createVector(
+          transform(VecMath::createVector3D(positions[i])));
+    }
+  });
+}
+
+glm::dvec3
+transformPosition(const glm::dmat4& transform, const glm::dvec3& position) {
+  return glm::dvec3(transform * glm::dvec4(position, 1.0));
+}
+} // namespace
+
+TArray<FVector>
+ACesiumGeoreference::TransformLongitudeLatitudeHeightPositionsToUnreal(
+    const TArray<FVector>& LongitudeLatitudeHeights) const {
+  TArray<FVector> result = LongitudeLatitudeHeights;
+  this->TransformLongitudeLatitudeHeightPositionsToUnrealInPlace(result);
+  return result;
+}
+
+TArray<FVector>
+ACesiumGeoreference::TransformUnrealPositionsToLongitudeLatitudeHeight(
+    const TArray<FVector>& UnrealPositions) const {
+  TArray<FVector> result = UnrealPositions;
+  this->TransformUnrealPositionsToLongitudeLatitudeHeightInPlace(result);
+  return result;
+}
+
+TArray<FVector>
+ACesiumGeoreference::TransformEarthCenteredEarthFixedPositionsToUnreal(
+    const TArray<FVector>& EarthCenteredEarthFixedPositions) const {
+  TArray<FVector> result = EarthCenteredEarthFixedPositions;
+  this->TransformEarthCenteredEarthFixedPositionsToUnrealInPlace(result);
+  return result;
+}
+
+TArray<FVector>
+ACesiumGeoreference::TransformUnrealPositionsToEarthCenteredEarthFixed(
+    const TArray<FVector>& UnrealPositions) const {
+  TArray<FVector> result = UnrealPositions;
+  this->TransformUnrealPositionsToEarthCenteredEarthFixedInPlace(result);
+  return result;
+}
+
+void ACesiumGeoreference::
+    TransformLongitudeLatitudeHeightPositionsToUnrealInPlace(
+        TArrayView<FVector> Positions) const {
+  // Resolve the ellipsoid and matrix once, on this thread, rather than for
+  // every position.
+  const CesiumGeospatial::Ellipsoid ellipsoid =
+      this->GetEllipsoid()->GetNativeEllipsoid();
+  const glm::dmat4& ecefToUnreal =
+      this->_coordinateSystem.getEcefToLocalTransformation();
+
+  transformPositionsInPlace(
+      Positions,
+      [&ellipsoid, &ecefToUnreal](const glm::dvec3& llh) {
+        return transformPosition(
+            ecefToUnreal,
+            ellipsoid.cartographicToCartesian(
+                CesiumGeospatial::Cartographic::fromDegrees(
+                    llh.x,
+                    llh.y,
+                    llh.z)));
+      });
+}
+
+void ACesiumGeoreference::
+    TransformUnrealPositionsToLongitudeLatitudeHeightInPlace(
+        TArrayView<FVector> Positions) const {
+  const CesiumGeospatial::Ellipsoid ellipsoid =
+      this->GetEllipsoid()->GetNativeEllipsoid();
+  const glm::dmat4& unrealToEcef =
+      this->_coordinateSystem.getLocalToEcefTransformation();
+
+  transformPositionsInPlace(
+      Positions,
+      [&ellipsoid, &unrealToEcef](const glm::dvec3& unreal) {
+        std::optional<CesiumGeospatial::Cartographic> maybeCartographic =
+            ellipsoid.cartesianToCartographic(
+                transformPosition(unrealToEcef, unreal));
+        if (!maybeCartographic) {
+          return glm::dvec3(0.0);
+        }
+        return glm::dvec3(
+            CesiumUtility::Math::radiansToDegrees(
+                maybeCartographic->longitude),
+            CesiumUtility::Math::radiansToDegrees(maybeCartographic->latitude),
+            maybeCartographic->height);
+      });
+}
+
+void ACesiumGeoreference::
+    TransformEarthCenteredEarthFixedPositionsToUnrealInPlace(
+        TArrayView<FVector> Positions) const {
+  const glm::dmat4& ecefToUnreal =
+      this->_coordinateSystem.getEcefToLocalTransformation();
+  transformPositionsInPlace(Positions, [&ecefToUnreal](const glm::dvec3& ecef) {
+    return transformPosition(ecefToUnreal, ecef);
+  });
+}
+
+void ACesiumGeoreference::
+    TransformUnrealPositionsToEarthCenteredEarthFixedInPlace(
+        TArrayView<FVector> Positions) const {
+  const glm::dmat4& unrealToEcef =
+      this->_coordinateSystem.getLocalToEcefTransformation();
+  transformPositionsInPlace(
+      Positions,
+      [&unrealToEcef](const glm::dvec3& unreal) {
+        return transformPosition(unrealToEcef, unreal);
+      });
+}
+
 FRotator ACesiumGeoreference::TransformUnrealRotatorToEastSouthUp(
     const FRotator& UnrealRotator,
     const FVector& UnrealLocation) const {
@@ -5,6 +5,7 @@
 #include "CesiumCustomVersion.h"
 #include "CesiumGeometry/Transforms.h"
 #include "CesiumGeoreference.h"
+#include "CesiumHeightClampingSubsystem.h"
 #include "CesiumRuntime.h"
 #include "CollisionQueryParams.h"
 #include "Components/SceneComponent.h"
@@ -117,6 +118,7 @@ void UCesiumGlobeAnchorComponent::SetReferencedTileset(
     const TSoftObjectPtr<ACesium3DTileset>& NewTileset) {
   if (this->ReferencedTileset != NewTileset) {
     this->ReferencedTileset = NewTileset;
+    this->_resetTileGeometryHeightRequest();
     this->_setHeightFromTilesetReference();
   }
 }
@@ -130,6 +132,15 @@ int UCesiumGlobeAnchorComponent::GetHeightUpdateInterval() const {
   return this->HeightUpdateInterval;
 }
 
+bool UCesiumGlobeAnchorComponent::GetSampleHeightFromTileGeometry() const {
+  return this->SampleHeightFromTileGeometry;
+}
+
+void UCesiumGlobeAnchorComponent::SetSampleHeightFromTileGeometry(
+    bool NewValue) {
+  this->SampleHeightFromTileGeometry = NewValue;
+}
+
 ACesiumGeoreference*
 UCesiumGlobeAnchorComponent::GetResolvedGeoreference() const {
   return this->ResolvedGeoreference;
@@ -396,7 +407,21 @@ void UCesiumGlobeAnchorComponent::MoveToLongitudeLatitudeHeight(
   FVector realLongitudeLatitudeHeight = TargetLongitudeLatitudeHeight;
   FVector tilesetPosition{};
 
-  if (this->_isUsingTilesetHeightReference(HeightReferenceOverride) &&
+  const bool useTileGeometry =
+      this->SampleHeightFromTileGeometry &&
+      this->_isUsingTilesetHeightReference(HeightReferenceOverride);
+
+  if (useTileGeometry) {
+    // The height of the tileset at the target isn't known yet, so assume it is
+    // the same as below the actor's current position until it arrives.
+    const double tilesetHeight =
+        this->GetLongitudeLatitudeHeight(ECesiumHeightReference::Ellipsoid).Z -
+        this->_fixedHeightAboveHeightReference;
+    this->_fixedHeightAboveHeightReference = TargetLongitudeLatitudeHeight.Z;
+    realLongitudeLatitudeHeight.Z =
+        tilesetHeight + this->_fixedHeightAboveHeightReference;
+  } else if (
+      this->_isUsingTilesetHeightReference(HeightReferenceOverride) &&
       this->_queryLongitudeLatitudeHeightPositionOnTileset(
           tilesetPosition,
           TargetLongitudeLatitudeHeight)) {
@@ -409,6 +434,10 @@ void UCesiumGlobeAnchorComponent::MoveToLongitudeLatitudeHeight(
       this->GetEllipsoid()
           ->LongitudeLatitudeHeightToEllipsoidCenteredEllipsoidFixed(
               realLongitudeLatitudeHeight));
+
+  if (useTileGeometry) {
+    this->_requestHeightFromTileGeometry(false);
+  }
 }
 
 double UCesiumGlobeAnchorComponent::GetHeight(
@@ -615,6 +644,11 @@ void UCesiumGlobeAnchorComponent::PostEditChangeProperty(
     if (propertyName ==
         GET_MEMBER_NAME_CHECKED(UCesiumGlobeAnchorComponent, Georeference)) {
       this->SetGeoreference(this->Georeference);
+    } else if (
+        propertyName == GET_MEMBER_NAME_CHECKED(
+                            UCesiumGlobeAnchorComponent,
+                            ReferencedTileset)) {
+      this->_resetTileGeometryHeightRequest();
     }
   }
 
@@ -851,6 +885,12 @@ void UCesiumGlobeAnchorComponent::_updateFromNativeGlobeAnchor(
 }
 
 bool UCesiumGlobeAnchorComponent::_setHeightFromTilesetReference() {
+  if (this->SampleHeightFromTileGeometry &&
+      this->_isUsingTilesetHeightReference()) {
+    this->_requestHeightFromTileGeometry(true);
+    return false;
+  }
+
   FVector llh =
       this->GetLongitudeLatitudeHeight(ECesiumHeightReference::Ellipsoid);
   FVector groundPosition{};
@@ -864,6 +904,74 @@ bool UCesiumGlobeAnchorComponent::_setHeightFromTilesetReference() {
   }
 }
 
+void UCesiumGlobeAnchorComponent::_requestHeightFromTileGeometry(
+    bool updateFixedHeight) {
+  this->_tileGeometryHeightUpdatesFixedHeight |= updateFixedHeight;
+  if (this->_tileGeometryHeightPending) {
+    return;
+  }
+
+  UWorld* pWorld = this->GetWorld();
+  ACesium3DTileset* pTileset = this->ReferencedTileset.Get();
+  if (!pWorld || !IsValid(pTileset) || !IsValid(this->GetEllipsoid())) {
+    return;
+  }
+
+  UCesiumHeightClampingSubsystem* pSubsystem =
+      pWorld->GetSubsystem<UCesiumHeightClampingSubsystem>();
+  if (!pSubsystem) {
+    return;
+  }
+
+  this->_tileGeometryHeightPending = true;
+  pSubsystem->RequestHeight(
+      pTileset,
+      this->GetLongitudeLatitudeHeight(ECesiumHeightReference::Ellipsoid),
+      [pWeakThis = TWeakObjectPtr<UCesiumGlobeAnchorComponent>(this),
+       pWeakTileset = TWeakObjectPtr<ACesium3DTileset>(pTileset)](
+          bool success,
+          double tilesetHeight) {
+        UCesiumGlobeAnchorComponent* pThis = pWeakThis.Get();
+        if (!pThis) {
+          return;
+        }
+
+        // A result for a tileset that is no longer the referenced one is
+        // stale. The pending state was reset when the tileset changed, and
+        // may now belong to a request against the new tileset.
+        if (pWeakTileset.Get() != pThis->ReferencedTileset.Get()) {
+          return;
+        }
+
+        const bool updateFixedHeight =
+            pThis->_tileGeometryHeightUpdatesFixedHeight;
+        pThis->_tileGeometryHeightPending = false;
+        pThis->_tileGeometryHeightUpdatesFixedHeight = false;
+
+        if (!success || !pThis->_isUsingTilesetHeightReference() ||
+            !IsValid(pThis->GetEllipsoid())) {
+          return;
+        }
+
+        FVector llh = pThis->GetLongitudeLatitudeHeight(
+            ECesiumHeightReference::Ellipsoid);
+        if (updateFixedHeight) {
+          pThis->_fixedHeightAboveHeightReference = llh.Z - tilesetHeight;
+        } else {
+          llh.Z = tilesetHeight + pThis->_fixedHeightAboveHeightReference;
+          pThis->MoveToEarthCenteredEarthFixedPosition(
+              pThis->GetEllipsoid()
+                  ->LongitudeLatitudeHeightToEllipsoidCenteredEllipsoidFixed(
+                      llh));
+        }
+      });
+}
+
+void UCesiumGlobeAnchorComponent::_resetTileGeometryHeightRequest() {
+  this->_tileGeometryHeightPending = false;
+  this->_tileGeometryHeightUpdatesFixedHeight = false;
+}
+
 bool UCesiumGlobeAnchorComponent::_isUsingTilesetHeightReference(
     const ECesiumHeightReference heightReferenceOverride) const {
   ECesiumHeightReference trueReference =
@@ -1012,6 +1120,11 @@ void UCesiumGlobeAnchorComponent::TickComponent(
   }
   this->_heightReferenceUpdateCounter = this->HeightUpdateInterval;
 
+  if (this->SampleHeightFromTileGeometry) {
+    this->_requestHeightFromTileGeometry(false);
+    return;
+  }
+
   FVector llh = this->GetLongitudeLatitudeHeight();
   // This seems pointless, but it causes the actor's position to be reset
   // based on the _fixedHeightAboveTileset value.
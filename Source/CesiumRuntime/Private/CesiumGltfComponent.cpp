@@ -3,6 +3,7 @@
 #include "CesiumGltfComponent.h"
 
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Cesium3DTilesetLifecycleEventReceiver.h"
 #include "CesiumCommon.h"
 #include "CesiumEncodedMetadataUtility.h"
@@ -15,9 +16,11 @@
 #include "CesiumGltfPrimitiveEdges.h"
 #include "CesiumGltfTextures.h"
 #include "CesiumGltfVoxelComponent.h"
+#include "CesiumMaterialInstancePool.h"
 #include "CesiumMaterialUserData.h"
 #include "CesiumRasterOverlays.h"
 #include "CesiumRuntime.h"
+#include "CesiumRuntimeSettings.h"
 #include "CesiumTextureUtility.h"
 #include "CesiumTransforms.h"
 #include "Chaos/AABBTree.h"
@@ -680,6 +683,169 @@ static void computeTangentSpace(FStaticMeshVertexBuffers& vertices) {
   genTangSpaceDefault(&MikkTContext);
 }
 
+namespace {
+/**
+ * The user data for running MikkTSpace over an indexed mesh. MikkTSpace still
+ * produces a tangent for every corner of every triangle, but rather than
+ * writing each one to its own vertex, the corners are accumulated onto the
+ * shared vertex they reference.
+ */
+struct IndexedTangentSpaceContext {
+  FStaticMeshVertexBuffers* pVertices;
+  const TArray<uint32>* pIndices;
+  TArray<FVector3f> tangentSums;
+  TArray<float> bitangentSignSums;
+
+  uint32 getVertexIndex(int FaceIdx, int VertIdx) const {
+    return (*this->pIndices)[FaceIdx * 3 + VertIdx];
+  }
+};
+
+const IndexedTangentSpaceContext&
+getIndexedContext(const SMikkTSpaceContext* Context) {
+  return *reinterpret_cast<const IndexedTangentSpaceContext*>(
+      Context->m_pUserData);
+}
+} // namespace
+
+static int mikkGetNumFacesIndexed(const SMikkTSpaceContext* Context) {
+  return getIndexedContext(Context).pIndices->Num() / 3;
+}
+
+static int mikkGetNumVertsOfFaceIndexed(
+    const SMikkTSpaceContext* Context,
+    const int FaceIdx) {
+  return FaceIdx < mikkGetNumFacesIndexed(Context) ? 3 : 0;
+}
+
+static void mikkGetPositionIndexed(
+    const SMikkTSpaceContext* Context,
+    float Position[3],
+    const int FaceIdx,
+    const int VertIdx) {
+  const IndexedTangentSpaceContext& context = getIndexedContext(Context);
+  const FVector3f& position =
+      context.pVertices->PositionVertexBuffer.VertexPosition(
+          context.getVertexIndex(FaceIdx, VertIdx));
+  Position[0] = position.X;
+  Position[1] = -position.Y;
+  Position[2] = position.Z;
+}
+
+static void mikkGetNormalIndexed(
+    const SMikkTSpaceContext* Context,
+    float Normal[3],
+    const int FaceIdx,
+    const int VertIdx) {
+  const IndexedTangentSpaceContext& context = getIndexedContext(Context);
+  FVector3f normal = context.pVertices->StaticMeshVertexBuffer.VertexTangentZ(
+      context.getVertexIndex(FaceIdx, VertIdx));
+  Normal[0] = normal.X;
+  Normal[1] = -normal.Y;
+  Normal[2] = normal.Z;
+}
+
+static void mikkGetTexCoordIndexed(
+    const SMikkTSpaceContext* Context,
+    float UV[2],
+    const int FaceIdx,
+    const int VertIdx) {
+  const IndexedTangentSpaceContext& context = getIndexedContext(Context);
+  FVector2f uv = context.pVertices->StaticMeshVertexBuffer.GetVertexUV(
+      context.getVertexIndex(FaceIdx, VertIdx),
+      0);
+  UV[0] = uv.X;
+  UV[1] = uv.Y;
+}
+
+static void mikkSetTSpaceBasicIndexed(
+    const SMikkTSpaceContext* Context,
+    const float Tangent[3],
+    const float BitangentSign,
+    const int FaceIdx,
+    const int VertIdx) {
+  IndexedTangentSpaceContext& context =
+      *reinterpret_cast<IndexedTangentSpaceContext*>(Context->m_pUserData);
+  uint32 vertexIndex = context.getVertexIndex(FaceIdx, VertIdx);
+
+  // Accumulate in MikkTSpace's (Y-flipped) space; the result is converted back
+  // once every corner has been visited.
+  context.tangentSums[vertexIndex] +=
+      FVector3f(Tangent[0], Tangent[1], Tangent[2]);
+  context.bitangentSignSums[vertexIndex] += BitangentSign;
+}
+
+/**
+ * Determines whether every index refers to one of the vertices in the mesh,
+ * which {@link computeTangentSpaceIndexed} requires.
+ */
+static bool areIndicesInRange(const TArray<uint32>& indices, uint32 count) {
+  for (uint32 index : indices) {
+    if (index >= count) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Computes the tangent space of an indexed mesh without duplicating its
+ * vertices. The tangents MikkTSpace generates for each triangle corner are
+ * averaged over the corners that share a vertex, then re-orthogonalized
+ * against that vertex's normal. Every index must be less than the number of
+ * vertices; see {@link areIndicesInRange}.
+ */
+static void computeTangentSpaceIndexed(
+    FStaticMeshVertexBuffers& vertices,
+    const TArray<uint32>& indices) {
+  const int32 numVertices =
+      int32(vertices.PositionVertexBuffer.GetNumVertices());
+
+  IndexedTangentSpaceContext context{&vertices, &indices};
+  context.tangentSums.SetNumZeroed(numVertices);
+  context.bitangentSignSums.SetNumZeroed(numVertices);
+
+  SMikkTSpaceInterface MikkTInterface{};
+  MikkTInterface.m_getNormal = mikkGetNormalIndexed;
+  MikkTInterface.m_getNumFaces = mikkGetNumFacesIndexed;
+  MikkTInterface.m_getNumVerticesOfFace = mikkGetNumVertsOfFaceIndexed;
+  MikkTInterface.m_getPosition = mikkGetPositionIndexed;
+  MikkTInterface.m_getTexCoord = mikkGetTexCoordIndexed;
+  MikkTInterface.m_setTSpaceBasic = mikkSetTSpaceBasicIndexed;
+  MikkTInterface.m_setTSpace = nullptr;
+
+  SMikkTSpaceContext MikkTContext{};
+  MikkTContext.m_pInterface = &MikkTInterface;
+  MikkTContext.m_pUserData = (void*)(&context);
+  genTangSpaceDefault(&MikkTContext);
+
+  FStaticMeshVertexBuffer& vertexBuffer = vertices.StaticMeshVertexBuffer;
+  for (int32 i = 0; i < numVertices; ++i) {
+    FVector3f TangentZ = vertexBuffer.VertexTangentZ(i);
+    TangentZ.Y = -TangentZ.Y;
+
+    // Gram-Schmidt against the normal, since the average of several unit
+    // tangents is neither unit length nor, in general, perpendicular to it.
+    FVector3f TangentX = context.tangentSums[i];
+    TangentX -= FVector3f::DotProduct(TangentZ, TangentX) * TangentZ;
+    if (!TangentX.Normalize()) {
+      // Vertices not referenced by any triangle, or whose corners' tangents
+      // cancel out, get an arbitrary basis around the normal.
+      FVector3f TangentYUnused;
+      TangentZ.FindBestAxisVectors(TangentX, TangentYUnused);
+    }
+
+    const float sign = context.bitangentSignSums[i] < 0.0f ? -1.0f : 1.0f;
+    FVector3f TangentY = sign * FVector3f::CrossProduct(TangentZ, TangentX);
+
+    TangentX.Y = -TangentX.Y;
+    TangentY.Y = -TangentY.Y;
+    TangentZ.Y = -TangentZ.Y;
+
+    vertexBuffer.SetVertexTangents(i, TangentX, TangentY, TangentZ);
+  }
+}
+
 static void setUnlitNormals(
     FStaticMeshVertexBuffers& vertices,
     const CesiumGeospatial::Ellipsoid& ellipsoid,
@@ -1281,6 +1447,223 @@ std::string getPrimitiveName(
   }
   return name;
 }
+
+// Primitives with at least this many vertices have their vertex attributes
+// converted in parallel batches. Below this, the overhead of dispatching the
+// batches outweighs the benefit.
+constexpr uint32 ParallelVertexConversionThreshold = 65536;
+constexpr uint32 VerticesPerConversionBatch = 16384;
+
+/**
+ * @brief Gets a pointer to the first element of an accessor if its elements
+ * are tightly packed, so that they can be read in a simple loop rather than
+ * through the bounds-checked `AccessorView::operator[]`. Returns `nullptr` if
+ * the elements are interleaved with other data.
+ */
+template <typename T>
+const T* getTightlyPackedElements(const CesiumGltf::AccessorView<T>& view) {
+  if (view.status() != CesiumGltf::AccessorViewStatus::Valid ||
+      view.stride() != int64_t(sizeof(T))) {
+    return nullptr;
+  }
+  return reinterpret_cast<const T*>(view.data() + view.offset());
+}
+
+/**
+ * @brief Invokes `f(begin, end)` over contiguous batches covering
+ * `[0, count)`. Large ranges are split across worker threads, so `f` must be
+ * safe to call concurrently for disjoint ranges.
+ */
+template <typename TFunction>
+void forEachVertexBatch(uint32 count, TFunction&& f) {
+  if (count < ParallelVertexConversionThreshold) {
+    f(uint32(0), count);
+    return;
+  }
+
+  const int32 batchCount = int32(
+      (count + VerticesPerConversionBatch - 1) / VerticesPerConversionBatch);
+  ParallelFor(batchCount, [count, &f](int32 batch) {
+    const uint32 begin = uint32(batch) * VerticesPerConversionBatch;
+    f(begin, FMath::Min(begin + VerticesPerConversionBatch, count));
+  });
+}
+
+/**
+ * @brief Copies glTF positions into an Unreal position buffer, scaling them
+ * and flipping the Y axis as {@link scalePositionForUnreal} does. If
+ * `pIndices` is not `nullptr`, vertex `i` of the output is taken from vertex
+ * `(*pIndices)[i]` of the input.
+ */
+void copyPositions(
+    const CesiumGltf::AccessorView<FVector3f>& positionView,
+    const TArray<uint32>* pIndices,
+    FPositionVertexBuffer& positionBuffer) {
+  const uint32 numVertices = positionBuffer.GetNumVertices();
+  if (numVertices == 0) {
+    return;
+  }
+
+  const FVector3f* pSource = getTightlyPackedElements(positionView);
+  const int64_t sourceCount = positionView.size();
+  FVector3f* pTarget = &positionBuffer.VertexPosition(0);
+
+  const float scale = float(CesiumPrimitiveData::positionScaleFactor);
+
+  forEachVertexBatch(numVertices, [&](uint32 begin, uint32 end) {
+    if (pSource && !pIndices) {
+      // The common case: a straight, vectorizable copy with scale and flip.
+      for (uint32 i = begin; i < end; ++i) {
+        const FVector3f& position = pSource[i];
+        pTarget[i] = FVector3f(
+            position.X * scale,
+            -position.Y * scale,
+            position.Z * scale);
+      }
+      return;
+    }
+
+    for (uint32 i = begin; i < end; ++i) {
+      const int64_t sourceIndex = pIndices ? int64_t((*pIndices)[i]) : i;
+      if (sourceIndex >= sourceCount) {
+        pTarget[i] = FVector3f::ZeroVector;
+        continue;
+      }
+
+      const FVector3f& position =
+          pSource ? pSource[sourceIndex] : positionView[sourceIndex];
+      pTarget[i] = FVector3f(
+          position.X * scale,
+          -position.Y * scale,
+          position.Z * scale);
+    }
+  });
+}
+
+/**
+ * @brief Computes the radius of a sphere centered at `origin` that encloses
+ * every position in the buffer.
+ */
+double computeBoundingSphereRadius(
+    const FPositionVertexBuffer& positionBuffer,
+    const FVector& origin) {
+  const uint32 numVertices = positionBuffer.GetNumVertices();
+  if (numVertices == 0) {
+    return 0.0;
+  }
+
+  const FVector3f* pPositions = &positionBuffer.VertexPosition(0);
+
+  // Each batch finds its own maximum squared distance, so that the square root
+  // is only taken once at the end.
+  const uint32 batchCount =
+      (numVertices + VerticesPerConversionBatch - 1) /
+      VerticesPerConversionBatch;
+  TArray<double> batchMaximums;
+  batchMaximums.SetNumZeroed(int32(batchCount));
+
+  forEachVertexBatch(numVertices, [&](uint32 begin, uint32 end) {
+    double maximum = 0.0;
+    for (uint32 i = begin; i < end; ++i) {
+      const double dx = double(pPositions[i].X) - origin.X;
+      const double dy = double(pPositions[i].Y) - origin.Y;
+      const double dz = double(pPositions[i].Z) - origin.Z;
+      maximum = FMath::Max(maximum, dx * dx + dy * dy + dz * dz);
+    }
+    batchMaximums[int32(begin / VerticesPerConversionBatch)] = maximum;
+  });
+
+  double maximum = 0.0;
+  for (double batchMaximum : batchMaximums) {
+    maximum = FMath::Max(maximum, batchMaximum);
+  }
+  return FMath::Sqrt(maximum);
+}
+
+/**
+ * @brief Copies glTF normals into the TangentZ of an Unreal vertex buffer,
+ * flipping the Y axis. If `pIndices` is not `nullptr`, vertex `i` of the
+ * output is taken from vertex `(*pIndices)[i]` of the input.
+ */
+void copyNormals(
+    const CesiumGltf::AccessorView<FVector3f>& normalView,
+    const TArray<uint32>* pIndices,
+    FStaticMeshVertexBuffer& vertexBuffer) {
+  const FVector3f* pSource = getTightlyPackedElements(normalView);
+  const int64_t sourceCount = normalView.size();
+
+  forEachVertexBatch(
+      vertexBuffer.GetNumVertices(),
+      [&](uint32 begin, uint32 end) {
+        for (uint32 i = begin; i < end; ++i) {
+          const int64_t sourceIndex = pIndices ? int64_t((*pIndices)[i]) : i;
+          FVector3f normal(0.0f, 0.0f, 0.0f);
+          if (sourceIndex < sourceCount) {
+            normal = pSource ? pSource[sourceIndex] : normalView[sourceIndex];
+          }
+
+          vertexBuffer.SetVertexTangents(
+              i,
+              FVector3f(0.0f, 0.0f, 0.0f),
+              FVector3f(0.0f, 0.0f, 0.0f),
+              FVector3f(normal.X, -normal.Y, normal.Z));
+        }
+      });
+}
+
+/**
+ * @brief Copies glTF tangents into the TangentX and TangentY of an Unreal
+ * vertex buffer whose normals have already been populated, flipping the Y
+ * axis. If `pIndices` is not `nullptr`, vertex `i` of the output is taken from
+ * vertex `(*pIndices)[i]` of the input.
+ */
+void copyTangents(
+    const CesiumGltf::AccessorView<FVector4f>& tangentView,
+    const TArray<uint32>* pIndices,
+    FStaticMeshVertexBuffer& vertexBuffer) {
+  const FVector4f* pSource = getTightlyPackedElements(tangentView);
+  const int64_t sourceCount = tangentView.size();
+
+  forEachVertexBatch(
+      vertexBuffer.GetNumVertices(),
+      [&](uint32 begin, uint32 end) {
+        for (uint32 i = begin; i < end; ++i) {
+          const int64_t sourceIndex = pIndices ? int64_t((*pIndices)[i]) : i;
+          if (sourceIndex >= sourceCount) {
+            continue;
+          }
+
+          const FVector4f& tangent =
+              pSource ? pSource[sourceIndex] : tangentView[sourceIndex];
+          FVector3f tangentZ = vertexBuffer.VertexTangentZ(i);
+          FVector3f tangentX = FVector3f(tangent.X, -tangent.Y, tangent.Z);
+          FVector3f tangentY =
+              FVector3f::CrossProduct(tangentZ, tangentX) * tangent.W;
+          vertexBuffer.SetVertexTangents(i, tangentX, tangentY, tangentZ);
+        }
+      });
+}
+
+/**
+ * @brief Copies the indices of a primitive into an Unreal index array.
+ */
+template <typename TIndexAccessor>
+void copyIndices(const TIndexAccessor& indicesView, TArray<uint32>& indices) {
+  indices.SetNum(static_cast<TArray<uint32>::SizeType>(indicesView.size()));
+
+  if constexpr (IsAccessorView<TIndexAccessor>::value) {
+    if (const auto* pSource = getTightlyPackedElements(indicesView)) {
+      for (int32 i = 0; i < indices.Num(); ++i) {
+        indices[i] = uint32(pSource[i]);
+      }
+      return;
+    }
+  }
+
+  for (int32 i = 0; i < indices.Num(); ++i) {
+    indices[i] = indicesView[i];
+  }
+}
 } // namespace
 
 template <class TIndexAccessor>
@@ -1470,21 +1853,29 @@ static void loadPrimitive(
   {
     TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyIndices)
 
-    indices.SetNum(static_cast<TArray<uint32>::SizeType>(indicesView.size()));
-    for (int32 i = 0; i < indicesView.size(); ++i) {
-      indices[i] = indicesView[i];
-    }
+    copyIndices(indicesView, indices);
   }
 
   // If we don't have normals, the gltf spec prescribes that the client
   // implementation must generate flat normals, which requires duplicating
   // vertices shared by multiple triangles. If we don't have tangents, but
   // need them, we need to use a tangent space generation algorithm which
-  // requires duplicated vertices.
+  // requires duplicated vertices, unless the tangents may be averaged onto
+  // the shared vertices instead.
   bool normalsAreRequired = !primitiveResult.isUnlit && isTriangles;
   bool needToGenerateFlatNormals = normalsAreRequired && !hasNormals;
   bool needToGenerateTangents = needsTangents && !hasTangents;
-  bool duplicateVertices = needToGenerateFlatNormals || needToGenerateTangents;
+  // Out-of-range indices in a malformed model can't be used to average
+  // tangents onto the shared vertices. The duplicated vertex path tolerates
+  // them, so fall back to it.
+  bool generateTangentsOnSharedVertices =
+      needToGenerateTangents && isTriangles && !needToGenerateFlatNormals &&
+      options.pMeshOptions->pNodeOptions->pModelOptions
+          ->shareVerticesForGeneratedTangents &&
+      areIndicesInRange(indices, uint32(positionView.size()));
+  bool duplicateVertices =
+      needToGenerateFlatNormals ||
+      (needToGenerateTangents && !generateTangentsOnSharedVertices);
 
   uint32 numVertices =
       duplicateVertices ? uint32(indices.Num()) : uint32(positionView.size());
@@ -1496,29 +1887,18 @@ static void loadPrimitive(
   {
     // Note: scaling from glTF vertices to Unreal's must match
     // UCesiumGltfComponent::GetGltfToUnrealLocalVertexPositionScaleFactor
-    if (duplicateVertices) {
-      TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyDuplicatedPositions)
-      for (uint32 i = 0; i < numVertices; ++i) {
-        uint32 vertexIndex = indices[i];
-        const FVector3f& value =
-            scalePositionForUnreal(positionView[vertexIndex]);
-        FVector3f& position = positionBuffer.VertexPosition(i);
-        position = value;
-        pRenderData->Bounds.SphereRadius = FMath::Max(
-            (FVector(position) - pRenderData->Bounds.Origin).Size(),
-            pRenderData->Bounds.SphereRadius);
-      }
-    } else {
-      TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyPositions)
-      for (uint32 i = 0; i < numVertices; ++i) {
-        const FVector3f& value = scalePositionForUnreal(positionView[i]);
-        FVector3f& position = positionBuffer.VertexPosition(i);
-        position = value;
-        pRenderData->Bounds.SphereRadius = FMath::Max(
-            (FVector(position) - pRenderData->Bounds.Origin).Size(),
-            pRenderData->Bounds.SphereRadius);
-      }
-    }
+    TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyPositions)
+    copyPositions(
+        positionView,
+        duplicateVertices ? &indices : nullptr,
+        positionBuffer);
+  }
+
+  {
+    TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::ComputeBoundingSphere)
+    pRenderData->Bounds.SphereRadius = computeBoundingSphereRadius(
+        positionBuffer,
+        pRenderData->Bounds.Origin);
   }
 
   auto colorAccessorIt = primitive.attributes.find(
@@ -1582,10 +1962,15 @@ static void loadPrimitive(
 
   FStaticMeshVertexBuffer& vertexBuffer =
       LODResources.VertexBuffers.StaticMeshVertexBuffer;
-  // Set to full precision (32-bit) UVs. This is especially important for
-  // metadata because integer feature IDs can and will lose meaningful
-  // precision when using 16-bit floats.
-  vertexBuffer.SetUseFullPrecisionUVs(true);
+  // Use full precision (32-bit) UVs unless the tileset has opted into compact
+  // texture coordinates. Even then, full precision is required for metadata
+  // because integer feature IDs and vertex indices can and will lose
+  // meaningful precision when using 16-bit floats.
+  bool useFullPrecisionUVs =
+      !modelOptions.useCompactTextureCoordinates ||
+      !primitiveResult.accessorToFeatureIdIndexMap.empty() ||
+      texCoordMap.contains(-1);
+  vertexBuffer.SetUseFullPrecisionUVs(useFullPrecisionUVs);
   vertexBuffer.Init(numVertices, numberOfTextureCoordinates, false);
 
   {
@@ -1618,30 +2003,11 @@ static void loadPrimitive(
   // TangentZ: Normal
 
   if (hasNormals) {
-    if (duplicateVertices) {
-      TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyNormalsForDuplicatedVertices)
-      for (int i = 0; i < indices.Num(); ++i) {
-        uint32 vertexIndex = indices[i];
-        const FVector3f& normal = normalAccessor[vertexIndex];
-
-        vertexBuffer.SetVertexTangents(
-            i,
-            FVector3f(0.0f, 0.0f, 0.0f),
-            FVector3f(0.0f, 0.0f, 0.0f),
-            FVector3f(normal.X, -normal.Y, normal.Z));
-      }
-    } else {
-      TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyNormals)
-      for (uint32 i = 0; i < numVertices; ++i) {
-        const FVector3f& normal = normalAccessor[i];
-
-        vertexBuffer.SetVertexTangents(
-            i,
-            FVector3f(0.0f, 0.0f, 0.0f),
-            FVector3f(0.0f, 0.0f, 0.0f),
-            FVector3f(normal.X, -normal.Y, normal.Z));
-      }
-    }
+    TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyNormals)
+    copyNormals(
+        normalAccessor,
+        duplicateVertices ? &indices : nullptr,
+        vertexBuffer);
   } else if (primitiveResult.isUnlit || !isTriangles) {
     setUnlitNormals(
         LODResources.VertexBuffers,
@@ -1653,35 +2019,22 @@ static void loadPrimitive(
   }
 
   if (hasTangents) {
-    if (duplicateVertices) {
-      TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyTangentsForDuplicatedVertices)
-      for (int i = 0; i < indices.Num(); ++i) {
-        uint32 vertexIndex = indices[i];
-        const FVector4f& tangent = tangentAccessor[vertexIndex];
-        FVector3f tangentZ = vertexBuffer.VertexTangentZ(i);
-        FVector3f tangentX = FVector3f(tangent.X, -tangent.Y, tangent.Z);
-        FVector3f tangentY =
-            FVector3f::CrossProduct(tangentZ, tangentX) * tangent.W;
-        vertexBuffer.SetVertexTangents(i, tangentX, tangentY, tangentZ);
-      }
-    } else {
-      TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyTangents)
-      for (uint32 i = 0; i < numVertices; ++i) {
-        const FVector4f& tangent = tangentAccessor[i];
-        FVector3f tangentZ = vertexBuffer.VertexTangentZ(i);
-        FVector3f tangentX = FVector3f(tangent.X, -tangent.Y, tangent.Z);
-        FVector3f tangentY =
-            FVector3f::CrossProduct(tangentZ, tangentX) * tangent.W;
-        vertexBuffer.SetVertexTangents(i, tangentX, tangentY, tangentZ);
-      }
-    }
+    TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyTangents)
+    copyTangents(
+        tangentAccessor,
+        duplicateVertices ? &indices : nullptr,
+        vertexBuffer);
   }
 
   if (needsTangents && !hasTangents) {
     // Use mikktspace to calculate the tangents.
     // Note that this assumes normals and UVs are already populated.
     TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::ComputeTangents)
-    computeTangentSpace(LODResources.VertexBuffers);
+    if (generateTangentsOnSharedVertices) {
+      computeTangentSpaceIndexed(LODResources.VertexBuffers, indices);
+    } else {
+      computeTangentSpace(LODResources.VertexBuffers);
+    }
   }
 
   FStaticMeshSectionArray& Sections = LODResources.Sections;
@@ -1865,6 +2218,58 @@ bool paddingIsConsideredEqual(
 }
 } // namespace
 
+/**
+ * Determines whether a voxel tile has nothing to render: every voxel has no
+ * value for every property. Such tiles can be skipped entirely when ray
+ * marching, and don't need to be uploaded to the GPU.
+ */
+static bool
+isVoxelTileEmpty(const FCesiumPropertyAttribute& propertyAttribute) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::isVoxelTileEmpty)
+  bool hasValidProperty = false;
+
+  for (const auto& propertyIt :
+       UCesiumPropertyAttributeBlueprintLibrary::GetProperties(
+           propertyAttribute)) {
+    const FCesiumPropertyAttributeProperty& property = propertyIt.Value;
+    const ECesiumPropertyAttributePropertyStatus status =
+        UCesiumPropertyAttributePropertyBlueprintLibrary::
+            GetPropertyAttributePropertyStatus(property);
+    if (status == ECesiumPropertyAttributePropertyStatus::
+                      EmptyPropertyWithDefault) {
+      // Every voxel has the default value.
+      return false;
+    }
+    if (status != ECesiumPropertyAttributePropertyStatus::Valid) {
+      continue;
+    }
+
+    // Without a "no data" value, every voxel has a value.
+    FCesiumMetadataValue noData =
+        UCesiumPropertyAttributePropertyBlueprintLibrary::GetNoDataValue(
+            property);
+    if (UCesiumMetadataValueBlueprintLibrary::IsEmpty(noData)) {
+      return false;
+    }
+
+    hasValidProperty = true;
+    const int64 size =
+        UCesiumPropertyAttributePropertyBlueprintLibrary::GetPropertySize(
+            property);
+    for (int64 i = 0; i < size; i++) {
+      FCesiumMetadataValue value =
+          UCesiumPropertyAttributePropertyBlueprintLibrary::GetValue(
+              property,
+              i);
+      if (!UCesiumMetadataValueBlueprintLibrary::IsEmpty(value)) {
+        return false;
+      }
+    }
+  }
+
+  return hasValidProperty;
+}
+
 static void loadVoxels(
     LoadedPrimitiveResult& primitiveResult,
     const CesiumGltf::MeshPrimitive& primitive,
@@ -1956,6 +2361,8 @@ static void loadVoxels(
     // tileset.
     if (propertyAttributes[i].getClassName() == classAsFString) {
       primitiveResult.voxelPropertyAttributeIndex = i;
+      primitiveResult.isVoxelTileEmpty =
+          isVoxelTileEmpty(propertyAttributes[i]);
       break;
     }
   }
@@ -1989,7 +2396,10 @@ static void loadGaussianSplats(
   primitiveResult.transform =
       transform * yInvertMatrix * CesiumPrimitiveData::positionScaleMatrix;
   primitiveResult.pGaussianSplatData =
-      MakeUnique<FCesiumGltfGaussianSplatData>(model, primitive);
+      MakeUnique<FCesiumGltfGaussianSplatData>(
+          model,
+          primitive,
+          GetDefault<UCesiumRuntimeSettings>()->UseCompactGaussianSplats);
 }
 
 static void loadPrimitive(
@@ -3212,7 +3622,8 @@ UMaterialInstanceDynamic* createPrimitiveMaterialInstance(
     UCesiumGltfComponent* pGltf,
     ICesiumPrimitive* pCesiumPrimitive,
     const TMap<FString, FCesiumMetadataValue>& metadataStatistics,
-    ICesium3DTilesetLifecycleEventReceiver* pLifecycleEventReceiver) {
+    ICesium3DTilesetLifecycleEventReceiver* pLifecycleEventReceiver,
+    UCesiumMaterialInstancePool* pMaterialPool) {
   TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::SetupMaterial)
   const CesiumGltf::Material& material =
       model.getSafe(model.materials, loadResult.materialIndex);
@@ -3252,12 +3663,19 @@ UMaterialInstanceDynamic* createPrimitiveMaterialInstance(
     // May have changed, but we don't need it from now on:
     pUserDesignatedMaterialAsDynamic = nullptr;
   } else {
-    // Same as ICesium3DTilesetLifecycleEventReceiver::CreateMaterial's
-    // default implementation
-    pMaterial = UMaterialInstanceDynamic::Create(
-        pBaseMaterial,
-        nullptr,
-        ImportedSlotName);
+    // Reuse the material instance of an unloaded tile if there is one.
+    // Otherwise, do the same as
+    // ICesium3DTilesetLifecycleEventReceiver::CreateMaterial's default
+    // implementation.
+    if (pMaterialPool) {
+      pMaterial = pMaterialPool->acquire(pBaseMaterial);
+    }
+    if (!pMaterial) {
+      pMaterial = UMaterialInstanceDynamic::Create(
+          pBaseMaterial,
+          nullptr,
+          ImportedSlotName);
+    }
   }
 
   pMaterial->SetFlags(
@@ -3720,6 +4138,11 @@ static void loadPrimitiveGameThreadPart(
   ICesium3DTilesetLifecycleEventReceiver* pLifecycleEventReceiver =
       pTilesetActor->GetLifecycleEventReceiver();
 
+  UCesiumMaterialInstancePool* pMaterialPool =
+      pGltf->UsesMaterialInstancePool
+          ? pTilesetActor->GetMaterialInstancePool()
+          : nullptr;
+
   UMaterialInstanceDynamic* pMaterialForGltfPrimitive =
       createPrimitiveMaterialInstance(
           loadResult,
@@ -3727,7 +4150,8 @@ static void loadPrimitiveGameThreadPart(
           pGltf,
           pCesiumPrimitive,
           metadataStatistics,
-          pLifecycleEventReceiver);
+          pLifecycleEventReceiver,
+          pMaterialPool);
 
   pStaticMesh->AddMaterial(pMaterialForGltfPrimitive);
   pStaticMesh->SetLightingGuid();
@@ -3794,12 +4218,17 @@ static void loadPrimitiveGameThreadPart(
 
     {
       TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::SetupMaterial)
-      const FName ImportedSlotName = createNewMaterialName();
       UMaterialInstanceDynamic* pEdgeMaterial =
-          UMaterialInstanceDynamic::Create(
-              pGltf->BaseMaterialPrimitiveEdges,
-              nullptr,
-              ImportedSlotName);
+          pMaterialPool
+              ? pMaterialPool->acquire(pGltf->BaseMaterialPrimitiveEdges)
+              : nullptr;
+      if (!pEdgeMaterial) {
+        const FName ImportedSlotName = createNewMaterialName();
+        pEdgeMaterial = UMaterialInstanceDynamic::Create(
+            pGltf->BaseMaterialPrimitiveEdges,
+            nullptr,
+            ImportedSlotName);
+      }
       pStaticMesh->AddMaterial(pEdgeMaterial);
       pStaticMesh->SetLightingGuid();
     }
@@ -3857,6 +4286,7 @@ static void loadVoxelsGameThreadPart(
 
   pVoxel->TileId = *tileId;
   pVoxel->PropertyAttribute = std::move(attributes[index]);
+  pVoxel->IsEmpty = loadResult.isVoxelTileEmpty;
 
   attachAndRegisterComponent(pGltf, pVoxel);
 }
@@ -3912,6 +4342,12 @@ UCesiumGltfComponent::CreateOffGameThread(
       Ellipsoid);
 }
 
+/*static*/ const LoadedModelResult& UCesiumGltfComponent::GetLoadedModelResult(
+    const HalfConstructed& halfConstructed) {
+  return static_cast<const HalfConstructedReal&>(halfConstructed)
+      .loadModelResult;
+}
+
 /*static*/ UCesiumGltfComponent* UCesiumGltfComponent::CreateOnGameThread(
     CesiumGltf::Model& model,
     ACesium3DTileset* pTilesetActor,
@@ -3947,6 +4383,13 @@ UCesiumGltfComponent::CreateOffGameThread(
   }
 
   pGltf->CustomDepthParameters = pTilesetActor->GetCustomDepthParameters();
+
+  // Material instances created by a lifecycle event receiver belong to it, so
+  // they are never pooled.
+  pGltf->UsesMaterialInstancePool =
+      !pTilesetActor->GetLifecycleEventReceiver() &&
+      pTilesetActor->GetMaterialInstancePool() != nullptr;
+
   encodeModelMetadataGameThreadPart(pGltf->EncodedMetadata);
 
   if (pGltf->EncodedMetadata_DEPRECATED) {
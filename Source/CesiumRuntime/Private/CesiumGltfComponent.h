@@ -28,6 +28,10 @@ namespace CreateGltfOptions {
 struct CreateModelOptions;
 }
 
+namespace LoadGltfResult {
+struct LoadedModelResult;
+}
+
 namespace CesiumGltf {
 struct Model;
 }
@@ -87,6 +91,13 @@ public:
       TUniquePtr<HalfConstructed> pHalfConstructed,
       const Cesium3DTilesSelection::Tile& tile);
 
+  /**
+   * Gets the meshes and other data loaded by {@link CreateOffGameThread},
+   * from which {@link CreateOnGameThread} creates the component.
+   */
+  static const LoadGltfResult::LoadedModelResult&
+  GetLoadedModelResult(const HalfConstructed& halfConstructed);
+
   UCesiumGltfComponent();
 
   UPROPERTY(EditAnywhere, Category = "Cesium")
@@ -106,6 +117,14 @@ public:
 
   const Cesium3DTilesSelection::Tile* pTile = nullptr;
 
+  /**
+   * Whether the material instances of this glTF's primitives were taken from
+   * the tileset's material instance pool, and so should be returned to it when
+   * the glTF is unloaded. This is decided when the glTF is created, because
+   * the lifecycle event receiver may change before it is unloaded.
+   */
+  bool UsesMaterialInstancePool = false;
+
   FCesiumModelMetadata Metadata{};
   EncodedFeaturesMetadata::EncodedModelMetadata EncodedMetadata{};
 
@@ -161,6 +161,72 @@ void UCesiumGltfGaussianSplatComponent::BeginDestroy() {
 }
 
 FCesiumGltfGaussianSplatData::FCesiumGltfGaussianSplatData(
+    const CesiumGltf::Model& model,
+    const CesiumGltf::MeshPrimitive& meshPrimitive,
+    bool compact) {
+  this->load(model, meshPrimitive);
+  if (compact) {
+    this->Compact();
+  }
+}
+
+void FCesiumGltfGaussianSplatData::Compact() {
+  if (this->bIsCompact) {
+    return;
+  }
+
+  this->bIsCompact = true;
+
+  this->CompactScales.SetNumUninitialized(this->Scales.Num());
+  for (int32 i = 0; i < this->Scales.Num(); i++) {
+    this->CompactScales[i] = FFloat16(this->Scales[i]);
+  }
+  this->Scales.Empty();
+
+  this->CompactOrientations.SetNumUninitialized(this->Orientations.Num());
+  for (int32 i = 0; i < this->Orientations.Num(); i++) {
+    this->CompactOrientations[i] = static_cast<int8>(
+        FMath::RoundToInt32(FMath::Clamp(this->Orientations[i], -1.0f, 1.0f) *
+                            127.0f));
+  }
+  this->Orientations.Empty();
+
+  this->CompactColors.SetNumUninitialized(this->Colors.Num());
+  for (int32 i = 0; i < this->Colors.Num(); i++) {
+    this->CompactColors[i] = FFloat16(this->Colors[i]);
+  }
+  this->Colors.Empty();
+
+  float minimum = 0.0f;
+  float maximum = 0.0f;
+  if (!this->SphericalHarmonics.IsEmpty()) {
+    minimum = TNumericLimits<float>::Max();
+    maximum = TNumericLimits<float>::Lowest();
+    for (float value : this->SphericalHarmonics) {
+      minimum = FMath::Min(minimum, value);
+      maximum = FMath::Max(maximum, value);
+    }
+  }
+
+  this->SphericalHarmonicsMinimum = minimum;
+  this->SphericalHarmonicsRange = maximum - minimum;
+
+  const float toQuantized = this->SphericalHarmonicsRange > 0.0f
+                                ? 255.0f / this->SphericalHarmonicsRange
+                                : 0.0f;
+  this->CompactSphericalHarmonics.SetNumUninitialized(
+      this->SphericalHarmonics.Num());
+  for (int32 i = 0; i < this->SphericalHarmonics.Num(); i++) {
+    this->CompactSphericalHarmonics[i] = static_cast<uint8>(FMath::Clamp(
+        FMath::RoundToInt32(
+            (this->SphericalHarmonics[i] - minimum) * toQuantized),
+        0,
+        255));
+  }
+  this->SphericalHarmonics.Empty();
+}
+
+void FCesiumGltfGaussianSplatData::load(
     const CesiumGltf::Model& model,
     const CesiumGltf::MeshPrimitive& meshPrimitive) {
   const int32 numShCoeffs = countShCoeffsOnPrimitive(meshPrimitive);
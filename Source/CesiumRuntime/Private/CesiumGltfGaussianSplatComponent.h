@@ -5,6 +5,7 @@
 #include "CesiumGltfPrimitiveComponent.h"
 
 #include "Math/Box.h"
+#include "Math/Float16.h"
 
 #include <CesiumGltf/MeshPrimitive.h>
 
@@ -56,6 +57,39 @@ struct FCesiumGltfGaussianSplatData {
    */
   TArray<float> SphericalHarmonics;
 
+  /**
+   * Whether this data is stored in the compact form. If true, the `Scales`,
+   * `Orientations`, `Colors`, and `SphericalHarmonics` arrays are empty, and
+   * the corresponding `Compact` arrays are used instead.
+   */
+  bool bIsCompact = false;
+
+  /**
+   * The scales as 16-bit floats, laid out like `Scales`.
+   */
+  TArray<FFloat16> CompactScales;
+
+  /**
+   * The orientations as signed 8-bit normalized values, laid out like
+   * `Orientations`. A value of 127 represents 1.0.
+   */
+  TArray<int8> CompactOrientations;
+
+  /**
+   * The colors as 16-bit floats, laid out like `Colors`.
+   */
+  TArray<FFloat16> CompactColors;
+
+  /**
+   * The spherical harmonic coefficients as unsigned 8-bit values, laid out
+   * like `SphericalHarmonics`. Each value `v` represents
+   * `SphericalHarmonicsMinimum + (v / 255) * SphericalHarmonicsRange`.
+   */
+  TArray<uint8> CompactSphericalHarmonics;
+
+  float SphericalHarmonicsMinimum = 0.0f;
+  float SphericalHarmonicsRange = 0.0f;
+
   /**
    * The bounds of this splat data in local space.
    */
@@ -82,6 +116,19 @@ struct FCesiumGltfGaussianSplatData {
    * mesh primitive.
    */
   FCesiumGltfGaussianSplatData(
+      const CesiumGltf::Model& model,
+      const CesiumGltf::MeshPrimitive& meshPrimitive,
+      bool compact = false);
+
+  /**
+   * Converts the scales, orientations, colors, and spherical harmonics of this
+   * data to the compact form, releasing the full-precision arrays. Does
+   * nothing if the data is already compact.
+   */
+  void Compact();
+
+private:
+  void load(
       const CesiumGltf::Model& model,
       const CesiumGltf::MeshPrimitive& meshPrimitive);
 };
@@ -9,4 +9,21 @@ UCesiumGltfVoxelComponent::UCesiumGltfVoxelComponent() {
 
 UCesiumGltfVoxelComponent::~UCesiumGltfVoxelComponent() {}
 
-void UCesiumGltfVoxelComponent::BeginDestroy() { Super::BeginDestroy(); }
+void UCesiumGltfVoxelComponent::BeginDestroy() {
+  for (CesiumAsync::SharedFuture<void>& future : this->_pendingReads) {
+    future.wait();
+  }
+  this->_pendingReads.clear();
+
+  Super::BeginDestroy();
+}
+
+void UCesiumGltfVoxelComponent::addPendingRead(
+    const CesiumAsync::SharedFuture<void>& future) {
+  std::erase_if(
+      this->_pendingReads,
+      [](const CesiumAsync::SharedFuture<void>& pendingRead) {
+        return pendingRead.isReady();
+      });
+  this->_pendingReads.push_back(future);
+}
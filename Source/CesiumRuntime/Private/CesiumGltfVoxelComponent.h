@@ -6,8 +6,10 @@
 #include "Components/SceneComponent.h"
 #include "CoreMinimal.h"
 
+#include <CesiumAsync/SharedFuture.h>
 #include <CesiumGeometry/OctreeTileID.h>
 #include <unordered_map>
+#include <vector>
 
 #include "CesiumGltfVoxelComponent.generated.h"
 
@@ -32,4 +34,20 @@ public:
 
   CesiumGeometry::OctreeTileID TileId;
   FCesiumPropertyAttribute PropertyAttribute;
+
+  /**
+   * Whether every voxel in the tile has no value for every property. Empty
+   * tiles are not uploaded to the GPU, and are skipped when ray marching.
+   */
+  bool IsEmpty = false;
+
+  /**
+   * Records work on another thread that reads from the property attribute.
+   * The tile's glTF is freed once this component is destroyed, so destruction
+   * waits for the work to finish.
+   */
+  void addPendingRead(const CesiumAsync::SharedFuture<void>& future);
+
+private:
+  std::vector<CesiumAsync::SharedFuture<void>> _pendingReads;
 };
@@ -0,0 +1,118 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumHeightClampingSubsystem.h"
+#include "Cesium3DTileset.h"
+#include "CesiumSampleHeightResult.h"
+
+void UCesiumHeightClampingSubsystem::RequestHeight(
+    ACesium3DTileset* pTileset,
+    const FVector& LongitudeLatitude,
+    FHeightCallback&& Callback) {
+  if (!IsValid(pTileset)) {
+    Callback(false, 0.0);
+    return;
+  }
+
+  TilesetRequests& requests = this->_requests.FindOrAdd(pTileset);
+  requests.positions.Emplace(LongitudeLatitude.X, LongitudeLatitude.Y, 0.0);
+  requests.callbacks.Emplace(MoveTemp(Callback));
+}
+
+void UCesiumHeightClampingSubsystem::Tick(float DeltaTime) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::HeightClamping)
+
+  // The callbacks of failed requests are invoked after the loop, because they
+  // may request more heights.
+  TArray<TilesetRequests> failed;
+
+  for (auto it = this->_requests.CreateIterator(); it; ++it) {
+    ACesium3DTileset* pTileset = it.Key().Get();
+    TilesetRequests& requests = it.Value();
+
+    if (!pTileset) {
+      // The tileset is gone, so none of these requests can succeed. This
+      // includes the in-flight query, whose result will not be delivered.
+      failed.Emplace(MoveTemp(requests));
+      it.RemoveCurrent();
+      continue;
+    }
+
+    if (!requests.queryInFlight && !requests.positions.IsEmpty()) {
+      this->_sendRequests(*pTileset, requests);
+    }
+  }
+
+  for (TilesetRequests& requests : failed) {
+    _failRequests(requests);
+  }
+}
+
+void UCesiumHeightClampingSubsystem::Deinitialize() {
+  TMap<TWeakObjectPtr<ACesium3DTileset>, TilesetRequests> requests =
+      MoveTemp(this->_requests);
+  this->_requests.Reset();
+  for (auto& pair : requests) {
+    _failRequests(pair.Value);
+  }
+
+  Super::Deinitialize();
+}
+
+TStatId UCesiumHeightClampingSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(
+      UCesiumHeightClampingSubsystem,
+      STATGROUP_Tickables);
+}
+
+void UCesiumHeightClampingSubsystem::_sendRequests(
+    ACesium3DTileset& tileset,
+    TilesetRequests& requests) {
+  requests.queryInFlight = true;
+
+  TArray<FVector> positions = MoveTemp(requests.positions);
+  requests.inFlightCallbacks = MoveTemp(requests.callbacks);
+  requests.positions.Reset();
+  requests.callbacks.Reset();
+
+  TWeakObjectPtr<ACesium3DTileset> pWeakTileset(&tileset);
+  tileset.SampleHeightMostDetailed(
+      positions,
+      FCesiumSampleHeightMostDetailedCallback::CreateWeakLambda(
+          this,
+          [this, pWeakTileset](
+              ACesium3DTileset* pTileset,
+              const TArray<FCesiumSampleHeightResult>& results,
+              const TArray<FString>& warnings) {
+            // If the tileset's entry is gone, its callbacks have already been
+            // failed in Tick.
+            TilesetRequests* pRequests = this->_requests.Find(pWeakTileset);
+            if (!pRequests || !pRequests->queryInFlight) {
+              return;
+            }
+
+            pRequests->queryInFlight = false;
+            TArray<FHeightCallback> callbacks =
+                MoveTemp(pRequests->inFlightCallbacks);
+            pRequests->inFlightCallbacks.Reset();
+
+            // pRequests may be invalidated by the callbacks below, because
+            // they can request more heights.
+            for (int32 i = 0; i < callbacks.Num(); ++i) {
+              if (results.IsValidIndex(i) && results[i].SampleSuccess) {
+                callbacks[i](true, results[i].LongitudeLatitudeHeight.Z);
+              } else {
+                callbacks[i](false, 0.0);
+              }
+            }
+          }));
+}
+
+void UCesiumHeightClampingSubsystem::_failRequests(TilesetRequests& requests) {
+  TArray<FHeightCallback> callbacks = MoveTemp(requests.inFlightCallbacks);
+  callbacks.Append(MoveTemp(requests.callbacks));
+  requests = TilesetRequests();
+
+  for (FHeightCallback& callback : callbacks) {
+    callback(false, 0.0);
+  }
+}
@@ -0,0 +1,77 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/Function.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#include "CesiumHeightClampingSubsystem.generated.h"
+
+class ACesium3DTileset;
+
+/**
+ * Finds the heights of tilesets below objects that are clamped to them, such
+ * as globe anchors with a `Tileset` height reference.
+ *
+ * Rather than tracing a ray through the physics scene for each object, the
+ * requests made to each tileset during a frame are combined into a single
+ * `SampleHeightMostDetailed` query. That query loads the most detailed tiles
+ * at the requested positions if they are not already loaded, and intersects
+ * their geometry on worker threads, so it does not require physics meshes.
+ * Only one query per tileset is in flight at a time; requests made in the
+ * meantime are sent together in the next one.
+ *
+ * Every callback is invoked exactly once. If the tileset is destroyed before
+ * its query completes, the pending callbacks are invoked with a failure.
+ */
+UCLASS()
+class UCesiumHeightClampingSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  /**
+   * The function called in the game thread with the result of a request. The
+   * first parameter is whether the height was found, and the second is the
+   * height of the tileset above the ellipsoid, in meters.
+   */
+  using FHeightCallback = TFunction<void(bool, double)>;
+
+  /**
+   * Requests the height of the tileset at the given longitude (X) and
+   * latitude (Y), in degrees. The Z component is ignored.
+   */
+  void RequestHeight(
+      ACesium3DTileset* pTileset,
+      const FVector& LongitudeLatitude,
+      FHeightCallback&& Callback);
+
+  virtual void Deinitialize() override;
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual bool IsTickableInEditor() const override { return true; }
+
+private:
+  struct TilesetRequests {
+    TArray<FVector> positions;
+    TArray<FHeightCallback> callbacks;
+    bool queryInFlight = false;
+
+    /**
+     * The callbacks of the query that is in flight, in the order of its
+     * positions.
+     */
+    TArray<FHeightCallback> inFlightCallbacks;
+  };
+
+  void _sendRequests(ACesium3DTileset& tileset, TilesetRequests& requests);
+
+  /**
+   * Invokes all of the queued and in-flight callbacks with a failure.
+   */
+  static void _failRequests(TilesetRequests& requests);
+
+  TMap<TWeakObjectPtr<ACesium3DTileset>, TilesetRequests> _requests;
+};
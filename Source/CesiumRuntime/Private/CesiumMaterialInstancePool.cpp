@@ -0,0 +1,109 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumMaterialInstancePool.h"
+#include "CesiumGltfComponent.h"
+#include "CesiumLifetime.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(
+    TEXT("Cesium Material Pool"),
+    STATGROUP_CesiumMaterialPool,
+    STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Material Pool Hits"),
+    STAT_CesiumMaterialPoolHits,
+    STATGROUP_CesiumMaterialPool);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Material Pool Misses"),
+    STAT_CesiumMaterialPoolMisses,
+    STATGROUP_CesiumMaterialPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Pooled Materials"),
+    STAT_CesiumPooledMaterials,
+    STATGROUP_CesiumMaterialPool);
+
+void UCesiumMaterialInstancePool::BeginDestroy() {
+  this->clear();
+  Super::BeginDestroy();
+}
+
+UMaterialInstanceDynamic*
+UCesiumMaterialInstancePool::acquire(UMaterialInterface* pParent) {
+  // Recently released materials are at the end, and are the most likely to
+  // share a parent with the requested one.
+  for (int32 i = this->_materials.Num() - 1; i >= 0; --i) {
+    UMaterialInstanceDynamic* pMaterial = this->_materials[i];
+    if (!IsValid(pMaterial) || pMaterial->Parent != pParent) {
+      continue;
+    }
+
+    this->_materials.RemoveAtSwap(i, EAllowShrinking::No);
+    DEC_DWORD_STAT(STAT_CesiumPooledMaterials);
+    INC_DWORD_STAT(STAT_CesiumMaterialPoolHits);
+    return pMaterial;
+  }
+
+  INC_DWORD_STAT(STAT_CesiumMaterialPoolMisses);
+  return nullptr;
+}
+
+void UCesiumMaterialInstancePool::release(UMaterialInstanceDynamic* pMaterial) {
+  if (!IsValid(pMaterial)) {
+    return;
+  }
+
+  if (this->_materials.Num() >= MaximumPooledMaterials) {
+    CesiumLifetime::destroy(pMaterial);
+    return;
+  }
+
+  pMaterial->ClearParameterValues();
+  this->_materials.Add(pMaterial);
+  INC_DWORD_STAT(STAT_CesiumPooledMaterials);
+}
+
+void UCesiumMaterialInstancePool::releaseMaterials(
+    const TArray<UMaterialInstanceDynamic*>& materials) {
+  for (UMaterialInstanceDynamic* pMaterial : materials) {
+    this->release(pMaterial);
+  }
+}
+
+/*static*/ TArray<UMaterialInstanceDynamic*>
+UCesiumMaterialInstancePool::takeMaterials(UCesiumGltfComponent& gltf) {
+  TArray<UMaterialInstanceDynamic*> materials;
+
+  TArray<USceneComponent*> children;
+  gltf.GetChildrenComponents(false, children);
+  for (USceneComponent* pChild : children) {
+    UStaticMeshComponent* pMeshComponent = Cast<UStaticMeshComponent>(pChild);
+    UStaticMesh* pStaticMesh =
+        pMeshComponent ? pMeshComponent->GetStaticMesh() : nullptr;
+    if (!pStaticMesh) {
+      continue;
+    }
+
+    // Only the mesh's own materials are created by Cesium for the primitive;
+    // materials set on the component may belong to the application. The mesh
+    // is destroyed along with the primitive, so its material slots don't need
+    // to be valid afterward.
+    for (FStaticMaterial& material : pStaticMesh->GetStaticMaterials()) {
+      UMaterialInstanceDynamic* pMaterial =
+          Cast<UMaterialInstanceDynamic>(material.MaterialInterface);
+      if (pMaterial) {
+        materials.Add(pMaterial);
+        material.MaterialInterface = nullptr;
+      }
+    }
+  }
+
+  return materials;
+}
+
+void UCesiumMaterialInstancePool::clear() {
+  DEC_DWORD_STAT_BY(STAT_CesiumPooledMaterials, this->_materials.Num());
+  this->_materials.Empty();
+}
@@ -0,0 +1,84 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "CesiumMaterialInstancePool.generated.h"
+
+class UMaterialInstanceDynamic;
+class UMaterialInterface;
+class UCesiumGltfComponent;
+
+/**
+ * A bounded pool of dynamic material instances for the primitives of a
+ * tileset. When a tile is unloaded, the material instances of its primitives
+ * are returned to the pool, and tiles loaded later reuse them rather than
+ * creating new ones. This reduces the number of objects created and garbage
+ * collected while the camera moves through a tileset.
+ *
+ * A material instance is only reused for a primitive whose material has the
+ * same parent. The pool's hits and misses can be seen with the
+ * `stat CesiumMaterialPool` console command.
+ *
+ * Only material instances are pooled. The primitive components and static
+ * meshes of unloaded tiles are still destroyed, because neither can be reused
+ * as-is: a static mesh's render data is built for its tile on a worker
+ * thread, and a primitive component is one of several classes chosen by the
+ * primitive's content, with physics state and attachments that depend on it.
+ */
+UCLASS()
+class UCesiumMaterialInstancePool : public UObject {
+  GENERATED_BODY()
+
+public:
+  /**
+   * The maximum number of material instances kept in the pool. Material
+   * instances released while the pool is full are destroyed.
+   */
+  static constexpr int32 MaximumPooledMaterials = 1024;
+
+  virtual void BeginDestroy() override;
+
+  /**
+   * Takes a material instance with the given parent from the pool. Returns
+   * nullptr if there is none, in which case the caller should create one.
+   */
+  UMaterialInstanceDynamic* acquire(UMaterialInterface* pParent);
+
+  /**
+   * Returns a material instance to the pool. Its parameter values are cleared,
+   * so that it no longer references the textures of the tile that used it. If
+   * the pool is full, the material instance is destroyed instead.
+   */
+  void release(UMaterialInstanceDynamic* pMaterial);
+
+  /**
+   * Returns several material instances to the pool.
+   */
+  void releaseMaterials(const TArray<UMaterialInstanceDynamic*>& materials);
+
+  /**
+   * Removes the material instances from the static meshes of a glTF's
+   * primitives and returns them. This must be called before the glTF is
+   * destroyed, because its primitives otherwise destroy their material
+   * instances along with them.
+   */
+  static TArray<UMaterialInstanceDynamic*>
+  takeMaterials(UCesiumGltfComponent& gltf);
+
+  /**
+   * Removes all material instances from the pool.
+   */
+  void clear();
+
+  /**
+   * Gets the number of material instances in the pool.
+   */
+  int32 getPooledCount() const { return this->_materials.Num(); }
+
+private:
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<UMaterialInstanceDynamic>> _materials;
+};
@@ -0,0 +1,262 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumPolygonCoverageIndex.h"
+
+#include <CesiumUtility/Math.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+
+namespace {
+// The finest level of the quadtree. Its cells are a few meters across, so
+// polygons smaller than that share cells rather than creating deeper levels.
+constexpr int32_t MaximumLevel = 24;
+
+uint64_t cellKey(uint32_t column, uint32_t row) {
+  return (uint64_t(column) << 32) | uint64_t(row);
+}
+
+// Converts longitude and latitude in radians to the unit square covered by the
+// root of the quadtree.
+double normalizeLongitude(double longitude) {
+  return (longitude + Math::OnePi) / Math::TwoPi;
+}
+
+double normalizeLatitude(double latitude) {
+  return (latitude + Math::PiOverTwo) / Math::OnePi;
+}
+
+uint32_t clampCell(double cell, uint32_t cellCount) {
+  return uint32_t(std::clamp(cell, 0.0, double(cellCount - 1)));
+}
+
+bool isInsidePolygon(
+    const std::vector<glm::dvec2>& vertices,
+    const glm::dvec2& point) {
+  bool inside = false;
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    const glm::dvec2& a = vertices[i];
+    const glm::dvec2& b = vertices[j];
+    if ((a.y > point.y) != (b.y > point.y) &&
+        point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+CesiumPolygonCoverageIndex::Coverage combine(
+    CesiumPolygonCoverageIndex::Coverage a,
+    CesiumPolygonCoverageIndex::Coverage b) {
+  return a == b ? a : CesiumPolygonCoverageIndex::Coverage::Partial;
+}
+} // namespace
+
+bool CesiumPolygonCoverageIndex::Rectangle::intersects(
+    const Rectangle& other) const {
+  return this->west <= other.east && other.west <= this->east &&
+         this->south <= other.north && other.south <= this->north;
+}
+
+CesiumPolygonCoverageIndex::CesiumPolygonCoverageIndex(
+    const std::vector<CartographicPolygon>& polygons)
+    : _levels(MaximumLevel + 1) {
+  this->_polygons.reserve(polygons.size());
+
+  for (const CartographicPolygon& polygon : polygons) {
+    const std::vector<glm::dvec2>& vertices = polygon.getVertices();
+    if (vertices.size() < 3) {
+      continue;
+    }
+
+    Rectangle bounds{
+        vertices[0].x,
+        vertices[0].y,
+        vertices[0].x,
+        vertices[0].y};
+    for (const glm::dvec2& vertex : vertices) {
+      bounds.west = std::min(bounds.west, vertex.x);
+      bounds.south = std::min(bounds.south, vertex.y);
+      bounds.east = std::max(bounds.east, vertex.x);
+      bounds.north = std::max(bounds.north, vertex.y);
+    }
+
+    // Find the finest level whose cells are at least as large as the polygon.
+    const double extent = std::max(
+        normalizeLongitude(bounds.east) - normalizeLongitude(bounds.west),
+        normalizeLatitude(bounds.north) - normalizeLatitude(bounds.south));
+    const int32_t level =
+        extent > 0.0
+            ? std::min(MaximumLevel, int32_t(std::floor(-std::log2(extent))))
+            : MaximumLevel;
+
+    const uint32_t cellCount = 1U << level;
+    const uint32_t column = clampCell(
+        std::floor(
+            normalizeLongitude((bounds.west + bounds.east) * 0.5) *
+            cellCount),
+        cellCount);
+    const uint32_t row = clampCell(
+        std::floor(
+            normalizeLatitude((bounds.south + bounds.north) * 0.5) *
+            cellCount),
+        cellCount);
+
+    this->_levels[level][cellKey(column, row)].push_back(
+        uint32_t(this->_polygons.size()));
+    this->_polygons.emplace_back(Polygon{bounds, vertices});
+  }
+}
+
+CesiumPolygonCoverageIndex::Coverage
+CesiumPolygonCoverageIndex::classify(const GlobeRectangle& rectangle) const {
+  if (rectangle.getEast() < rectangle.getWest()) {
+    // The rectangle crosses the antimeridian, so classify each side of it.
+    return combine(
+        this->_classify(Rectangle{
+            rectangle.getWest(),
+            rectangle.getSouth(),
+            Math::OnePi,
+            rectangle.getNorth()}),
+        this->_classify(Rectangle{
+            -Math::OnePi,
+            rectangle.getSouth(),
+            rectangle.getEast(),
+            rectangle.getNorth()}));
+  }
+
+  return this->_classify(Rectangle{
+      rectangle.getWest(),
+      rectangle.getSouth(),
+      rectangle.getEast(),
+      rectangle.getNorth()});
+}
+
+CesiumPolygonCoverageIndex::Coverage
+CesiumPolygonCoverageIndex::_classify(const Rectangle& rectangle) const {
+  const double west = normalizeLongitude(rectangle.west);
+  const double south = normalizeLatitude(rectangle.south);
+  const double east = normalizeLongitude(rectangle.east);
+  const double north = normalizeLatitude(rectangle.north);
+
+  bool partial = false;
+
+  // Returns true if the rectangle is known to be fully covered.
+  auto classifyCell = [this, &rectangle, &partial](
+                          const std::vector<uint32_t>& polygonIndices) {
+    for (uint32_t polygonIndex : polygonIndices) {
+      const Polygon& polygon = this->_polygons[polygonIndex];
+      if (!polygon.bounds.intersects(rectangle)) {
+        continue;
+      }
+
+      const Coverage coverage = _classifyPolygon(rectangle, polygon);
+      if (coverage == Coverage::Full) {
+        return true;
+      }
+      partial |= coverage == Coverage::Partial;
+    }
+    return false;
+  };
+
+  for (size_t level = 0; level < this->_levels.size(); ++level) {
+    const std::unordered_map<uint64_t, std::vector<uint32_t>>& cells =
+        this->_levels[level];
+    if (cells.empty()) {
+      continue;
+    }
+
+    // Polygons extend up to half a cell beyond their cell, so include the
+    // cells within half a cell of the rectangle.
+    const uint32_t cellCount = 1U << level;
+    const uint32_t minimumColumn =
+        clampCell(std::ceil(west * cellCount - 1.5), cellCount);
+    const uint32_t maximumColumn =
+        clampCell(std::floor(east * cellCount + 0.5), cellCount);
+    const uint32_t minimumRow =
+        clampCell(std::ceil(south * cellCount - 1.5), cellCount);
+    const uint32_t maximumRow =
+        clampCell(std::floor(north * cellCount + 0.5), cellCount);
+
+    const uint64_t candidateCells =
+        uint64_t(maximumColumn - minimumColumn + 1) *
+        uint64_t(maximumRow - minimumRow + 1);
+
+    if (candidateCells > cells.size()) {
+      // The rectangle spans more cells than are occupied, so it's cheaper to
+      // check every occupied cell.
+      for (const auto& [key, polygonIndices] : cells) {
+        const uint32_t column = uint32_t(key >> 32);
+        const uint32_t row = uint32_t(key);
+        if (column < minimumColumn || column > maximumColumn ||
+            row < minimumRow || row > maximumRow) {
+          continue;
+        }
+        if (classifyCell(polygonIndices)) {
+          return Coverage::Full;
+        }
+      }
+    } else {
+      for (uint32_t column = minimumColumn; column <= maximumColumn;
+           ++column) {
+        for (uint32_t row = minimumRow; row <= maximumRow; ++row) {
+          auto it = cells.find(cellKey(column, row));
+          if (it != cells.end() && classifyCell(it->second)) {
+            return Coverage::Full;
+          }
+        }
+      }
+    }
+  }
+
+  return partial ? Coverage::Partial : Coverage::None;
+}
+
+/*static*/ CesiumPolygonCoverageIndex::Coverage
+CesiumPolygonCoverageIndex::_classifyPolygon(
+    const Rectangle& rectangle,
+    const Polygon& polygon) {
+  const std::vector<glm::dvec2>& vertices = polygon.vertices;
+
+  // If any edge of the polygon touches the rectangle, the rectangle is partly
+  // inside and partly outside of the polygon. This is found by clipping each
+  // edge to the rectangle with the Liang-Barsky algorithm.
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    const glm::dvec2& a = vertices[j];
+    const glm::dvec2 delta = vertices[i] - a;
+
+    const double p[4] = {-delta.x, delta.x, -delta.y, delta.y};
+    const double q[4] = {
+        a.x - rectangle.west,
+        rectangle.east - a.x,
+        a.y - rectangle.south,
+        rectangle.north - a.y};
+
+    double enter = 0.0;
+    double exit = 1.0;
+    bool intersects = true;
+    for (int32_t k = 0; k < 4 && intersects; ++k) {
+      if (p[k] == 0.0) {
+        intersects = q[k] >= 0.0;
+      } else if (p[k] < 0.0) {
+        enter = std::max(enter, q[k] / p[k]);
+      } else {
+        exit = std::min(exit, q[k] / p[k]);
+      }
+      intersects = intersects && enter <= exit;
+    }
+
+    if (intersects) {
+      return Coverage::Partial;
+    }
+  }
+
+  // Otherwise, the rectangle is either entirely inside or entirely outside.
+  const glm::dvec2 center(
+      (rectangle.west + rectangle.east) * 0.5,
+      (rectangle.south + rectangle.north) * 0.5);
+  return isInsidePolygon(vertices, center) ? Coverage::Full : Coverage::None;
+}
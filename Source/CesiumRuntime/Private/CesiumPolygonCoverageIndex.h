@@ -0,0 +1,90 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+
+#include <glm/vec2.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * An index of the bounds of a set of polygons, used to quickly determine how
+ * much of a rectangle on the globe the polygons cover.
+ *
+ * Polygons are stored in a loose quadtree over longitude and latitude. Each
+ * polygon is placed in the level whose cells are at least as large as the
+ * polygon, in the cell containing the center of its bounds, so it only needs
+ * to be stored once. A query visits only the cells of each level that may hold
+ * a polygon overlapping the rectangle, and then tests only those polygons.
+ *
+ * Like the polygons themselves, the index works in the plane of longitude and
+ * latitude in radians. It cannot be modified after it is built, and may be
+ * queried from any thread.
+ */
+class CesiumPolygonCoverageIndex {
+public:
+  /**
+   * How much of a rectangle is covered by the polygons.
+   */
+  enum class Coverage {
+    /** The rectangle is entirely outside of all the polygons. */
+    None,
+    /** The rectangle is partially covered by the polygons. */
+    Partial,
+    /** The rectangle is entirely inside at least one polygon. */
+    Full
+  };
+
+  /**
+   * Builds an index of the given polygons. Polygons with fewer than three
+   * vertices are ignored.
+   */
+  explicit CesiumPolygonCoverageIndex(
+      const std::vector<CesiumGeospatial::CartographicPolygon>& polygons);
+
+  /**
+   * Gets the number of polygons in the index.
+   */
+  size_t getPolygonCount() const { return this->_polygons.size(); }
+
+  /**
+   * Determines how much of the given rectangle is covered by the polygons.
+   *
+   * A rectangle is only considered fully covered if it is entirely inside a
+   * single polygon; a rectangle covered by several polygons together is
+   * reported as partially covered.
+   */
+  Coverage classify(const CesiumGeospatial::GlobeRectangle& rectangle) const;
+
+private:
+  struct Rectangle {
+    double west;
+    double south;
+    double east;
+    double north;
+
+    bool intersects(const Rectangle& other) const;
+  };
+
+  struct Polygon {
+    Rectangle bounds;
+    std::vector<glm::dvec2> vertices;
+  };
+
+  Coverage _classify(const Rectangle& rectangle) const;
+
+  static Coverage
+  _classifyPolygon(const Rectangle& rectangle, const Polygon& polygon);
+
+  std::vector<Polygon> _polygons;
+
+  // The cells of each level of the quadtree that contain polygons, keyed by
+  // their column and row, each with the indices of its polygons. A cell of
+  // level L is 1 / 2^L of the globe wide and tall, and may hold polygons that
+  // extend half a cell beyond it in each direction.
+  std::vector<std::unordered_map<uint64_t, std::vector<uint32_t>>> _levels;
+};
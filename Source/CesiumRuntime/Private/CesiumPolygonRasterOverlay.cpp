@@ -1,17 +1,57 @@
 // Copyright 2020-2026 CesiumGS, Inc. and Contributors
 
 #include "CesiumPolygonRasterOverlay.h"
-#include "Cesium3DTilesSelection/RasterizedPolygonsTileExcluder.h"
+#include "Cesium3DTilesSelection/BoundingVolume.h"
+#include "Cesium3DTilesSelection/ITileExcluder.h"
+#include "Cesium3DTilesSelection/Tile.h"
 #include "Cesium3DTilesSelection/Tileset.h"
 #include "Cesium3DTileset.h"
 #include "CesiumBingMapsRasterOverlay.h"
 #include "CesiumCartographicPolygon.h"
+#include "CesiumPolygonCoverageIndex.h"
 #include "CesiumRasterOverlays/RasterizedPolygonsOverlay.h"
 
 using namespace Cesium3DTilesSelection;
 using namespace CesiumGeospatial;
 using namespace CesiumRasterOverlays;
 
+namespace {
+/**
+ * Excludes tiles that are entirely inside the selection of a polygon overlay,
+ * using a spatial index of the polygons so that each tile is only tested
+ * against the polygons near it.
+ */
+class PolygonCoverageTileExcluder : public ITileExcluder {
+public:
+  PolygonCoverageTileExcluder(
+      const std::shared_ptr<const CesiumPolygonCoverageIndex>& pIndex,
+      const Ellipsoid& ellipsoid,
+      bool invertSelection)
+      : _pIndex(pIndex),
+        _ellipsoid(ellipsoid),
+        _invertSelection(invertSelection) {}
+
+  virtual bool shouldExclude(const Tile& tile) const noexcept override {
+    std::optional<GlobeRectangle> maybeRectangle =
+        estimateGlobeRectangle(tile.getBoundingVolume(), this->_ellipsoid);
+    if (!maybeRectangle) {
+      return false;
+    }
+
+    const CesiumPolygonCoverageIndex::Coverage coverage =
+        this->_pIndex->classify(*maybeRectangle);
+    return this->_invertSelection
+               ? coverage == CesiumPolygonCoverageIndex::Coverage::None
+               : coverage == CesiumPolygonCoverageIndex::Coverage::Full;
+  }
+
+private:
+  std::shared_ptr<const CesiumPolygonCoverageIndex> _pIndex;
+  Ellipsoid _ellipsoid;
+  bool _invertSelection;
+};
+} // namespace
+
 UCesiumPolygonRasterOverlay::UCesiumPolygonRasterOverlay()
     : UCesiumRasterOverlay() {
   this->MaterialLayerKey = TEXT("Clipping");
@@ -35,9 +75,17 @@ UCesiumPolygonRasterOverlay::CreateOverlay(
 
     CartographicPolygon polygon =
         pPolygon->CreateCartographicPolygon(worldToTileset);
+    if (polygon.getVertices().size() < 3) {
+      // Degenerate polygons select nothing, so there's no need to rasterize
+      // them.
+      continue;
+    }
     polygons.emplace_back(std::move(polygon));
   }
 
+  this->_pCoverageIndex =
+      std::make_shared<const CesiumPolygonCoverageIndex>(polygons);
+
   UCesiumEllipsoid* Ellipsoid = pTileset->ResolveGeoreference()->GetEllipsoid();
   check(IsValid(Ellipsoid));
 
@@ -55,12 +103,12 @@ void UCesiumPolygonRasterOverlay::OnAdd(
     RasterOverlay* pOverlay) {
   // If this overlay is used for culling, add it as an excluder too for
   // efficiency.
-  if (pTileset && this->ExcludeSelectedTiles) {
-    RasterizedPolygonsOverlay* pPolygons =
-        static_cast<RasterizedPolygonsOverlay*>(pOverlay);
+  if (pTileset && this->ExcludeSelectedTiles && this->_pCoverageIndex) {
     assert(this->_pExcluder == nullptr);
-    this->_pExcluder =
-        std::make_shared<RasterizedPolygonsTileExcluder>(pPolygons);
+    this->_pExcluder = std::make_shared<PolygonCoverageTileExcluder>(
+        this->_pCoverageIndex,
+        pTileset->getOptions().ellipsoid,
+        this->InvertSelection);
     pTileset->getOptions().excluders.push_back(this->_pExcluder);
   }
 }
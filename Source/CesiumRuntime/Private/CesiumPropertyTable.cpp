@@ -98,6 +98,20 @@ UCesiumPropertyTableBlueprintLibrary::FindProperty(
   return property ? *property : EmptyPropertyTableProperty;
 }
 
+/*static*/ TArray<FCesiumPropertyTableProperty>
+UCesiumPropertyTableBlueprintLibrary::FindProperties(
+    UPARAM(ref) const FCesiumPropertyTable& PropertyTable,
+    const TArray<FString>& PropertyNames) {
+  TArray<FCesiumPropertyTableProperty> properties;
+  properties.Reserve(PropertyNames.Num());
+  for (const FString& name : PropertyNames) {
+    const FCesiumPropertyTableProperty* property =
+        PropertyTable._properties.Find(name);
+    properties.Add(property ? *property : EmptyPropertyTableProperty);
+  }
+  return properties;
+}
+
 /*static*/ TMap<FString, FCesiumMetadataValue>
 UCesiumPropertyTableBlueprintLibrary::GetMetadataValuesForFeature(
     UPARAM(ref) const FCesiumPropertyTable& PropertyTable,
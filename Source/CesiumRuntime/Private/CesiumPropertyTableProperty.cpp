@@ -6,6 +6,7 @@
 
 #include <CesiumGltf/MetadataConversions.h>
 #include <CesiumGltf/PropertyTypeTraits.h>
+#include <type_traits>
 #include <utility>
 
 namespace {
@@ -837,6 +838,54 @@ TResult propertyTablePropertyCallback(
   }
 }
 
+/**
+ * Gets the values of the property for each of the given features, converted to
+ * T. The type of the property is resolved once for the whole batch.
+ */
+template <typename T>
+TArray<T> getValuesForFeatures(
+    const std::any& property,
+    const FCesiumMetadataValueType& valueType,
+    bool normalized,
+    const TArray<int64>& featureIDs,
+    T defaultValue) {
+  // MetadataConversions is specialized for int64_t, which is not necessarily
+  // the same type as int64.
+  using TConverted = std::conditional_t<std::is_same_v<T, int64>, int64_t, T>;
+
+  TArray<T> result;
+  result.SetNumUninitialized(featureIDs.Num());
+
+  propertyTablePropertyCallback<void>(
+      property,
+      valueType,
+      normalized,
+      [&featureIDs, defaultValue, &result](const auto& v) {
+        // size() returns zero if the view is invalid.
+        const int64 size = v.size();
+        for (int32 i = 0; i < featureIDs.Num(); ++i) {
+          const int64 featureID = featureIDs[i];
+          if (featureID < 0 || featureID >= size) {
+            result[i] = defaultValue;
+            continue;
+          }
+
+          auto maybeValue = v.get(featureID);
+          if (maybeValue) {
+            auto value = *maybeValue;
+            result[i] =
+                CesiumGltf::MetadataConversions<TConverted, decltype(value)>::
+                    convert(value)
+                        .value_or(defaultValue);
+          } else {
+            result[i] = defaultValue;
+          }
+        }
+      });
+
+  return result;
+}
+
 } // namespace
 
 ECesiumPropertyTablePropertyStatus
@@ -1032,6 +1081,66 @@ double UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64(
       });
 }
 
+TArray<bool> UCesiumPropertyTablePropertyBlueprintLibrary::GetBooleanValues(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    const TArray<int64>& FeatureIDs,
+    bool DefaultValue) {
+  return getValuesForFeatures<bool>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      FeatureIDs,
+      DefaultValue);
+}
+
+TArray<int32> UCesiumPropertyTablePropertyBlueprintLibrary::GetIntegerValues(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    const TArray<int64>& FeatureIDs,
+    int32 DefaultValue) {
+  return getValuesForFeatures<int32>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      FeatureIDs,
+      DefaultValue);
+}
+
+TArray<int64> UCesiumPropertyTablePropertyBlueprintLibrary::GetInteger64Values(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    const TArray<int64>& FeatureIDs,
+    int64 DefaultValue) {
+  return getValuesForFeatures<int64>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      FeatureIDs,
+      DefaultValue);
+}
+
+TArray<float> UCesiumPropertyTablePropertyBlueprintLibrary::GetFloatValues(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    const TArray<int64>& FeatureIDs,
+    float DefaultValue) {
+  return getValuesForFeatures<float>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      FeatureIDs,
+      DefaultValue);
+}
+
+TArray<double> UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64Values(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    const TArray<int64>& FeatureIDs,
+    double DefaultValue) {
+  return getValuesForFeatures<double>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      FeatureIDs,
+      DefaultValue);
+}
+
 FIntPoint UCesiumPropertyTablePropertyBlueprintLibrary::GetIntPoint(
     UPARAM(ref) const FCesiumPropertyTableProperty& Property,
     int64 FeatureID,
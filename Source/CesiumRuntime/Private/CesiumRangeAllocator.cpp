@@ -0,0 +1,91 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumRangeAllocator.h"
+#include "Algo/BinarySearch.h"
+
+CesiumRangeAllocator::CesiumRangeAllocator(int32 capacity)
+    : _freeRanges(), _capacity(capacity), _end(0), _freeCountBeforeEnd(0) {}
+
+std::optional<int32> CesiumRangeAllocator::allocate(int32 count) {
+  check(count >= 0);
+  if (count == 0) {
+    return this->_end;
+  }
+
+  for (int32 i = 0; i < this->_freeRanges.Num(); ++i) {
+    Range& range = this->_freeRanges[i];
+    if (range.count < count) {
+      continue;
+    }
+
+    const int32 offset = range.offset;
+    range.offset += count;
+    range.count -= count;
+    if (range.count == 0) {
+      this->_freeRanges.RemoveAt(i, EAllowShrinking::No);
+    }
+
+    this->_freeCountBeforeEnd -= count;
+    return offset;
+  }
+
+  if (count > this->_capacity - this->_end) {
+    return std::nullopt;
+  }
+
+  const int32 offset = this->_end;
+  this->_end += count;
+  return offset;
+}
+
+void CesiumRangeAllocator::free(int32 offset, int32 count) {
+  check(count >= 0);
+  check(offset >= 0 && offset + count <= this->_end);
+  if (count == 0) {
+    return;
+  }
+
+  // Find the first free range after the one being freed.
+  const int32 next = Algo::LowerBoundBy(
+      this->_freeRanges,
+      offset,
+      [](const Range& range) { return range.offset; });
+
+  const bool mergesWithPrevious =
+      next > 0 && this->_freeRanges[next - 1].offset +
+                          this->_freeRanges[next - 1].count ==
+                      offset;
+  const bool mergesWithNext = next < this->_freeRanges.Num() &&
+                              offset + count == this->_freeRanges[next].offset;
+
+  this->_freeCountBeforeEnd += count;
+
+  if (mergesWithPrevious && mergesWithNext) {
+    this->_freeRanges[next - 1].count += count + this->_freeRanges[next].count;
+    this->_freeRanges.RemoveAt(next, EAllowShrinking::No);
+  } else if (mergesWithPrevious) {
+    this->_freeRanges[next - 1].count += count;
+  } else if (mergesWithNext) {
+    this->_freeRanges[next].offset = offset;
+    this->_freeRanges[next].count += count;
+  } else {
+    this->_freeRanges.Insert(Range{offset, count}, next);
+  }
+
+  // A free range that reaches the end is no longer before the end.
+  if (!this->_freeRanges.IsEmpty()) {
+    const Range& last = this->_freeRanges.Last();
+    if (last.offset + last.count == this->_end) {
+      this->_end = last.offset;
+      this->_freeCountBeforeEnd -= last.count;
+      this->_freeRanges.Pop(EAllowShrinking::No);
+    }
+  }
+}
+
+void CesiumRangeAllocator::reset(int32 capacity) {
+  this->_freeRanges.Reset();
+  this->_capacity = capacity;
+  this->_end = 0;
+  this->_freeCountBeforeEnd = 0;
+}
@@ -0,0 +1,74 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "HAL/Platform.h"
+#include <optional>
+
+/**
+ * Allocates contiguous ranges of elements from a fixed-capacity pool, such as
+ * a GPU buffer, using a first-fit free list.
+ *
+ * Freed ranges are merged with their free neighbors, and a range freed at the
+ * end of the allocated region lowers the end, so that the region in use stays
+ * as small as possible. The allocator only does bookkeeping; it neither owns
+ * nor touches the storage.
+ */
+class CesiumRangeAllocator {
+public:
+  /**
+   * Constructs an allocator with the given capacity.
+   */
+  explicit CesiumRangeAllocator(int32 capacity = 0);
+
+  /**
+   * Allocates a contiguous range of the given number of elements.
+   *
+   * @return The offset of the first element of the range, or `std::nullopt` if
+   * no free range is large enough. An empty range is always allocated at the
+   * end, without consuming any capacity.
+   */
+  std::optional<int32> allocate(int32 count);
+
+  /**
+   * Returns a range previously returned by {@link allocate} to the free list.
+   */
+  void free(int32 offset, int32 count);
+
+  /**
+   * Frees all ranges and changes the capacity.
+   */
+  void reset(int32 capacity);
+
+  /**
+   * Gets the total number of elements that may be allocated.
+   */
+  int32 getCapacity() const noexcept { return this->_capacity; }
+
+  /**
+   * Gets the offset one past the end of the last allocated range. Every
+   * element at or beyond this offset is free.
+   */
+  int32 getEnd() const noexcept { return this->_end; }
+
+  /**
+   * Gets the number of free elements before {@link getEnd}, which is a measure
+   * of how fragmented the allocated region has become.
+   */
+  int32 getFreeCountBeforeEnd() const noexcept {
+    return this->_freeCountBeforeEnd;
+  }
+
+private:
+  struct Range {
+    int32 offset;
+    int32 count;
+  };
+
+  // Free ranges before _end, sorted by offset. No two ranges are adjacent.
+  TArray<Range> _freeRanges;
+  int32 _capacity;
+  int32 _end;
+  int32 _freeCountBeforeEnd;
+};
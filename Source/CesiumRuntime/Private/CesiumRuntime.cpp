@@ -1,12 +1,14 @@
 // Copyright 2020-2026 CesiumGS, Inc. and Contributors
 
 #include "CesiumRuntime.h"
+#include "BackgroundPruningCacheDatabase.h"
 #include "CesiumRuntimeSettings.h"
 #include "HAL/FileManager.h"
 #include "HttpModule.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/Paths.h"
 #include "ShaderCore.h"
+#include "ShardedFileCache.h"
 #include "SpdlogUnrealLoggerSink.h"
 #include "UnrealAssetAccessor.h"
 #include "UnrealTaskProcessor.h"
@@ -21,6 +23,8 @@
 #include <Modules/ModuleManager.h>
 #include <spdlog/spdlog.h>
 
+#include <mutex>
+
 #if CESIUM_TRACING_ENABLED
 #include <chrono>
 #endif
@@ -29,6 +33,11 @@
 
 DEFINE_LOG_CATEGORY(LogCesium);
 
+namespace {
+std::shared_ptr<UnrealTaskProcessor> pTaskProcessor;
+std::once_flag taskProcessorCreated;
+} // namespace
+
 void FCesiumRuntimeModule::StartupModule() {
   Cesium3DTilesContent::registerAllTileContentTypes();
 
@@ -53,7 +62,13 @@ void FCesiumRuntimeModule::StartupModule() {
       PluginShaderDir);
 }
 
-void FCesiumRuntimeModule::ShutdownModule() { CESIUM_TRACE_SHUTDOWN(); }
+void FCesiumRuntimeModule::ShutdownModule() {
+  // Don't create the worker pool just to shut it down.
+  if (pTaskProcessor) {
+    pTaskProcessor->shutdown();
+  }
+  CESIUM_TRACE_SHUTDOWN();
+}
 
 #undef LOCTEXT_NAMESPACE
 
@@ -65,15 +80,21 @@ FCesiumRasterOverlayIonTroubleshooting
 FCesiumFeaturesMetadataAddProperties OnCesiumFeaturesMetadataAddProperties{};
 FCesiumVoxelMetadataBuildShader OnCesiumVoxelMetadataBuildShader{};
 
+const std::shared_ptr<UnrealTaskProcessor>& getTaskProcessor() {
+  std::call_once(taskProcessorCreated, []() {
+    pTaskProcessor = std::make_shared<UnrealTaskProcessor>();
+  });
+  return pTaskProcessor;
+}
+
 CesiumAsync::AsyncSystem& getAsyncSystem() noexcept {
-  static CesiumAsync::AsyncSystem asyncSystem(
-      std::make_shared<UnrealTaskProcessor>());
+  static CesiumAsync::AsyncSystem asyncSystem(getTaskProcessor());
   return asyncSystem;
 }
 
 namespace {
 
-std::string getCacheDatabaseName() {
+FString getCacheBaseDirectory() {
 #if PLATFORM_ANDROID
   FString BaseDirectory = FPaths::ProjectPersistentDownloadDir();
 #elif PLATFORM_IOS
@@ -85,9 +106,13 @@ std::string getCacheDatabaseName() {
 #else
   FString BaseDirectory = FPaths::ProjectUserDir();
 #endif
+  return BaseDirectory;
+}
 
-  FString CesiumDBFile =
-      FPaths::Combine(*BaseDirectory, TEXT("cesium-request-cache.sqlite"));
+std::string getCacheDatabaseName() {
+  FString CesiumDBFile = FPaths::Combine(
+      *getCacheBaseDirectory(),
+      TEXT("cesium-request-cache.sqlite"));
   FString PlatformAbsolutePath =
       IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(
           *CesiumDBFile);
@@ -101,18 +126,38 @@ std::string getCacheDatabaseName() {
   return TCHAR_TO_UTF8(*PlatformAbsolutePath);
 }
 
+FString getCacheDirectoryName() {
+  FString CesiumCacheDirectory =
+      FPaths::Combine(*getCacheBaseDirectory(), TEXT("cesium-request-cache"));
+  return IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(
+      *CesiumCacheDirectory);
+}
+
+std::shared_ptr<CesiumAsync::ICacheDatabase> createCacheDatabase() {
+  const UCesiumRuntimeSettings* pSettings = GetDefault<UCesiumRuntimeSettings>();
+  std::shared_ptr<CesiumAsync::ICacheDatabase> pDatabase;
+  switch (pSettings->RequestCacheBackend) {
+  case ECesiumRequestCacheBackend::ShardedFiles:
+    pDatabase = std::make_shared<ShardedFileCache>(
+        getCacheDirectoryName(),
+        int64(pSettings->MaxCacheMegabytes) * 1024 * 1024);
+    break;
+  case ECesiumRequestCacheBackend::Sqlite:
+  default:
+    pDatabase = std::make_shared<CesiumAsync::SqliteCache>(
+        spdlog::default_logger(),
+        getCacheDatabaseName(),
+        pSettings->MaxCacheItems);
+    break;
+  }
+  return std::make_shared<BackgroundPruningCacheDatabase>(pDatabase);
+}
+
 } // namespace
 
 std::shared_ptr<CesiumAsync::ICacheDatabase>& getCacheDatabase() {
-  static int MaxCacheItems =
-      GetDefault<UCesiumRuntimeSettings>()->MaxCacheItems;
-
   static std::shared_ptr<CesiumAsync::ICacheDatabase> pCacheDatabase =
-      std::make_shared<CesiumAsync::SqliteCache>(
-          spdlog::default_logger(),
-          getCacheDatabaseName(),
-          MaxCacheItems);
-
+      createCacheDatabase();
   return pCacheDatabase;
 }
 
@@ -0,0 +1,97 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumTextureBudget.h"
+#include "CesiumRuntimeSettings.h"
+#include "CoreGlobals.h"
+#include "Math/UnrealMathUtility.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(
+    TEXT("Cesium Textures"),
+    STATGROUP_CesiumTextures,
+    STATCAT_Advanced);
+DECLARE_MEMORY_STAT(
+    TEXT("GPU Texture Memory"),
+    STAT_CesiumTextureMemory,
+    STATGROUP_CesiumTextures);
+DECLARE_MEMORY_STAT(
+    TEXT("GPU Texture Budget"),
+    STAT_CesiumTextureBudget,
+    STATGROUP_CesiumTextures);
+DECLARE_FLOAT_COUNTER_STAT(
+    TEXT("Tileset Cache Scale"),
+    STAT_CesiumTilesetCacheScale,
+    STATGROUP_CesiumTextures);
+
+namespace {
+// Once over budget, the caches are allowed to grow again only when the
+// textures fall below this fraction of the budget, so that tiles aren't
+// repeatedly unloaded and reloaded while usage hovers around the budget.
+constexpr double GrowThreshold = 0.9;
+
+// The most the cache scale can shrink in one frame. Unloading takes effect
+// over several frames, so shrinking all at once would overshoot.
+constexpr double MinimumShrinkFactor = 0.5;
+
+constexpr double GrowFactor = 1.05;
+} // namespace
+
+/*static*/ CesiumTextureBudget& CesiumTextureBudget::get() {
+  static CesiumTextureBudget budget;
+  return budget;
+}
+
+void CesiumTextureBudget::addTexture(int64 sizeBytes) {
+  this->_textureBytes.fetch_add(sizeBytes, std::memory_order_relaxed);
+  INC_MEMORY_STAT_BY(STAT_CesiumTextureMemory, sizeBytes);
+}
+
+void CesiumTextureBudget::removeTexture(int64 sizeBytes) {
+  this->_textureBytes.fetch_sub(sizeBytes, std::memory_order_relaxed);
+  DEC_MEMORY_STAT_BY(STAT_CesiumTextureMemory, sizeBytes);
+}
+
+int64 CesiumTextureBudget::getTextureBytes() const {
+  return this->_textureBytes.load(std::memory_order_relaxed);
+}
+
+bool CesiumTextureBudget::isOverBudget() const {
+  const int64 budgetBytes = this->_budgetBytes.load(std::memory_order_relaxed);
+  return budgetBytes > 0 && this->getTextureBytes() > budgetBytes;
+}
+
+void CesiumTextureBudget::update(int64 budgetBytes) {
+  this->_budgetBytes.store(budgetBytes, std::memory_order_relaxed);
+
+  const int64 textureBytes = this->getTextureBytes();
+  if (budgetBytes <= 0) {
+    this->_cacheScale = 1.0;
+  } else if (textureBytes > budgetBytes) {
+    // Shrink in proportion to how far over budget the textures are.
+    this->_cacheScale *= FMath::Max(
+        double(budgetBytes) / double(textureBytes),
+        MinimumShrinkFactor);
+  } else if (textureBytes < budgetBytes * GrowThreshold) {
+    // Make sure a cache scale of zero can grow again.
+    this->_cacheScale =
+        FMath::Min(FMath::Max(this->_cacheScale, 0.01) * GrowFactor, 1.0);
+  }
+
+  SET_MEMORY_STAT(STAT_CesiumTextureBudget, budgetBytes);
+  SET_FLOAT_STAT(STAT_CesiumTilesetCacheScale, this->_cacheScale);
+}
+
+void CesiumTextureBudget::updateForFrame() {
+  if (this->_lastUpdateFrame == GFrameCounter) {
+    return;
+  }
+  this->_lastUpdateFrame = GFrameCounter;
+
+  const int64 budgetMegabytes =
+      GetDefault<UCesiumRuntimeSettings>()->MaximumTextureMegabytes;
+  this->update(budgetMegabytes * 1024 * 1024);
+}
+
+int64 CesiumTextureBudget::scaleCachedBytes(int64 maximumCachedBytes) const {
+  return int64(double(maximumCachedBytes) * this->_cacheScale);
+}
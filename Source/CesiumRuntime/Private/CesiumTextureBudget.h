@@ -0,0 +1,82 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "HAL/Platform.h"
+
+#include <atomic>
+
+/**
+ * Tracks the GPU memory used by all of Cesium's textures, across every
+ * tileset and raster overlay, and degrades gracefully when it exceeds the
+ * budget in `UCesiumRuntimeSettings::MaximumTextureMegabytes`.
+ *
+ * When over budget, two things happen:
+ *
+ * - The tile cache of every tileset is shrunk. Tilesets unload their least
+ * recently visible tiles first, which releases the textures of those tiles and
+ * of the raster overlays draped on them. The caches grow back once texture
+ * usage falls comfortably below the budget.
+ * - Newly created textures that have mipmaps skip their most detailed mip
+ * level, using a quarter of the memory.
+ *
+ * Texture sizes are added and removed from the render thread, and may be read
+ * from any thread. The cache scale is only updated and read on the game
+ * thread.
+ */
+class CesiumTextureBudget {
+public:
+  /**
+   * Gets the budget shared by all Cesium textures.
+   */
+  static CesiumTextureBudget& get();
+
+  /**
+   * Records that a texture of the given size was created on the GPU.
+   */
+  void addTexture(int64 sizeBytes);
+
+  /**
+   * Records that a texture of the given size was released from the GPU.
+   */
+  void removeTexture(int64 sizeBytes);
+
+  /**
+   * Gets the total size of all Cesium textures on the GPU.
+   */
+  int64 getTextureBytes() const;
+
+  /**
+   * Gets whether the textures currently exceed the budget.
+   */
+  bool isOverBudget() const;
+
+  /**
+   * Adjusts the cache scale toward keeping the textures within the given
+   * budget. A budget of zero means there is no limit.
+   */
+  void update(int64 budgetBytes);
+
+  /**
+   * Calls `update` with the budget from the runtime settings, at most once per
+   * frame. This should be called by every tileset before it selects tiles.
+   */
+  void updateForFrame();
+
+  /**
+   * Gets the fraction of their configured cache size that tilesets should
+   * currently use, from 0.0 to 1.0.
+   */
+  double getCacheScale() const { return this->_cacheScale; }
+
+  /**
+   * Scales a tileset's maximum cached bytes by the current cache scale.
+   */
+  int64 scaleCachedBytes(int64 maximumCachedBytes) const;
+
+private:
+  std::atomic<int64> _textureBytes{0};
+  std::atomic<int64> _budgetBytes{0};
+  double _cacheScale = 1.0;
+  uint64 _lastUpdateFrame = ~uint64(0);
+};
@@ -3,6 +3,7 @@
 #include "CesiumTextureResource.h"
 #include "CesiumCommon.h"
 #include "CesiumRuntime.h"
+#include "CesiumTextureBudget.h"
 #include "CesiumTextureUtility.h"
 #include "Misc/CoreStats.h"
 #include "RenderUtils.h"
@@ -310,6 +311,43 @@ FTextureRHIRef CreateRHITexture2D_Async(
   }
 }
 
+/**
+ * @brief Removes the most detailed mip level from an image that has mipmaps,
+ * so that the next level becomes the base of the image. Images that are
+ * already small, or have no mipmaps, are left unchanged.
+ */
+void dropMostDetailedMip(CesiumImage::ImageAsset& image) {
+  // Below this size, the savings aren't worth the loss of detail.
+  constexpr int32_t minimumSize = 64;
+  if (image.mipPositions.size() < 2 || image.width < minimumSize ||
+      image.height < minimumSize) {
+    return;
+  }
+
+  image.mipPositions.erase(image.mipPositions.begin());
+  image.width = FMath::Max(image.width / 2, 1);
+  image.height = FMath::Max(image.height / 2, 1);
+
+  // Copy the remaining mips to a new buffer so the dropped one is freed.
+  size_t remainingBytes = 0;
+  for (const CesiumImage::ImageAssetMipPosition& mipPos : image.mipPositions) {
+    remainingBytes += mipPos.byteSize;
+  }
+
+  std::vector<std::byte> pixelData(remainingBytes);
+  size_t byteOffset = 0;
+  for (CesiumImage::ImageAssetMipPosition& mipPos : image.mipPositions) {
+    FMemory::Memcpy(
+        pixelData.data() + byteOffset,
+        image.pixelData.data() + mipPos.byteOffset,
+        mipPos.byteSize);
+    mipPos.byteOffset = byteOffset;
+    byteOffset += mipPos.byteSize;
+  }
+
+  image.pixelData.swap(pixelData);
+}
+
 } // namespace
 
 void FCesiumTextureResourceDeleter::operator()(FCesiumTextureResource* p) {
@@ -355,6 +393,10 @@ void FCesiumTextureResourceDeleter::operator()(FCesiumTextureResource* p) {
     return nullptr;
   }
 
+  if (CesiumTextureBudget::get().isOverBudget()) {
+    dropMostDetailedMip(imageCesium);
+  }
+
   // Store the current size of the pixel data, because
   // we're about to clear it but we still want to have
   // an accurate estimation of the size of the image for
@@ -500,6 +542,7 @@ FCesiumTextureResource::FCesiumTextureResource(
       _addressY(convertAddressMode(addressY)),
       _useMipsIfAvailable(useMipsIfAvailable),
       _platformExtData(extData),
+      _textureSize(0),
       _isPrimary(isPrimary) {
   this->bGreyScaleFormat = (_format == PF_G8) || (_format == PF_BC4);
   this->bSRGB = sRGB;
@@ -543,7 +586,6 @@ void FCesiumTextureResource::InitRHI(FRHICommandListBase& RHICmdList) {
       TextureReferenceRHI,
       this->TextureRHI);
 
-#if STATS
   if (this->_isPrimary) {
     ETextureCreateFlags textureFlags = TexCreate_ShaderResource;
     if (this->bSRGB) {
@@ -581,19 +623,18 @@ void FCesiumTextureResource::InitRHI(FRHICommandListBase& RHICmdList) {
         .SetInitialState(ERHIAccess::Unknown);
     this->_textureSize = RHICalcTexturePlatformSize(Desc).Size;
 
+    CesiumTextureBudget::get().addTexture(this->_textureSize);
     INC_DWORD_STAT_BY(STAT_TextureMemory, this->_textureSize);
     INC_DWORD_STAT_FNAME_BY(this->_lodGroupStatName, this->_textureSize);
   }
-#endif
 }
 
 void FCesiumTextureResource::ReleaseRHI() {
-#if STATS
   if (this->_isPrimary) {
+    CesiumTextureBudget::get().removeTexture(this->_textureSize);
     DEC_DWORD_STAT_BY(STAT_TextureMemory, this->_textureSize);
     DEC_DWORD_STAT_FNAME_BY(this->_lodGroupStatName, this->_textureSize);
   }
-#endif
 
   FRHICommandListImmediate::Get().UpdateTextureReference(
       TextureReferenceRHI,
@@ -24,6 +24,8 @@
 #include <Cesium3DTiles/ExtensionContent3dTilesContentVoxels.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumUtility/Math.h>
+#include <algorithm>
+#include <functional>
 #include <variant>
 
 using namespace EncodedFeaturesMetadata;
@@ -457,6 +459,7 @@ UCesiumVoxelRendererComponent::createVoxelMaterial(
           : 1;
   pVoxelComponent->_pOctree = MakeUnique<FVoxelOctree>(maximumTileCount);
   pVoxelComponent->_loadedNodeIds.reserve(maximumTileCount);
+  pVoxelComponent->_emptyNodeIds.reserve(maximumTileCount);
 
   CreateGltfOptions::CreateVoxelOptions& options = pVoxelComponent->Options;
   options.pTilesetExtension = &voxelExtension;
@@ -539,7 +542,7 @@ void UCesiumVoxelRendererComponent::UpdateTiles(
        &priorityQueue = this->_visibleTileQueue,
        &pOctree = this->_pOctree](
           size_t index,
-          const UCesiumGltfVoxelComponent* pVoxel) {
+          UCesiumGltfVoxelComponent* pVoxel) {
         double sse = VisibleTileScreenSpaceErrors[index];
         FVoxelOctree::Node* pNode = pOctree->getNode(pVoxel->TileId);
         if (pNode) {
@@ -555,28 +558,14 @@ void UCesiumVoxelRendererComponent::UpdateTiles(
     return;
   }
 
-  // Sort the existing nodes in the megatexture by highest to lowest priority.
-  std::sort(
-      this->_loadedNodeIds.begin(),
-      this->_loadedNodeIds.end(),
-      [&pOctree = this->_pOctree](
-          const CesiumGeometry::OctreeTileID& lhs,
-          const CesiumGeometry::OctreeTileID& rhs) {
-        const FVoxelOctree::Node* pLeft = pOctree->getNode(lhs);
-        const FVoxelOctree::Node* pRight = pOctree->getNode(rhs);
-        if (!pLeft) {
-          return false;
-        }
-        if (!pRight) {
-          return true;
-        }
-        return pLeft->lastKnownScreenSpaceError >
-               pRight->lastKnownScreenSpaceError;
-      });
+  // When the data textures are full, the loaded nodes are evicted from lowest
+  // to highest priority.
+  this->_evictionQueue.reset();
 
-  size_t existingNodeCount = this->_loadedNodeIds.size();
-  size_t destroyedNodeCount = 0;
-  size_t addedNodeCount = 0;
+  // Nodes added during this frame are appended after this point. They
+  // outrank every node still waiting in the queue, so they must not be
+  // evicted to make room for those.
+  const size_t existingNodeCount = this->_loadedNodeIds.size();
 
   if (this->_pDataTextures) {
     // For all of the visible nodes...
@@ -584,54 +573,78 @@ void UCesiumVoxelRendererComponent::UpdateTiles(
       const VoxelTileUpdateInfo& currentTile = this->_visibleTileQueue.top();
       const CesiumGeometry::OctreeTileID& currentTileId =
           currentTile.pComponent->TileId;
-      FVoxelOctree::Node* pNode = this->_pOctree->getNode(currentTileId);
+      if (currentTile.pComponent->IsEmpty) {
+        // Empty tiles have nothing to sample, so they don't need a slot in the
+        // data textures.
+        this->_needsOctreeUpdate |= this->_pOctree->createNode(currentTileId);
+        this->_pOctree->getNode(currentTileId)->lastKnownScreenSpaceError =
+            currentTile.sse;
+        if (this->_pOctree->setNodeEmpty(currentTileId)) {
+          this->_emptyNodeIds.push_back(currentTileId);
+          this->_needsOctreeUpdate = true;
+        }
+        continue;
+      }
+
+      const FVoxelOctree::Node* pNode = this->_pOctree->getNode(currentTileId);
       if (pNode && pNode->dataIndex >= 0) {
         // Node has already been loaded into the data textures.
-        pNode->isDataReady =
-            this->_pDataTextures->isSlotLoaded(pNode->dataIndex);
+        this->_needsOctreeUpdate |= this->_pOctree->setNodeData(
+            currentTileId,
+            pNode->dataIndex,
+            this->_pDataTextures->isSlotLoaded(pNode->dataIndex));
+        continue;
+      }
+
+      if (this->_pDataTextures->isStagingFull()) {
+        // Earlier tiles are still being uploaded, so wait to add this one
+        // rather than evicting a node to make room for it.
         continue;
       }
 
       // Otherwise, check that the data textures have the space to add it.
-      const UCesiumGltfVoxelComponent* pVoxel = currentTile.pComponent;
-      size_t addNodeIndex = 0;
+      UCesiumGltfVoxelComponent* pVoxel = currentTile.pComponent;
+      size_t addNodeIndex = this->_loadedNodeIds.size();
       if (this->_pDataTextures->isFull()) {
-        addNodeIndex = existingNodeCount - 1 - destroyedNodeCount;
-        if (addNodeIndex >= this->_loadedNodeIds.size()) {
+        const std::optional<size_t> evictedIndex = this->_evictionQueue.pop(
+            *this->_pOctree,
+            this->_loadedNodeIds,
+            existingNodeCount);
+        if (!evictedIndex) {
           // This happens when all of the previously loaded nodes have been
           // replaced with new ones.
           continue;
         }
 
-        destroyedNodeCount++;
+        addNodeIndex = *evictedIndex;
 
-        const CesiumGeometry::OctreeTileID& lowestPriorityId =
+        const CesiumGeometry::OctreeTileID lowestPriorityId =
             this->_loadedNodeIds[addNodeIndex];
-        FVoxelOctree::Node* pLowestPriorityNode =
+        const FVoxelOctree::Node* pLowestPriorityNode =
             this->_pOctree->getNode(lowestPriorityId);
 
         // Release the data slot of the lowest priority node.
-        this->_pDataTextures->release(pLowestPriorityNode->dataIndex);
-        pLowestPriorityNode->dataIndex = -1;
-        pLowestPriorityNode->isDataReady = false;
-
-        // Attempt to remove the node and simplify the octree.
-        // Will not succeed if the node's siblings are renderable, or if this
-        // node contains renderable children.
-        this->_needsOctreeUpdate |=
-            this->_pOctree->removeNode(lowestPriorityId);
-      } else {
-        addNodeIndex = existingNodeCount + addedNodeCount;
-        addedNodeCount++;
+        if (pLowestPriorityNode) {
+          this->_pDataTextures->release(pLowestPriorityNode->dataIndex);
+          this->_needsOctreeUpdate |=
+              this->_pOctree->setNodeData(lowestPriorityId, -1, false);
+
+          // Attempt to remove the node and simplify the octree.
+          // Will not succeed if the node's siblings are renderable, or if this
+          // node contains renderable children.
+          this->_needsOctreeUpdate |=
+              this->_pOctree->removeNode(lowestPriorityId);
+        }
       }
 
       // Create the node if it does not already exist in the tree.
       bool createdNewNode = this->_pOctree->createNode(currentTileId);
-      pNode = this->_pOctree->getNode(currentTileId);
-      pNode->lastKnownScreenSpaceError = currentTile.sse;
+      this->_pOctree->getNode(currentTileId)->lastKnownScreenSpaceError =
+          currentTile.sse;
 
-      pNode->dataIndex = this->_pDataTextures->add(*pVoxel);
-      bool addedToDataTexture = (pNode->dataIndex >= 0);
+      const int64_t dataIndex = this->_pDataTextures->add(*pVoxel);
+      this->_pOctree->setNodeData(currentTileId, dataIndex, false);
+      bool addedToDataTexture = (dataIndex >= 0);
       this->_needsOctreeUpdate |= createdNewNode || addedToDataTexture;
 
       if (!addedToDataTexture) {
@@ -643,6 +656,10 @@ void UCesiumVoxelRendererComponent::UpdateTiles(
       }
     }
 
+    this->_needsOctreeUpdate |= this->pruneEmptyNodes(
+        this->_pDataTextures->getMaximumTileCount());
+
+    this->_pDataTextures->submitUploads();
     this->_needsOctreeUpdate |= this->_pDataTextures->pollLoadingSlots();
   } else {
     // If there are no data textures, then for all of the visible nodes...
@@ -657,8 +674,8 @@ void UCesiumVoxelRendererComponent::UpdateTiles(
       pNode->lastKnownScreenSpaceError = currentTile.sse;
       // Set to arbitrary index. This will prompt the tile to render even
       // though it does not actually have data.
-      pNode->dataIndex = 0;
-      pNode->isDataReady = true;
+      this->_needsOctreeUpdate |=
+          this->_pOctree->setNodeData(currentTileId, 0, true);
     }
   }
 
@@ -667,6 +684,49 @@ void UCesiumVoxelRendererComponent::UpdateTiles(
   }
 }
 
+bool UCesiumVoxelRendererComponent::pruneEmptyNodes(size_t maximumCount) {
+  // Forget the nodes that have since been removed from the octree, such as
+  // along with a sibling that was evicted.
+  std::erase_if(
+      this->_emptyNodeIds,
+      [&octree = *this->_pOctree](const CesiumGeometry::OctreeTileID& tileId) {
+        const FVoxelOctree::Node* pNode = octree.getNode(tileId);
+        return !pNode || !pNode->isEmpty;
+      });
+
+  if (this->_emptyNodeIds.size() <= maximumCount) {
+    return false;
+  }
+
+  // Remove the lowest priority empty nodes until few enough remain. A node
+  // can't be removed while one of its siblings is renderable, in which case
+  // it stays in the list to be tried again later.
+  this->_evictionQueue.reset();
+  const size_t candidateCount = this->_emptyNodeIds.size();
+  std::vector<size_t> removedIndices;
+  while (candidateCount - removedIndices.size() > maximumCount) {
+    const std::optional<size_t> index = this->_evictionQueue.pop(
+        *this->_pOctree,
+        this->_emptyNodeIds,
+        candidateCount);
+    if (!index) {
+      break;
+    }
+    if (this->_pOctree->removeNode(this->_emptyNodeIds[*index])) {
+      removedIndices.push_back(*index);
+    }
+  }
+
+  // Removing from the back first keeps the remaining indices valid.
+  std::sort(removedIndices.begin(), removedIndices.end(), std::greater<>());
+  for (size_t index : removedIndices) {
+    std::swap(this->_emptyNodeIds[index], this->_emptyNodeIds.back());
+    this->_emptyNodeIds.pop_back();
+  }
+
+  return !removedIndices.empty();
+}
+
 void UCesiumVoxelRendererComponent::UpdateTransformFromCesium(
     const glm::dmat4& CesiumToUnrealTransform) {
   FTransform transform = FTransform(VecMath::createMatrix(
@@ -100,7 +100,7 @@ private:
       const Cesium3DTilesSelection::BoundingVolume& boundingVolume);
 
   struct VoxelTileUpdateInfo {
-    const UCesiumGltfVoxelComponent* pComponent;
+    UCesiumGltfVoxelComponent* pComponent;
     double sse;
   };
 
@@ -117,6 +117,15 @@ private:
       std::vector<VoxelTileUpdateInfo>,
       PriorityLessComparator>;
 
+  /**
+   * Removes the lowest priority empty nodes from the octree until at most the
+   * given number remain. Empty nodes don't occupy the data textures, but they
+   * and the ancestors created for them occupy the octree texture.
+   *
+   * @return Whether the octree changed.
+   */
+  bool pruneEmptyNodes(size_t maximumCount);
+
   /**
    * The mesh used to render the voxels.
    */
@@ -124,6 +133,12 @@ private:
   TUniquePtr<FVoxelOctree> _pOctree;
   TUniquePtr<FVoxelMegatextures> _pDataTextures;
   std::vector<CesiumGeometry::OctreeTileID> _loadedNodeIds;
+  /**
+   * The nodes marked empty in the octree, which are not in _loadedNodeIds
+   * because they have no data.
+   */
+  std::vector<CesiumGeometry::OctreeTileID> _emptyNodeIds;
+  FVoxelEvictionQueue _evictionQueue;
   MaxPriorityQueue _visibleTileQueue;
   bool _needsOctreeUpdate;
 };
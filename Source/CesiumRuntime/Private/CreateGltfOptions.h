@@ -43,6 +43,19 @@ struct CreateModelOptions {
    */
   bool alwaysIncludeTangents = false;
 
+  /**
+   * Whether generated tangents should be averaged onto the model's shared
+   * vertices, rather than computed on a copy of the model with un-indexed
+   * vertices.
+   */
+  bool shareVerticesForGeneratedTangents = false;
+
+  /**
+   * Whether to use 16-bit texture coordinates for primitives that do not need
+   * full precision for feature IDs.
+   */
+  bool useCompactTextureCoordinates = false;
+
   /**
    * Whether to create physics meshes for the model.
    */
@@ -73,6 +86,9 @@ public:
         pEncodedMetadataDescription_DEPRECATED(
             other.pEncodedMetadataDescription_DEPRECATED),
         alwaysIncludeTangents(other.alwaysIncludeTangents),
+        shareVerticesForGeneratedTangents(
+            other.shareVerticesForGeneratedTangents),
+        useCompactTextureCoordinates(other.useCompactTextureCoordinates),
         createPhysicsMeshes(other.createPhysicsMeshes),
         ignoreKhrMaterialsUnlit(other.ignoreKhrMaterialsUnlit),
         pVoxelOptions(other.pVoxelOptions),
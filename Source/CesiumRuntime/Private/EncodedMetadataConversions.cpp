@@ -7,9 +7,12 @@
 #include "CesiumPropertyArrayBlueprintLibrary.h"
 #include "CesiumPropertyTableProperty.h"
 #include <CesiumGltf/MetadataConversions.h>
+#include <CesiumGltf/PropertyTypeTraits.h>
 
 #include <algorithm>
+#include <any>
 #include <stdexcept>
+#include <type_traits>
 
 namespace {
 template <typename T>
@@ -217,6 +220,220 @@ void coerceAndEncodeVec4s(
     pWritePos += pixelSize;
   }
 }
+
+/**
+ * Encodes the values of a scalar property view, converting them directly from
+ * their raw type to the encoded type. Equivalent to
+ * {@link coerceAndEncodeScalars}, but without boxing each value.
+ */
+template <typename T, typename TView>
+void encodeTypedScalars(
+    const TView& view,
+    const std::span<std::byte>& textureData) {
+  using TRaw = std::decay_t<decltype(view.getRaw(0))>;
+
+  const int64 propertySize = view.size();
+  if (textureData.size() < propertySize * sizeof(T)) {
+    throw std::runtime_error(
+        "Buffer is too small to store the data of this property.");
+  }
+
+  T* pWritePos = reinterpret_cast<T*>(textureData.data());
+  for (int64 i = 0; i < propertySize; ++i) {
+    pWritePos[i] = CesiumGltf::MetadataConversions<T, TRaw>::convert(
+                       view.getRaw(i))
+                       .value_or(T(0));
+  }
+}
+
+/**
+ * Encodes the values of a scalar or vecN property view as vecNs. Each value
+ * is first converted to TIntermediate, then component-wise to T, which matches
+ * the conversions made by {@link coerceAndEncodeVec2s} and the like through
+ * FCesiumMetadataValue.
+ */
+template <typename T, typename TIntermediate, typename TView>
+void encodeTypedVecNs(
+    const TView& view,
+    const std::span<std::byte>& textureData,
+    size_t pixelSize) {
+  using TRaw = std::decay_t<decltype(view.getRaw(0))>;
+  using TIntermediateComponent = typename TIntermediate::value_type;
+  constexpr glm::length_t N = TIntermediate::length();
+
+  const int64 propertySize = view.size();
+  if (textureData.size() < propertySize * N * sizeof(T)) {
+    throw std::runtime_error(
+        "Buffer is too small to store the data of this property.");
+  }
+
+  uint8* pWritePos = reinterpret_cast<uint8*>(textureData.data());
+  for (int64 i = 0; i < propertySize; ++i) {
+    const TIntermediate value =
+        CesiumGltf::MetadataConversions<TIntermediate, TRaw>::convert(
+            view.getRaw(i))
+            .value_or(TIntermediate(0));
+
+    if constexpr (std::is_same_v<T, uint8>) {
+      for (glm::length_t j = 0; j < N; ++j) {
+        pWritePos[j] =
+            CesiumGltf::MetadataConversions<uint8, TIntermediateComponent>::
+                convert(value[j])
+                    .value_or(0);
+      }
+    } else if constexpr (std::is_same_v<T, float>) {
+      // Floats are encoded backwards (e.g., ABGR)
+      float* pWritePosF = reinterpret_cast<float*>(pWritePos + pixelSize) - 1;
+      for (glm::length_t j = 0; j < N; ++j) {
+        *pWritePosF =
+            CesiumGltf::MetadataConversions<float, TIntermediateComponent>::
+                convert(value[j])
+                    .value_or(0.0f);
+        --pWritePosF;
+      }
+    }
+
+    pWritePos += pixelSize;
+  }
+}
+
+template <typename T, typename TView>
+void encodeTypedView(
+    ECesiumEncodedMetadataType type,
+    const TView& view,
+    const std::span<std::byte>& textureData,
+    size_t pixelSize) {
+  constexpr bool isUint8 = std::is_same_v<T, uint8>;
+  switch (type) {
+  case ECesiumEncodedMetadataType::Scalar:
+    encodeTypedScalars<T>(view, textureData);
+    break;
+  case ECesiumEncodedMetadataType::Vec2:
+    encodeTypedVecNs<T, std::conditional_t<isUint8, glm::ivec2, glm::dvec2>>(
+        view,
+        textureData,
+        pixelSize);
+    break;
+  case ECesiumEncodedMetadataType::Vec3:
+    encodeTypedVecNs<T, std::conditional_t<isUint8, glm::ivec3, glm::vec3>>(
+        view,
+        textureData,
+        pixelSize);
+    break;
+  case ECesiumEncodedMetadataType::Vec4:
+    encodeTypedVecNs<T, glm::dvec4>(view, textureData, pixelSize);
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * Performs the callback on the PropertyTablePropertyView<TValue> contained in
+ * the std::any, if any.
+ *
+ * @return Whether the std::any contained a view of the expected type.
+ */
+template <typename TValue, typename Callback>
+bool typedViewCallback(
+    const std::any& property,
+    bool normalized,
+    Callback&& callback) {
+  if constexpr (CesiumGltf::CanBeNormalized<TValue>::value) {
+    if (normalized) {
+      const auto* pView =
+          std::any_cast<CesiumGltf::PropertyTablePropertyView<TValue, true>>(
+              &property);
+      if (!pView) {
+        return false;
+      }
+      callback(*pView);
+      return true;
+    }
+  }
+
+  const auto* pView =
+      std::any_cast<CesiumGltf::PropertyTablePropertyView<TValue, false>>(
+          &property);
+  if (!pView) {
+    return false;
+  }
+  callback(*pView);
+  return true;
+}
+
+template <typename TComponent, typename Callback>
+bool typedValueCallback(
+    const std::any& property,
+    ECesiumMetadataType type,
+    bool normalized,
+    Callback&& callback) {
+  switch (type) {
+  case ECesiumMetadataType::Scalar:
+  case ECesiumMetadataType::Enum:
+    return typedViewCallback<TComponent>(property, normalized, callback);
+  case ECesiumMetadataType::Vec2:
+    return typedViewCallback<glm::vec<2, TComponent>>(
+        property,
+        normalized,
+        callback);
+  case ECesiumMetadataType::Vec3:
+    return typedViewCallback<glm::vec<3, TComponent>>(
+        property,
+        normalized,
+        callback);
+  case ECesiumMetadataType::Vec4:
+    return typedViewCallback<glm::vec<4, TComponent>>(
+        property,
+        normalized,
+        callback);
+  default:
+    return false;
+  }
+}
+
+/**
+ * Performs the callback on the typed PropertyTablePropertyView contained in
+ * the std::any, if it is a non-array scalar or vecN view.
+ *
+ * @return Whether the callback was performed.
+ */
+template <typename Callback>
+bool typedPropertyCallback(
+    const std::any& property,
+    const FCesiumMetadataValueType& valueType,
+    bool normalized,
+    Callback&& callback) {
+  if (valueType.bIsArray) {
+    return false;
+  }
+
+  const ECesiumMetadataType type = valueType.Type;
+  switch (valueType.ComponentType) {
+  case ECesiumMetadataComponentType::Int8:
+    return typedValueCallback<int8_t>(property, type, normalized, callback);
+  case ECesiumMetadataComponentType::Uint8:
+    return typedValueCallback<uint8_t>(property, type, normalized, callback);
+  case ECesiumMetadataComponentType::Int16:
+    return typedValueCallback<int16_t>(property, type, normalized, callback);
+  case ECesiumMetadataComponentType::Uint16:
+    return typedValueCallback<uint16_t>(property, type, normalized, callback);
+  case ECesiumMetadataComponentType::Int32:
+    return typedValueCallback<int32_t>(property, type, normalized, callback);
+  case ECesiumMetadataComponentType::Uint32:
+    return typedValueCallback<uint32_t>(property, type, normalized, callback);
+  case ECesiumMetadataComponentType::Int64:
+    return typedValueCallback<int64_t>(property, type, normalized, callback);
+  case ECesiumMetadataComponentType::Uint64:
+    return typedValueCallback<uint64_t>(property, type, normalized, callback);
+  case ECesiumMetadataComponentType::Float32:
+    return typedValueCallback<float>(property, type, false, callback);
+  case ECesiumMetadataComponentType::Float64:
+    return typedValueCallback<double>(property, type, false, callback);
+  default:
+    return false;
+  }
+}
 } // namespace
 
 bool CesiumEncodedMetadataCoerce::canEncode(
@@ -286,6 +503,14 @@ void CesiumEncodedMetadataCoerce::encode(
     return;
   }
 
+  if (encodeTypedValues(
+          propertyDescription,
+          property,
+          textureData,
+          pixelSize)) {
+    return;
+  }
+
   if (propertyDescription.EncodingDetails.ComponentType ==
       ECesiumEncodedMetadataComponentType::Uint8) {
     switch (propertyDescription.EncodingDetails.Type) {
@@ -326,6 +551,41 @@ void CesiumEncodedMetadataCoerce::encode(
   }
 }
 
+bool CesiumEncodedMetadataCoerce::encodeTypedValues(
+    const FCesiumPropertyTablePropertyDescription& propertyDescription,
+    const FCesiumPropertyTableProperty& property,
+    const std::span<std::byte>& textureData,
+    size_t pixelSize) {
+  if (property._status != ECesiumPropertyTablePropertyStatus::Valid) {
+    // Empty properties with default values are encoded as zeros by the generic
+    // path.
+    return false;
+  }
+
+  const ECesiumEncodedMetadataType type =
+      propertyDescription.EncodingDetails.Type;
+  switch (propertyDescription.EncodingDetails.ComponentType) {
+  case ECesiumEncodedMetadataComponentType::Uint8:
+    return typedPropertyCallback(
+        property._property,
+        property._valueType,
+        property._normalized,
+        [type, &textureData, pixelSize](const auto& view) {
+          encodeTypedView<uint8>(type, view, textureData, pixelSize);
+        });
+  case ECesiumEncodedMetadataComponentType::Float:
+    return typedPropertyCallback(
+        property._property,
+        property._valueType,
+        property._normalized,
+        [type, &textureData, pixelSize](const auto& view) {
+          encodeTypedView<float>(type, view, textureData, pixelSize);
+        });
+  default:
+    return false;
+  }
+}
+
 namespace {
 /**
  * @param hexString The string containing the hex code color, including the #
@@ -51,6 +51,23 @@ struct CesiumEncodedMetadataCoerce {
       const FCesiumPropertyTableProperty& property,
       const std::span<std::byte>& pTextureData,
       size_t pixelSize);
+
+private:
+  /**
+   * Encodes a numeric scalar or vecN property by converting its values
+   * directly from the underlying typed property view, instead of accessing
+   * them one-by-one through {@link FCesiumMetadataValue}. The view type is
+   * resolved once for the whole column.
+   *
+   * @return True if the property was encoded, or false if it must be encoded
+   * through the generic path instead (e.g., arrays, strings, booleans, or
+   * properties that are not valid).
+   */
+  static bool encodeTypedValues(
+      const FCesiumPropertyTablePropertyDescription& propertyDescription,
+      const FCesiumPropertyTableProperty& property,
+      const std::span<std::byte>& textureData,
+      size_t pixelSize);
 };
 
 /**
@@ -65,6 +65,13 @@ struct LoadedPrimitiveResult {
    */
   std::optional<int32_t> voxelPropertyAttributeIndex;
 
+  /**
+   * Whether every voxel in the primitive has no value for every property,
+   * i.e., each value is the property's "no data" value and the property has
+   * no default value.
+   */
+  bool isVoxelTileEmpty = false;
+
   /**
    * If the primitive contains the `EXT_mesh_primitive_edge_visibility`
    * extension, this will contain the data to create a derived
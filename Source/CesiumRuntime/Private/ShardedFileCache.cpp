@@ -0,0 +1,570 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "ShardedFileCache.h"
+#include "Async/Async.h"
+#include "CesiumRuntime.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <CesiumAsync/CacheItem.h>
+THIRD_PARTY_INCLUDES_END
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+using namespace CesiumAsync;
+
+namespace {
+
+constexpr uint32 EntryMagic = 0x43534643; // "CSFC"
+constexpr uint32 EntryVersion = 2;
+
+// The magic number, version, and expiry time at the start of every entry file.
+constexpr int64 EntryHeaderBytes =
+    sizeof(uint32) + sizeof(uint32) + sizeof(int64);
+
+uint64 hashKey(const std::string& key) {
+  return CityHash64(key.data(), uint32(key.size()));
+}
+
+FString createTemporaryFilename(const FString& filename) {
+  return filename + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+}
+
+// Deletes the renamed files of removed entries. This is done without holding
+// the shard's lock, so that lookups in the shard don't wait for large files to
+// be deleted.
+void deleteFiles(const std::vector<FString>& filenames) {
+  IFileManager& fileManager = IFileManager::Get();
+  for (const FString& filename : filenames) {
+    fileManager.Delete(*filename, false, false, true);
+  }
+}
+
+class EntryWriter {
+public:
+  void writeUInt16(uint16 value) { this->writeRaw(&value, sizeof(value)); }
+  void writeUInt32(uint32 value) { this->writeRaw(&value, sizeof(value)); }
+  void writeInt64(int64 value) { this->writeRaw(&value, sizeof(value)); }
+  void writeUInt64(uint64 value) { this->writeRaw(&value, sizeof(value)); }
+
+  void writeString(const std::string& value) {
+    this->writeUInt32(uint32(value.size()));
+    this->writeRaw(value.data(), value.size());
+  }
+
+  void writeHeaders(const HttpHeaders& headers) {
+    this->writeUInt32(uint32(headers.size()));
+    for (const auto& [key, value] : headers) {
+      this->writeString(key);
+      this->writeString(value);
+    }
+  }
+
+  void writeBytes(const std::span<const std::byte>& bytes) {
+    this->writeUInt64(uint64(bytes.size()));
+    this->writeRaw(bytes.data(), bytes.size());
+  }
+
+  TArray64<uint8>& buffer() { return this->_buffer; }
+
+private:
+  void writeRaw(const void* pData, size_t size) {
+    this->_buffer.Append(static_cast<const uint8*>(pData), int64(size));
+  }
+
+  TArray64<uint8> _buffer;
+};
+
+class EntryReader {
+public:
+  EntryReader(const TArray64<uint8>& buffer)
+      : _pCurrent(buffer.GetData()), _pEnd(buffer.GetData() + buffer.Num()) {}
+
+  bool readUInt16(uint16& value) {
+    return this->readRaw(&value, sizeof(value));
+  }
+  bool readUInt32(uint32& value) {
+    return this->readRaw(&value, sizeof(value));
+  }
+  bool readInt64(int64& value) { return this->readRaw(&value, sizeof(value)); }
+  bool readUInt64(uint64& value) {
+    return this->readRaw(&value, sizeof(value));
+  }
+
+  bool readString(std::string& value) {
+    uint32 size;
+    if (!this->readUInt32(size) || !this->hasRemaining(size)) {
+      return false;
+    }
+    value.assign(reinterpret_cast<const char*>(this->_pCurrent), size);
+    this->_pCurrent += size;
+    return true;
+  }
+
+  bool readHeaders(HttpHeaders& headers) {
+    uint32 count;
+    if (!this->readUInt32(count)) {
+      return false;
+    }
+    for (uint32 i = 0; i < count; ++i) {
+      std::string key;
+      std::string value;
+      if (!this->readString(key) || !this->readString(value)) {
+        return false;
+      }
+      headers.emplace(std::move(key), std::move(value));
+    }
+    return true;
+  }
+
+  bool readBytes(std::vector<std::byte>& bytes) {
+    uint64 size;
+    if (!this->readUInt64(size) || !this->hasRemaining(size)) {
+      return false;
+    }
+    bytes.resize(size_t(size));
+    std::memcpy(bytes.data(), this->_pCurrent, size_t(size));
+    this->_pCurrent += size;
+    return true;
+  }
+
+  bool isAtEnd() const { return this->_pCurrent == this->_pEnd; }
+
+private:
+  bool hasRemaining(uint64 size) const {
+    return uint64(this->_pEnd - this->_pCurrent) >= size;
+  }
+
+  bool readRaw(void* pData, size_t size) {
+    if (!this->hasRemaining(size)) {
+      return false;
+    }
+    std::memcpy(pData, this->_pCurrent, size);
+    this->_pCurrent += size;
+    return true;
+  }
+
+  const uint8* _pCurrent;
+  const uint8* _pEnd;
+};
+
+bool readHeader(EntryReader& reader, int64& expiryTime) {
+  uint32 magic;
+  uint32 version;
+  return reader.readUInt32(magic) && magic == EntryMagic &&
+         reader.readUInt32(version) && version == EntryVersion &&
+         reader.readInt64(expiryTime);
+}
+
+// Reads just the header of an entry file, to find its expiry time without
+// reading the whole response.
+std::optional<std::time_t> readExpiryTime(const TCHAR* filename) {
+  IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+  TUniquePtr<IFileHandle> pHandle(platformFile.OpenRead(filename));
+  if (!pHandle) {
+    return std::nullopt;
+  }
+
+  TArray64<uint8> buffer;
+  buffer.SetNumUninitialized(EntryHeaderBytes);
+  if (!pHandle->Read(buffer.GetData(), EntryHeaderBytes)) {
+    return std::nullopt;
+  }
+
+  EntryReader reader(buffer);
+  int64 expiryTime;
+  if (!readHeader(reader, expiryTime)) {
+    return std::nullopt;
+  }
+
+  return std::time_t(expiryTime);
+}
+
+std::optional<CacheItem>
+readEntry(const TArray64<uint8>& buffer, const std::string& expectedKey) {
+  EntryReader reader(buffer);
+
+  int64 expiryTime;
+  if (!readHeader(reader, expiryTime)) {
+    return std::nullopt;
+  }
+
+  std::string key;
+  if (!reader.readString(key) || key != expectedKey) {
+    return std::nullopt;
+  }
+
+  std::string url;
+  std::string method;
+  uint16 statusCode;
+  HttpHeaders requestHeaders;
+  HttpHeaders responseHeaders;
+  std::vector<std::byte> data;
+  if (!reader.readString(url) || !reader.readString(method) ||
+      !reader.readUInt16(statusCode) || !reader.readHeaders(requestHeaders) ||
+      !reader.readHeaders(responseHeaders) || !reader.readBytes(data) ||
+      !reader.isAtEnd()) {
+    return std::nullopt;
+  }
+
+  return CacheItem(
+      std::time_t(expiryTime),
+      CacheRequest(
+          std::move(requestHeaders),
+          std::move(method),
+          std::move(url)),
+      CacheResponse(statusCode, std::move(responseHeaders), std::move(data)));
+}
+
+} // namespace
+
+ShardedFileCache::ShardedFileCache(const FString& directory, int64 maximumBytes)
+    : _directory(directory),
+      _maximumBytes(maximumBytes),
+      _creationTime(FDateTime::UtcNow()),
+      _shards(),
+      _totalBytes(0),
+      _scan() {
+  IFileManager& fileManager = IFileManager::Get();
+  for (size_t i = 0; i < ShardCount; ++i) {
+    Shard& shard = this->_shards[i];
+    shard.directory = FPaths::Combine(
+        this->_directory,
+        FString::Printf(TEXT("shard-%02d"), int32(i)));
+    fileManager.MakeDirectory(*shard.directory, true);
+  }
+
+  UE_LOG(
+      LogCesium,
+      Display,
+      TEXT("Caching Cesium requests in %s"),
+      *this->_directory);
+
+  // Discover the existing entries without blocking the first lookups.
+  this->_scan = AsyncPool(*GIOThreadPool, [this]() {
+    for (Shard& shard : this->_shards) {
+      this->scanShard(shard);
+    }
+  });
+}
+
+ShardedFileCache::~ShardedFileCache() { this->waitUntilScanned(); }
+
+std::optional<CacheItem>
+ShardedFileCache::getEntry(const std::string& key) const {
+  const uint64 hash = hashKey(key);
+  Shard& shard = this->getShard(hash);
+
+  {
+    FScopeLock lock(&shard.lock);
+    if (shard.entries.find(hash) == shard.entries.end()) {
+      // A miss never touches the disk.
+      return std::nullopt;
+    }
+  }
+
+  TArray64<uint8> buffer;
+  std::optional<CacheItem> result;
+  if (FFileHelper::LoadFileToArray(
+          buffer,
+          *this->getEntryFilename(shard, hash),
+          FILEREAD_Silent)) {
+    result = readEntry(buffer, key);
+  }
+
+  std::vector<FString> filesToDelete;
+  {
+    FScopeLock lock(&shard.lock);
+    auto it = shard.entries.find(hash);
+    if (it == shard.entries.end()) {
+      return result;
+    }
+
+    if (result) {
+      it->second.expiryTime = result->expiryTime;
+      this->touch(shard, it->second);
+    } else {
+      // The file is missing, truncated, or belongs to a different key with
+      // the same hash. Either way, it is of no further use.
+      this->remove(shard, hash, filesToDelete);
+    }
+  }
+
+  deleteFiles(filesToDelete);
+
+  return result;
+}
+
+bool ShardedFileCache::storeEntry(
+    const std::string& key,
+    std::time_t expiryTime,
+    const std::string& url,
+    const std::string& requestMethod,
+    const HttpHeaders& requestHeaders,
+    uint16_t statusCode,
+    const HttpHeaders& responseHeaders,
+    const std::span<const std::byte>& responseData) {
+  const uint64 hash = hashKey(key);
+  Shard& shard = this->getShard(hash);
+
+  EntryWriter writer;
+  writer.writeUInt32(EntryMagic);
+  writer.writeUInt32(EntryVersion);
+  writer.writeInt64(int64(expiryTime));
+  writer.writeString(key);
+  writer.writeString(url);
+  writer.writeString(requestMethod);
+  writer.writeUInt16(statusCode);
+  writer.writeHeaders(requestHeaders);
+  writer.writeHeaders(responseHeaders);
+  writer.writeBytes(responseData);
+
+  const int64 bytes = writer.buffer().Num();
+
+  // Write to a uniquely-named temporary file without holding the lock, and
+  // then move it into place, so that a concurrent reader never sees a
+  // partially-written entry.
+  const FString filename = this->getEntryFilename(shard, hash);
+  const FString temporaryFilename = createTemporaryFilename(filename);
+  IFileManager& fileManager = IFileManager::Get();
+  if (!FFileHelper::SaveArrayToFile(writer.buffer(), *temporaryFilename)) {
+    fileManager.Delete(*temporaryFilename, false, false, true);
+    return false;
+  }
+
+  std::vector<FString> filesToDelete;
+  {
+    FScopeLock lock(&shard.lock);
+
+    if (!fileManager
+             .Move(*filename, *temporaryFilename, true, true, false, true)) {
+      fileManager.Delete(*temporaryFilename, false, false, true);
+      return false;
+    }
+
+    auto [it, added] = shard.entries.try_emplace(hash);
+    Entry& entry = it->second;
+    if (added) {
+      entry.lruPosition = shard.lru.insert(shard.lru.end(), hash);
+    } else {
+      shard.bytes -= entry.bytes;
+      this->_totalBytes -= entry.bytes;
+      this->touch(shard, entry);
+    }
+
+    entry.bytes = bytes;
+    entry.expiryTime = expiryTime;
+    shard.bytes += bytes;
+    this->_totalBytes += bytes;
+
+    this->evict(shard, this->_maximumBytes / int64(ShardCount), filesToDelete);
+  }
+
+  deleteFiles(filesToDelete);
+
+  return true;
+}
+
+bool ShardedFileCache::prune() {
+  const std::time_t now = std::time(nullptr);
+  const int64 budget = this->_maximumBytes / int64(ShardCount);
+
+  for (Shard& shard : this->_shards) {
+    std::vector<FString> filesToDelete;
+    {
+      FScopeLock lock(&shard.lock);
+
+      std::vector<uint64> expired;
+      for (const auto& [hash, entry] : shard.entries) {
+        if (entry.expiryTime < now) {
+          expired.push_back(hash);
+        }
+      }
+
+      for (uint64 hash : expired) {
+        this->remove(shard, hash, filesToDelete);
+      }
+
+      this->evict(shard, budget, filesToDelete);
+    }
+
+    deleteFiles(filesToDelete);
+  }
+
+  return true;
+}
+
+bool ShardedFileCache::clearAll() {
+  // Otherwise the scan could add back entries whose files are deleted here.
+  this->waitUntilScanned();
+
+  IFileManager& fileManager = IFileManager::Get();
+  bool success = true;
+
+  for (Shard& shard : this->_shards) {
+    FScopeLock lock(&shard.lock);
+
+    success &= fileManager.DeleteDirectory(*shard.directory, false, true);
+    fileManager.MakeDirectory(*shard.directory, true);
+
+    this->_totalBytes -= shard.bytes;
+    shard.entries.clear();
+    shard.lru.clear();
+    shard.bytes = 0;
+  }
+
+  return success;
+}
+
+int64 ShardedFileCache::getTotalBytes() const noexcept {
+  return this->_totalBytes.load();
+}
+
+void ShardedFileCache::waitUntilScanned() const {
+  if (this->_scan.IsValid()) {
+    this->_scan.Wait();
+  }
+}
+
+ShardedFileCache::Shard& ShardedFileCache::getShard(uint64 hash) const {
+  // The low bits of the hash pick the shard.
+  return this->_shards[size_t(hash % ShardCount)];
+}
+
+void ShardedFileCache::scanShard(Shard& shard) {
+  struct FoundEntry {
+    uint64 hash;
+    int64 bytes;
+    std::time_t expiryTime;
+    FDateTime modified;
+  };
+
+  std::vector<FoundEntry> found;
+  TArray<FString> filesToDelete;
+
+  IFileManager& fileManager = IFileManager::Get();
+  fileManager.IterateDirectoryStat(
+      *shard.directory,
+      [this, &found, &filesToDelete](
+          const TCHAR* path,
+          const FFileStatData& stat) {
+        if (stat.bIsDirectory) {
+          return true;
+        }
+
+        FString filename = FPaths::GetCleanFilename(path);
+        if (filename.EndsWith(TEXT(".tmp"))) {
+          // Temporary files from before this cache was created were left
+          // behind by a process that exited while writing or deleting them.
+          // Newer ones belong to stores and removals in progress.
+          if (stat.ModificationTime < this->_creationTime) {
+            filesToDelete.Add(path);
+          }
+        } else if (filename.EndsWith(TEXT(".bin"))) {
+          std::optional<std::time_t> maybeExpiryTime = readExpiryTime(path);
+          if (maybeExpiryTime) {
+            found.push_back(FoundEntry{
+                FCString::Strtoui64(*filename, nullptr, 16),
+                stat.FileSize,
+                *maybeExpiryTime,
+                stat.ModificationTime});
+          } else {
+            // Truncated, or written by an older version of the cache.
+            filesToDelete.Add(path);
+          }
+        }
+        return true;
+      });
+
+  for (const FString& path : filesToDelete) {
+    fileManager.Delete(*path, false, false, true);
+  }
+
+  std::sort(
+      found.begin(),
+      found.end(),
+      [](const FoundEntry& a, const FoundEntry& b) {
+        return a.modified < b.modified;
+      });
+
+  std::vector<FString> evictedFiles;
+  {
+    FScopeLock lock(&shard.lock);
+
+    // Entries stored since the cache was created are newer than anything
+    // found on disk, so they stay at the most-recently-used end.
+    auto insertPosition = shard.lru.begin();
+    for (const FoundEntry& foundEntry : found) {
+      auto [it, added] = shard.entries.try_emplace(foundEntry.hash);
+      if (!added) {
+        continue;
+      }
+
+      it->second.bytes = foundEntry.bytes;
+      it->second.expiryTime = foundEntry.expiryTime;
+      it->second.lruPosition =
+          shard.lru.insert(insertPosition, foundEntry.hash);
+      shard.bytes += foundEntry.bytes;
+      this->_totalBytes += foundEntry.bytes;
+    }
+
+    this->evict(shard, this->_maximumBytes / int64(ShardCount), evictedFiles);
+  }
+
+  deleteFiles(evictedFiles);
+}
+
+FString
+ShardedFileCache::getEntryFilename(const Shard& shard, uint64 hash) const {
+  return FPaths::Combine(
+      shard.directory,
+      FString::Printf(TEXT("%016llx.bin"), (unsigned long long)hash));
+}
+
+void ShardedFileCache::touch(Shard& shard, Entry& entry) const {
+  shard.lru.splice(shard.lru.end(), shard.lru, entry.lruPosition);
+}
+
+void ShardedFileCache::remove(
+    Shard& shard,
+    uint64 hash,
+    std::vector<FString>& filesToDelete) const {
+  auto it = shard.entries.find(hash);
+  if (it == shard.entries.end()) {
+    return;
+  }
+
+  // Move the file out of the way while still holding the lock, so that a
+  // store of the same key that takes the lock next writes a file that stays.
+  IFileManager& fileManager = IFileManager::Get();
+  const FString filename = this->getEntryFilename(shard, hash);
+  const FString doomedFilename = createTemporaryFilename(filename);
+  if (fileManager.Move(*doomedFilename, *filename, true, true, false, true)) {
+    filesToDelete.push_back(doomedFilename);
+  } else {
+    fileManager.Delete(*filename, false, false, true);
+  }
+
+  shard.bytes -= it->second.bytes;
+  this->_totalBytes -= it->second.bytes;
+  shard.lru.erase(it->second.lruPosition);
+  shard.entries.erase(it);
+}
+
+void ShardedFileCache::evict(
+    Shard& shard,
+    int64 budget,
+    std::vector<FString>& filesToDelete) const {
+  while (shard.bytes > budget && !shard.lru.empty()) {
+    this->remove(shard, shard.lru.front(), filesToDelete);
+  }
+}
@@ -0,0 +1,118 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Async/Future.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Platform.h"
+#include "Misc/DateTime.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <CesiumAsync/ICacheDatabase.h>
+THIRD_PARTY_INCLUDES_END
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * An {@link CesiumAsync::ICacheDatabase} that stores each cached response in
+ * its own file, spread across a fixed number of independently-locked shards.
+ *
+ * Unlike `SqliteCache`, which serializes every read and write through a single
+ * database connection, requests that hash to different shards never contend
+ * with each other, and reading and writing entries happens outside of any
+ * lock. The cache is bounded by the total size of the stored responses rather
+ * than by the number of entries; the least-recently-used entries in a shard
+ * are evicted whenever that shard exceeds its share of the budget.
+ */
+class ShardedFileCache : public CesiumAsync::ICacheDatabase {
+public:
+  static constexpr size_t ShardCount = 16;
+
+  /**
+   * Creates a cache in the given directory, which is created if it does not
+   * exist. Existing entries are discovered by scanning the directory on a
+   * background thread. Until the scan finishes, lookups of entries it has not
+   * yet discovered miss.
+   *
+   * @param directory The directory in which to store the cache.
+   * @param maximumBytes The maximum total size of the cache files.
+   */
+  ShardedFileCache(const FString& directory, int64 maximumBytes);
+
+  virtual ~ShardedFileCache();
+
+  virtual std::optional<CesiumAsync::CacheItem>
+  getEntry(const std::string& key) const override;
+
+  virtual bool storeEntry(
+      const std::string& key,
+      std::time_t expiryTime,
+      const std::string& url,
+      const std::string& requestMethod,
+      const CesiumAsync::HttpHeaders& requestHeaders,
+      uint16_t statusCode,
+      const CesiumAsync::HttpHeaders& responseHeaders,
+      const std::span<const std::byte>& responseData) override;
+
+  virtual bool prune() override;
+
+  virtual bool clearAll() override;
+
+  /**
+   * Gets the total size in bytes of all entries currently in the cache.
+   */
+  int64 getTotalBytes() const noexcept;
+
+  /**
+   * Blocks until the entries that existed on disk when the cache was created
+   * have been discovered.
+   */
+  void waitUntilScanned() const;
+
+private:
+  struct Entry {
+    int64 bytes;
+    std::time_t expiryTime;
+    std::list<uint64>::iterator lruPosition;
+  };
+
+  struct Shard {
+    FString directory;
+    mutable FCriticalSection lock;
+    std::unordered_map<uint64, Entry> entries;
+    // Least recently used at the front.
+    std::list<uint64> lru;
+    int64 bytes = 0;
+  };
+
+  Shard& getShard(uint64 hash) const;
+  void scanShard(Shard& shard);
+  FString getEntryFilename(const Shard& shard, uint64 hash) const;
+
+  // These must be called with the shard's lock held. Removed entries are
+  // dropped from the index immediately, and their files are renamed to unique
+  // temporary names, which are added to `filesToDelete` to be deleted once
+  // the lock is released. Because entry files are only ever moved into or out
+  // of place while holding the lock, a concurrent store of the same key can
+  // never have its new file deleted.
+  void touch(Shard& shard, Entry& entry) const;
+  void
+  remove(Shard& shard, uint64 hash, std::vector<FString>& filesToDelete) const;
+  void
+  evict(Shard& shard, int64 budget, std::vector<FString>& filesToDelete) const;
+
+  FString _directory;
+  int64 _maximumBytes;
+  FDateTime _creationTime;
+  mutable std::array<Shard, ShardCount> _shards;
+  mutable std::atomic<int64> _totalBytes;
+  TFuture<void> _scan;
+};
@@ -7,6 +7,7 @@
 #include "CesiumGlobeAnchorComponent.h"
 #include "CesiumGltfComponent.h"
 #include "CesiumLoadTestCore.h"
+#include "CesiumRuntime.h"
 #include "CesiumSceneGeneration.h"
 #include "CesiumSunSky.h"
 #include "CesiumTestHelpers.h"
@@ -16,6 +17,8 @@
 #include "Misc/AutomationTest.h"
 #include "Tests/AutomationCommon.h"
 #include "Tests/AutomationTestSettings.h"
+#include "UnrealPrepareRendererResources.h"
+#include "UnrealTaskProcessor.h"
 #include <Cesium3DTilesSelection/TilesetSharedAssetSystem.h>
 #include <CesiumAsync/ICacheDatabase.h>
 
@@ -239,6 +242,74 @@ bool FCesium3DTilesetCameraManagerCameras::RunTest(const FString& Parameters) {
       TEST_SCREEN_HEIGHT);
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCesium3DTilesetVisibleLoadsUseVisibleLane,
+    "Cesium.Unit.3DTileset.VisibleLoadsUseVisibleLane",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+static uint64 visiblePreparationsBeforeLoad = 0;
+static uint64 preloadPreparationsBeforeLoad = 0;
+
+void visibleLanePass(
+    SceneGenerationContext& context,
+    TestPass::TestingParameter parameter) {
+  // Tileset updates are suspended until after this step, so every tile loaded
+  // in this pass is loaded while the tileset is in view.
+  visiblePreparationsBeforeLoad =
+      UnrealPrepareRendererResources::getLoadThreadPreparationCount(
+          UnrealTaskProcessor::Priority::Visible);
+  preloadPreparationsBeforeLoad =
+      UnrealPrepareRendererResources::getLoadThreadPreparationCount(
+          UnrealTaskProcessor::Priority::Preload);
+}
+
+bool checkVisibleLane(
+    SceneGenerationContext& creationContext,
+    SceneGenerationContext& playContext,
+    TestPass::TestingParameter parameter) {
+  // Without the worker pool, tasks go to the engine and have no lane.
+  if (getTaskProcessor()->getThreadCount() == 0) {
+    return true;
+  }
+
+  // The tile content in view was decoded in the visible lane, including the
+  // work continued from the completed network requests, and none of it fell
+  // back to the preload lane.
+  const uint64 visiblePreparations =
+      UnrealPrepareRendererResources::getLoadThreadPreparationCount(
+          UnrealTaskProcessor::Priority::Visible) -
+      visiblePreparationsBeforeLoad;
+  const uint64 preloadPreparations =
+      UnrealPrepareRendererResources::getLoadThreadPreparationCount(
+          UnrealTaskProcessor::Priority::Preload) -
+      preloadPreparationsBeforeLoad;
+
+  if (preloadPreparations > 0) {
+    UE_LOG(
+        LogCesium,
+        Error,
+        TEXT("%llu tile contents were decoded in the preload lane"),
+        preloadPreparations);
+    return true;
+  }
+
+  return visiblePreparations > 0;
+}
+
+bool FCesium3DTilesetVisibleLoadsUseVisibleLane::RunTest(
+    const FString& Parameters) {
+  std::vector<TestPass> testPasses;
+  testPasses.push_back(
+      TestPass{"Refresh Pass", visibleLanePass, checkVisibleLane});
+
+  return RunLoadTest(
+      GetBeautifiedTestName(),
+      setupForPhysicsWithSmallScale,
+      testPasses,
+      TEST_SCREEN_WIDTH,
+      TEST_SCREEN_HEIGHT);
+}
+
 } // namespace Cesium
 
 #endif
@@ -2,6 +2,7 @@
 
 #include "CesiumGeoJsonDocument.h"
 #include "CesiumGeoJsonObject.h"
+#include "CesiumGeoJsonSpatialIndex.h"
 #include "Misc/AutomationTest.h"
 
 BEGIN_DEFINE_SPEC(
@@ -154,4 +155,467 @@ void FCesiumGeoJsonDocumentSpec::Define() {
           "test2");
     });
   });
+
+  Describe("Spatial queries", [this]() {
+    // A square with a square hole, a line, and a point, each 10 degrees
+    // apart.
+    const FString SpatialDocument = R"==({
+        "type": "FeatureCollection",
+        "features": [
+          {
+            "type": "Feature",
+            "id": "square",
+            "properties": null,
+            "geometry": {
+              "type": "Polygon",
+              "coordinates": [
+                [[0, 0], [4, 0], [4, 4], [0, 4], [0, 0]],
+                [[1, 1], [1, 2], [2, 2], [2, 1], [1, 1]]
+              ]
+            }
+          },
+          {
+            "type": "Feature",
+            "id": "line",
+            "properties": null,
+            "geometry": {
+              "type": "LineString",
+              "coordinates": [[10, 0], [10, 4]]
+            }
+          },
+          {
+            "type": "Feature",
+            "id": "point",
+            "properties": null,
+            "geometry": { "type": "Point", "coordinates": [20, 2] }
+          },
+          { "type": "Feature", "id": "empty", "properties": null, "geometry": null }
+        ]
+      })==";
+
+    It("builds an index of features with geometry", [this, SpatialDocument]() {
+      FCesiumGeoJsonDocument Document;
+      TestTrue(
+          "LoadGeoJsonFromString Success",
+          UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
+              SpatialDocument,
+              Document));
+      TestFalse(
+          "HasSpatialIndex before building",
+          UCesiumGeoJsonDocumentBlueprintLibrary::HasSpatialIndex(Document));
+
+      UCesiumGeoJsonDocumentBlueprintLibrary::BuildSpatialIndex(Document);
+      TestTrue(
+          "HasSpatialIndex after building",
+          UCesiumGeoJsonDocumentBlueprintLibrary::HasSpatialIndex(Document));
+      TestEqual(
+          "feature count",
+          int64(Document.GetSpatialIndex()->getFeatureCount()),
+          int64(3));
+    });
+
+    It("finds polygons containing a position", [this, SpatialDocument]() {
+      FCesiumGeoJsonDocument Document;
+      UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
+          SpatialDocument,
+          Document);
+      UCesiumGeoJsonDocumentBlueprintLibrary::BuildSpatialIndex(Document);
+
+      TArray<FCesiumGeoJsonFeature> Features =
+          UCesiumGeoJsonDocumentBlueprintLibrary::FindFeaturesAtPosition(
+              Document,
+              FVector(3.0, 3.0, 0.0));
+      TestEqual("inside Num", Features.Num(), 1);
+      if (Features.Num() == 1) {
+        TestEqual(
+            "inside Id",
+            UCesiumGeoJsonFeatureBlueprintLibrary::GetIdAsString(Features[0]),
+            "square");
+      }
+
+      TestEqual(
+          "in hole Num",
+          UCesiumGeoJsonDocumentBlueprintLibrary::FindFeaturesAtPosition(
+              Document,
+              FVector(1.5, 1.5, 0.0))
+              .Num(),
+          0);
+      TestEqual(
+          "outside Num",
+          UCesiumGeoJsonDocumentBlueprintLibrary::FindFeaturesAtPosition(
+              Document,
+              FVector(10.0, 2.0, 0.0))
+              .Num(),
+          0);
+    });
+
+    It("finds features in a box", [this, SpatialDocument]() {
+      FCesiumGeoJsonDocument Document;
+      UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
+          SpatialDocument,
+          Document);
+      UCesiumGeoJsonDocumentBlueprintLibrary::BuildSpatialIndex(Document);
+
+      TArray<FCesiumGeoJsonFeature> Features =
+          UCesiumGeoJsonDocumentBlueprintLibrary::FindFeaturesInBox(
+              Document,
+              FBox(FVector(3.0, 1.0, 0.0), FVector(11.0, 2.0, 0.0)));
+      TArray<FString> Ids;
+      for (const FCesiumGeoJsonFeature& Feature : Features) {
+        Ids.Add(UCesiumGeoJsonFeatureBlueprintLibrary::GetIdAsString(Feature));
+      }
+      Ids.Sort();
+      TestEqual("Ids", Ids, TArray<FString>{TEXT("line"), TEXT("square")});
+    });
+
+    It("finds the nearest feature", [this, SpatialDocument]() {
+      FCesiumGeoJsonDocument Document;
+      UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
+          SpatialDocument,
+          Document);
+      UCesiumGeoJsonDocumentBlueprintLibrary::BuildSpatialIndex(Document);
+
+      EHasValue Branches;
+      FCesiumGeoJsonFeature Feature =
+          UCesiumGeoJsonDocumentBlueprintLibrary::FindNearestFeature(
+              Document,
+              FVector(12.0, 2.0, 0.0),
+              Branches);
+      TestTrue("HasValue", Branches == EHasValue::HasValue);
+      TestEqual(
+          "nearest to line",
+          UCesiumGeoJsonFeatureBlueprintLibrary::GetIdAsString(Feature),
+          "line");
+
+      Feature = UCesiumGeoJsonDocumentBlueprintLibrary::FindNearestFeature(
+          Document,
+          FVector(18.0, 2.0, 0.0),
+          Branches);
+      TestEqual(
+          "nearest to point",
+          UCesiumGeoJsonFeatureBlueprintLibrary::GetIdAsString(Feature),
+          "point");
+
+      Feature = UCesiumGeoJsonDocumentBlueprintLibrary::FindNearestFeature(
+          Document,
+          FVector(1.5, 1.5, 0.0),
+          Branches);
+      TestEqual(
+          "nearest in hole",
+          UCesiumGeoJsonFeatureBlueprintLibrary::GetIdAsString(Feature),
+          "square");
+    });
+
+    It("answers queries without a prebuilt index", [this, SpatialDocument]() {
+      FCesiumGeoJsonDocument Document;
+      UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
+          SpatialDocument,
+          Document);
+
+      TestEqual(
+          "Num",
+          UCesiumGeoJsonDocumentBlueprintLibrary::FindFeaturesAtPosition(
+              Document,
+              FVector(3.0, 3.0, 0.0))
+              .Num(),
+          1);
+      TestFalse(
+          "HasSpatialIndex",
+          UCesiumGeoJsonDocumentBlueprintLibrary::HasSpatialIndex(Document));
+    });
+
+    It("matches a brute-force search in a deep tree", [this]() {
+      // A 20x20 grid of squares, 0.8 degrees wide and 1 degree apart, whose
+      // IDs are their row-major indices. With 400 features the tree has
+      // several levels of nodes.
+      constexpr int32 GridSize = 20;
+      constexpr double SquareSize = 0.8;
+
+      FString Json =
+          TEXT(R"==({ "type": "FeatureCollection", "features": [)==");
+      for (int32 Y = 0; Y < GridSize; ++Y) {
+        for (int32 X = 0; X < GridSize; ++X) {
+          const double X1 = X + SquareSize;
+          const double Y1 = Y + SquareSize;
+          if (X != 0 || Y != 0) {
+            Json += TEXT(",");
+          }
+          Json += FString::Printf(
+              TEXT(
+                  R"==({ "type": "Feature", "id": %d, "properties": null, "geometry": { "type": "Polygon", "coordinates": [[[%d, %d], [%f, %d], [%f, %f], [%d, %f], [%d, %d]]] } })=="),
+              Y * GridSize + X,
+              X,
+              Y,
+              X1,
+              Y,
+              X1,
+              Y1,
+              X,
+              Y1,
+              X,
+              Y);
+        }
+      }
+      Json += TEXT("] }");
+
+      FCesiumGeoJsonDocument Unindexed;
+      TestTrue(
+          "LoadGeoJsonFromString Success",
+          UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
+              Json,
+              Unindexed));
+      FCesiumGeoJsonDocument Indexed = Unindexed;
+      UCesiumGeoJsonDocumentBlueprintLibrary::BuildSpatialIndex(Indexed);
+      TestEqual(
+          "feature count",
+          int64(Indexed.GetSpatialIndex()->getFeatureCount()),
+          int64(GridSize * GridSize));
+
+      auto getSquare = [](int32 Id) {
+        const double X = Id % GridSize;
+        const double Y = Id / GridSize;
+        return FBox(
+            FVector(X, Y, 0.0),
+            FVector(X + SquareSize, Y + SquareSize, 0.0));
+      };
+
+      auto getIds = [](const TArray<FCesiumGeoJsonFeature>& Features) {
+        TArray<int64> Ids;
+        for (const FCesiumGeoJsonFeature& Feature : Features) {
+          Ids.Add(
+              UCesiumGeoJsonFeatureBlueprintLibrary::GetIdAsInteger(Feature));
+        }
+        Ids.Sort();
+        return Ids;
+      };
+
+      FRandomStream Random(42);
+      for (int32 Query = 0; Query < 50; ++Query) {
+        const FVector Position(
+            Random.FRandRange(-2.0f, GridSize + 2.0f),
+            Random.FRandRange(-2.0f, GridSize + 2.0f),
+            0.0);
+        const FVector Extent(
+            Random.FRandRange(0.0f, 3.0f),
+            Random.FRandRange(0.0f, 3.0f),
+            0.0);
+        const FBox Box(Position - Extent, Position + Extent);
+
+        TArray<int64> ExpectedContaining;
+        TArray<int64> ExpectedInBox;
+        int64 ExpectedNearest = -1;
+        double NearestDistance = TNumericLimits<double>::Max();
+        for (int32 Id = 0; Id < GridSize * GridSize; ++Id) {
+          const FBox Square = getSquare(Id);
+          const double Distance =
+              Square.ComputeSquaredDistanceToPoint(Position);
+          if (Distance == 0.0) {
+            ExpectedContaining.Add(Id);
+          }
+          if (Distance < NearestDistance) {
+            ExpectedNearest = Id;
+            NearestDistance = Distance;
+          }
+          if (Square.Intersect(Box)) {
+            ExpectedInBox.Add(Id);
+          }
+        }
+
+        for (const FCesiumGeoJsonDocument* pDocument : {&Unindexed, &Indexed}) {
+          const FString Name =
+              pDocument == &Indexed ? TEXT("indexed") : TEXT("unindexed");
+
+          TestEqual(
+              Name + " containing",
+              getIds(
+                  UCesiumGeoJsonDocumentBlueprintLibrary::
+                      FindFeaturesAtPosition(*pDocument, Position)),
+              ExpectedContaining);
+          TestEqual(
+              Name + " in box",
+              getIds(UCesiumGeoJsonDocumentBlueprintLibrary::FindFeaturesInBox(
+                  *pDocument,
+                  Box)),
+              ExpectedInBox);
+
+          EHasValue Branches;
+          FCesiumGeoJsonFeature Nearest =
+              UCesiumGeoJsonDocumentBlueprintLibrary::FindNearestFeature(
+                  *pDocument,
+                  Position,
+                  Branches);
+          TestTrue(Name + " has nearest", Branches == EHasValue::HasValue);
+          TestEqual(
+              Name + " nearest",
+              UCesiumGeoJsonFeatureBlueprintLibrary::GetIdAsInteger(Nearest),
+              ExpectedNearest);
+        }
+      }
+
+      TestFalse(
+          "HasSpatialIndex after unindexed queries",
+          UCesiumGeoJsonDocumentBlueprintLibrary::HasSpatialIndex(Unindexed));
+    });
+  });
+
+  Describe("Geometry columns", [this]() {
+    It("stores the parts and lines of each feature", [this]() {
+      FCesiumGeoJsonDocument Document;
+      UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
+          R"==({
+            "type": "FeatureCollection",
+            "features": [
+              {
+                "type": "Feature",
+                "geometry": {
+                  "type": "Polygon",
+                  "coordinates": [
+                    [[0, 0], [4, 0], [4, 4], [0, 4], [0, 0]],
+                    [[1, 1], [2, 1], [2, 2], [1, 1]]
+                  ]
+                },
+                "properties": null
+              },
+              {
+                "type": "Feature",
+                "geometry": {
+                  "type": "MultiLineString",
+                  "coordinates": [
+                    [[10, 0], [11, 1]],
+                    [[12, 0], [13, 1], [14, 2]]
+                  ]
+                },
+                "properties": null
+              },
+              { "type": "Feature", "geometry": null, "properties": null }
+            ]
+          })==",
+          Document);
+      Document.BuildGeometryColumns();
+
+      const std::shared_ptr<const FCesiumGeoJsonGeometryColumns>& pColumns =
+          Document.GetGeometryColumns();
+      if (!TestNotNull("pColumns", pColumns.get())) {
+        return;
+      }
+
+      TestEqual("GetFeatureCount", pColumns->GetFeatureCount(), 3);
+      TestEqual("GetCoordinateCount", pColumns->GetCoordinateCount(), 14);
+
+      TestEqual("polygon parts", pColumns->GetPartCount(0), 1);
+      TestEqual(
+          "polygon type",
+          pColumns->GetPartType(0, 0),
+          ECesiumGeoJsonObjectType::Polygon);
+      TestEqual("polygon lines", pColumns->GetLineCount(0, 0), 2);
+      TestEqual(
+          "polygon origin",
+          pColumns->GetFeatureOrigin(0),
+          FVector(2, 2, 0));
+      TestEqual("hole", pColumns->GetLine(0, 0, 1).Num(), 4);
+      TestEqual(
+          "hole start",
+          pColumns->GetPosition(0, pColumns->GetLine(0, 0, 1)[0]),
+          FVector(1, 1, 0));
+
+      TestEqual("multi line parts", pColumns->GetPartCount(1), 2);
+      TestEqual("second line", pColumns->GetLine(1, 1, 0).Num(), 3);
+      TestEqual(
+          "second line end",
+          pColumns->GetPosition(1, pColumns->GetLine(1, 1, 0)[2]),
+          FVector(14, 2, 0));
+      TestEqual(
+          "multi line coordinates",
+          pColumns->GetFeatureCoordinates(1).Num(),
+          5);
+
+      TestEqual("null geometry parts", pColumns->GetPartCount(2), 0);
+      TestEqual(
+          "null geometry origin",
+          pColumns->GetFeatureOrigin(2),
+          FVector::ZeroVector);
+      TestEqual(
+          "null geometry coordinates",
+          pColumns->GetFeatureCoordinates(2).Num(),
+          0);
+    });
+
+    It("moves the geometry out of the document when asked", [this]() {
+      FCesiumGeoJsonDocument Document;
+      UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
+          R"==({
+            "type": "FeatureCollection",
+            "features": [
+              {
+                "type": "Feature",
+                "geometry": {
+                  "type": "LineString",
+                  "coordinates": [[10, 0], [11, 1], [12, 2]]
+                },
+                "properties": { "name": "line" }
+              }
+            ]
+          })==",
+          Document);
+      Document.MoveGeometryToColumns();
+
+      using Library = UCesiumGeoJsonDocumentBlueprintLibrary;
+      TestTrue("HasGeometryColumns", Library::HasGeometryColumns(Document));
+      TestEqual(
+          "GetGeometryColumnsFeatureCount",
+          Library::GetGeometryColumnsFeatureCount(Document),
+          1);
+      TestEqual(
+          "GetGeometryColumnsPointCount",
+          Library::GetGeometryColumnsPointCount(Document, 0, 0, 0),
+          3);
+      TestEqual(
+          "GetGeometryColumnsPoint",
+          Library::GetGeometryColumnsPoint(Document, 0, 0, 0, 2),
+          FVector(12, 2, 0));
+      TestEqual(
+          "out of range point",
+          Library::GetGeometryColumnsPoint(Document, 0, 0, 0, 3),
+          FVector::ZeroVector);
+      TestEqual(
+          "out of range line",
+          Library::GetGeometryColumnsPointCount(Document, 0, 0, 1),
+          0);
+
+      const FCesiumGeoJsonFeature Feature =
+          Library::GetGeometryColumnsFeature(Document, 0);
+      TestFalse(
+          "feature geometry is released",
+          UCesiumGeoJsonObjectBlueprintLibrary::IsValid(
+              UCesiumGeoJsonFeatureBlueprintLibrary::GetGeometry(Feature)));
+      TestTrue(
+          "feature properties are kept",
+          UCesiumGeoJsonFeatureBlueprintLibrary::GetProperties(Feature)
+              .JsonObject->HasField(TEXT("name")));
+    });
+  });
+
+  Describe("UCesiumGeoJsonObjectBlueprintLibrary::GetObjectPointAt", [this]() {
+    It("reads single points of a LineString", [this]() {
+      FCesiumGeoJsonDocument Document;
+      UCesiumGeoJsonDocumentBlueprintLibrary::LoadGeoJsonFromString(
+          R"==({ "type": "LineString", "coordinates": [[1, 2], [3, 4]] })==",
+          Document);
+      const FCesiumGeoJsonObject Object =
+          UCesiumGeoJsonDocumentBlueprintLibrary::GetRootObject(Document);
+
+      TestEqual(
+          "GetObjectPointCount",
+          UCesiumGeoJsonObjectBlueprintLibrary::GetObjectPointCount(Object),
+          2);
+      TestEqual(
+          "GetObjectPointAt",
+          UCesiumGeoJsonObjectBlueprintLibrary::GetObjectPointAt(Object, 1),
+          FVector(3, 4, 0));
+      TestEqual(
+          "out of range",
+          UCesiumGeoJsonObjectBlueprintLibrary::GetObjectPointAt(Object, 2),
+          FVector::ZeroVector);
+    });
+  });
 }
@@ -0,0 +1,258 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumGltfComponent.h"
+#include "CesiumGltfSpecUtility.h"
+#include "CesiumRuntime.h"
+#include "CreateGltfOptions.h"
+#include "LoadGltfResult.h"
+#include "Misc/AutomationTest.h"
+#include "StaticMeshResources.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <Cesium3DTilesSelection/TileLoadResult.h>
+#include <CesiumAsync/AsyncSystem.h>
+THIRD_PARTY_INCLUDES_END
+
+BEGIN_DEFINE_SPEC(
+    FCesiumGltfComponentSpec,
+    "Cesium.Unit.GltfComponent",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter)
+
+CesiumGltf::Model model;
+CesiumGltf::MeshPrimitive* pPrimitive;
+TUniquePtr<UCesiumGltfComponent::HalfConstructed> pHalfConstructed;
+bool useCompactTextureCoordinates;
+
+// Loads `model` the way a tile's content is loaded, with tangents generated
+// for every primitive, and returns the render data of its only primitive.
+const FStaticMeshLODResources*
+LoadPrimitive(bool shareVerticesForGeneratedTangents) {
+  Cesium3DTilesSelection::TileLoadResult tileLoadResult =
+      Cesium3DTilesSelection::TileLoadResult::createFailedResult(
+          nullptr,
+          nullptr);
+  tileLoadResult.state = Cesium3DTilesSelection::TileLoadResultState::Success;
+  tileLoadResult.contentKind = std::move(model);
+
+  CreateGltfOptions::CreateModelOptions options(std::move(tileLoadResult));
+  options.alwaysIncludeTangents = true;
+  options.shareVerticesForGeneratedTangents =
+      shareVerticesForGeneratedTangents;
+  options.useCompactTextureCoordinates = useCompactTextureCoordinates;
+  options.createPhysicsMeshes = false;
+
+  pHalfConstructed = UCesiumGltfComponent::CreateOffGameThread(
+                         getAsyncSystem(),
+                         glm::dmat4(1.0),
+                         std::move(options))
+                         .wait()
+                         .HalfConstructed;
+  if (!TestNotNull("pHalfConstructed", pHalfConstructed.Get())) {
+    return nullptr;
+  }
+
+  const LoadGltfResult::LoadedModelResult& result =
+      UCesiumGltfComponent::GetLoadedModelResult(*pHalfConstructed);
+  if (!TestEqual("nodes", result.nodeResults.size(), size_t(1)) ||
+      !TestTrue("mesh", result.nodeResults[0].meshResult.has_value()) ||
+      !TestEqual(
+          "primitives",
+          result.nodeResults[0].meshResult->primitiveResults.size(),
+          size_t(1))) {
+    return nullptr;
+  }
+
+  const LoadGltfResult::LoadedPrimitiveResult& primitiveResult =
+      result.nodeResults[0].meshResult->primitiveResults[0];
+  if (!TestNotNull("pRenderData", primitiveResult.pRenderData.Get())) {
+    return nullptr;
+  }
+
+  return &primitiveResult.pRenderData->LODResources[0];
+}
+
+void TestTangentsAreOrthonormal(const FStaticMeshLODResources& lod) {
+  const FStaticMeshVertexBuffer& vertexBuffer =
+      lod.VertexBuffers.StaticMeshVertexBuffer;
+  for (uint32 i = 0; i < vertexBuffer.GetNumVertices(); ++i) {
+    const FVector3f tangent = vertexBuffer.VertexTangentX(i);
+    const FVector3f normal = vertexBuffer.VertexTangentZ(i);
+    TestEqual("tangent length", tangent.Size(), 1.0f, 0.02f);
+    TestEqual(
+        "tangent is perpendicular to normal",
+        FVector3f::DotProduct(tangent, normal),
+        0.0f,
+        0.02f);
+  }
+}
+
+END_DEFINE_SPEC(FCesiumGltfComponentSpec)
+
+void FCesiumGltfComponentSpec::Define() {
+  BeforeEach([this]() {
+    useCompactTextureCoordinates = false;
+    model = CesiumGltf::Model();
+    CesiumGltf::Mesh& mesh = model.meshes.emplace_back();
+    pPrimitive = &mesh.primitives.emplace_back();
+    pPrimitive->mode = CesiumGltf::MeshPrimitive::Mode::TRIANGLES;
+
+    // A unit square made of two triangles that share a diagonal.
+    CreateAttributeForPrimitive(
+        model,
+        *pPrimitive,
+        "POSITION",
+        CesiumGltf::AccessorSpec::Type::VEC3,
+        CesiumGltf::AccessorSpec::ComponentType::FLOAT,
+        std::vector<glm::vec3>{
+            glm::vec3(0.0f, 0.0f, 0.0f),
+            glm::vec3(1.0f, 0.0f, 0.0f),
+            glm::vec3(1.0f, 1.0f, 0.0f),
+            glm::vec3(0.0f, 1.0f, 0.0f)});
+    CreateAttributeForPrimitive(
+        model,
+        *pPrimitive,
+        "NORMAL",
+        CesiumGltf::AccessorSpec::Type::VEC3,
+        CesiumGltf::AccessorSpec::ComponentType::FLOAT,
+        std::vector<glm::vec3>(4, glm::vec3(0.0f, 0.0f, 1.0f)));
+    CreateAttributeForPrimitive(
+        model,
+        *pPrimitive,
+        "TEXCOORD_0",
+        CesiumGltf::AccessorSpec::Type::VEC2,
+        CesiumGltf::AccessorSpec::ComponentType::FLOAT,
+        std::vector<glm::vec2>{
+            glm::vec2(0.0f, 0.0f),
+            glm::vec2(1.0f, 0.0f),
+            glm::vec2(1.0f, 1.0f),
+            glm::vec2(0.0f, 1.0f)});
+  });
+
+  AfterEach([this]() { pHalfConstructed.Reset(); });
+
+  Describe("Generated tangents", [this]() {
+    It("are averaged onto shared vertices", [this]() {
+      CreateIndicesForPrimitive(
+          model,
+          *pPrimitive,
+          CesiumGltf::AccessorSpec::ComponentType::UNSIGNED_SHORT,
+          std::vector<uint16_t>{0, 1, 2, 0, 2, 3});
+
+      const FStaticMeshLODResources* pLod = LoadPrimitive(true);
+      if (!pLod) {
+        return;
+      }
+
+      TestEqual(
+          "vertices",
+          pLod->VertexBuffers.PositionVertexBuffer.GetNumVertices(),
+          uint32(4));
+      TestTangentsAreOrthonormal(*pLod);
+    });
+
+    It("are computed on duplicated vertices when not shared", [this]() {
+      CreateIndicesForPrimitive(
+          model,
+          *pPrimitive,
+          CesiumGltf::AccessorSpec::ComponentType::UNSIGNED_SHORT,
+          std::vector<uint16_t>{0, 1, 2, 0, 2, 3});
+
+      const FStaticMeshLODResources* pLod = LoadPrimitive(false);
+      if (!pLod) {
+        return;
+      }
+
+      TestEqual(
+          "vertices",
+          pLod->VertexBuffers.PositionVertexBuffer.GetNumVertices(),
+          uint32(6));
+      TestTangentsAreOrthonormal(*pLod);
+    });
+
+    It("fall back to duplicated vertices for out-of-range indices", [this]() {
+      // Index 40 does not refer to any vertex, so the tangents can't be
+      // averaged onto shared vertices without reading and writing out of
+      // bounds.
+      CreateIndicesForPrimitive(
+          model,
+          *pPrimitive,
+          CesiumGltf::AccessorSpec::ComponentType::UNSIGNED_SHORT,
+          std::vector<uint16_t>{0, 1, 2, 0, 2, 40});
+
+      const FStaticMeshLODResources* pLod = LoadPrimitive(true);
+      if (!pLod) {
+        return;
+      }
+
+      TestEqual(
+          "vertices",
+          pLod->VertexBuffers.PositionVertexBuffer.GetNumVertices(),
+          uint32(6));
+    });
+  });
+
+  Describe("Compact texture coordinates", [this]() {
+    BeforeEach([this]() {
+      CreateIndicesForPrimitive(
+          model,
+          *pPrimitive,
+          CesiumGltf::AccessorSpec::ComponentType::UNSIGNED_SHORT,
+          std::vector<uint16_t>{0, 1, 2, 0, 2, 3});
+    });
+
+    It("store texture coordinates as 32-bit floats by default", [this]() {
+      const FStaticMeshLODResources* pLod = LoadPrimitive(true);
+      if (!pLod) {
+        return;
+      }
+
+      const FStaticMeshVertexBuffer& vertexBuffer =
+          pLod->VertexBuffers.StaticMeshVertexBuffer;
+      TestTrue("full precision UVs", vertexBuffer.GetUseFullPrecisionUVs());
+      TestFalse(
+          "high precision tangents",
+          vertexBuffer.GetUseHighPrecisionTangentBasis());
+    });
+
+    It("store texture coordinates as 16-bit floats when enabled", [this]() {
+      useCompactTextureCoordinates = true;
+      const FStaticMeshLODResources* pLod = LoadPrimitive(true);
+      if (!pLod) {
+        return;
+      }
+
+      const FStaticMeshVertexBuffer& vertexBuffer =
+          pLod->VertexBuffers.StaticMeshVertexBuffer;
+      TestFalse("full precision UVs", vertexBuffer.GetUseFullPrecisionUVs());
+      TestFalse(
+          "high precision tangents",
+          vertexBuffer.GetUseHighPrecisionTangentBasis());
+      TestEqual(
+          "vertices",
+          vertexBuffer.GetNumVertices(),
+          pLod->VertexBuffers.PositionVertexBuffer.GetNumVertices());
+    });
+
+    It("keep 32-bit floats for primitives with feature ID attributes",
+       [this]() {
+         AddFeatureIDsAsAttributeToModel(
+             model,
+             *pPrimitive,
+             std::vector<uint8_t>{0, 0, 1, 1},
+             2,
+             0);
+
+         useCompactTextureCoordinates = true;
+         const FStaticMeshLODResources* pLod = LoadPrimitive(true);
+         if (!pLod) {
+           return;
+         }
+
+         TestTrue(
+             "full precision UVs",
+             pLod->VertexBuffers.StaticMeshVertexBuffer
+                 .GetUseFullPrecisionUVs());
+       });
+  });
+}
@@ -0,0 +1,98 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumGltfGaussianSplatComponent.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumGltfGaussianSplatDataSpec,
+    "Cesium.Unit.GltfGaussianSplatData",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+
+FCesiumGltfGaussianSplatData data;
+
+END_DEFINE_SPEC(FCesiumGltfGaussianSplatDataSpec)
+
+void FCesiumGltfGaussianSplatDataSpec::Define() {
+  BeforeEach([this]() {
+    data = FCesiumGltfGaussianSplatData();
+    data.NumSplats = 2;
+    data.NumCoefficients = 3;
+    data.Positions = {1.0f, 2.0f, 3.0f, 0.0f, 4.0f, 5.0f, 6.0f, 0.0f};
+    data.Scales = {0.5f, 1.5f, 250.0f, 0.0f, 2.0f, 3.0f, 4.0f, 0.0f};
+    data.Orientations =
+        {0.0f, 0.0f, 0.0f, 1.0f, 0.5f, -0.5f, 0.5f, -0.5f};
+    data.Colors = {1.0f, 0.5f, 0.25f, 1.0f, 0.0f, 0.125f, 0.75f, 0.5f};
+    data.SphericalHarmonics.SetNumZeroed(2 * 3 * 4);
+    for (int32 i = 0; i < data.SphericalHarmonics.Num(); i++) {
+      data.SphericalHarmonics[i] = -1.0f + 2.0f * float(i) / 23.0f;
+    }
+  });
+
+  It("converts to the compact form and releases full-precision data", [this]() {
+    data.Compact();
+
+    TestTrue("bIsCompact", data.bIsCompact);
+    TestEqual("positions are kept", data.Positions.Num(), 8);
+    TestTrue("scales released", data.Scales.IsEmpty());
+    TestTrue("orientations released", data.Orientations.IsEmpty());
+    TestTrue("colors released", data.Colors.IsEmpty());
+    TestTrue("harmonics released", data.SphericalHarmonics.IsEmpty());
+
+    TestEqual("compact scales", data.CompactScales.Num(), 8);
+    TestEqual("compact orientations", data.CompactOrientations.Num(), 8);
+    TestEqual("compact colors", data.CompactColors.Num(), 8);
+    TestEqual("compact harmonics", data.CompactSphericalHarmonics.Num(), 24);
+  });
+
+  It("preserves values within the precision of the compact form", [this]() {
+    TArray<float> scales = data.Scales;
+    TArray<float> orientations = data.Orientations;
+    TArray<float> colors = data.Colors;
+    TArray<float> harmonics = data.SphericalHarmonics;
+
+    data.Compact();
+
+    for (int32 i = 0; i < scales.Num(); i++) {
+      TestEqual(
+          "scale",
+          data.CompactScales[i].GetFloat(),
+          scales[i],
+          FMath::Abs(scales[i]) * 1e-3f);
+    }
+
+    for (int32 i = 0; i < orientations.Num(); i++) {
+      TestEqual(
+          "orientation",
+          float(data.CompactOrientations[i]) / 127.0f,
+          orientations[i],
+          1.0f / 127.0f);
+    }
+
+    for (int32 i = 0; i < colors.Num(); i++) {
+      TestEqual("color", data.CompactColors[i].GetFloat(), colors[i], 1e-3f);
+    }
+
+    TestEqual("minimum", data.SphericalHarmonicsMinimum, -1.0f);
+    TestEqual("range", data.SphericalHarmonicsRange, 2.0f);
+    for (int32 i = 0; i < harmonics.Num(); i++) {
+      const float decoded =
+          data.SphericalHarmonicsMinimum +
+          data.SphericalHarmonicsRange *
+              float(data.CompactSphericalHarmonics[i]) / 255.0f;
+      TestEqual("harmonic", decoded, harmonics[i], 2.0f / 255.0f);
+    }
+  });
+
+  It("handles data without spherical harmonics", [this]() {
+    data.NumCoefficients = 0;
+    data.SphericalHarmonics.Empty();
+
+    data.Compact();
+
+    TestTrue("no compact harmonics", data.CompactSphericalHarmonics.IsEmpty());
+    TestEqual("range", data.SphericalHarmonicsRange, 0.0f);
+  });
+}
@@ -0,0 +1,67 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumHeightClampingSubsystem.h"
+#include "Cesium3DTileset.h"
+#include "CesiumTestHelpers.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumHeightClampingSubsystemSpec,
+    "Cesium.Unit.HeightClampingSubsystem",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FCesiumHeightClampingSubsystemSpec)
+
+void FCesiumHeightClampingSubsystemSpec::Define() {
+  It("fails requests without a tileset immediately", [this]() {
+    UWorld* pWorld = CesiumTestHelpers::getGlobalWorldContext();
+    UCesiumHeightClampingSubsystem* pSubsystem =
+        pWorld->GetSubsystem<UCesiumHeightClampingSubsystem>();
+    if (!TestNotNull("subsystem", pSubsystem)) {
+      return;
+    }
+
+    bool called = false;
+    bool succeeded = true;
+    pSubsystem->RequestHeight(
+        nullptr,
+        FVector(10.0, 20.0, 0.0),
+        [&called, &succeeded](bool success, double height) {
+          called = true;
+          succeeded = success;
+        });
+
+    TestTrue("called", called);
+    TestFalse("succeeded", succeeded);
+  });
+
+  It("fails pending requests when the tileset is destroyed", [this]() {
+    UWorld* pWorld = CesiumTestHelpers::getGlobalWorldContext();
+    UCesiumHeightClampingSubsystem* pSubsystem =
+        pWorld->GetSubsystem<UCesiumHeightClampingSubsystem>();
+    if (!TestNotNull("subsystem", pSubsystem)) {
+      return;
+    }
+
+    ACesium3DTileset* pTileset = pWorld->SpawnActor<ACesium3DTileset>();
+    int32 failures = 0;
+    for (int32 i = 0; i < 3; ++i) {
+      pSubsystem->RequestHeight(
+          pTileset,
+          FVector(10.0, 20.0, 0.0),
+          [&failures](bool success, double height) {
+            if (!success) {
+              ++failures;
+            }
+          });
+    }
+
+    pTileset->Destroy();
+    pSubsystem->Tick(0.0f);
+
+    TestEqual("failures", failures, 3);
+  });
+}
@@ -0,0 +1,61 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumMaterialInstancePool.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumMaterialInstancePoolSpec,
+    "Cesium.Unit.CesiumMaterialInstancePool",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter | EAutomationTestFlags::NonNullRHI)
+UCesiumMaterialInstancePool* pPool;
+UMaterialInterface* pParent;
+END_DEFINE_SPEC(FCesiumMaterialInstancePoolSpec)
+
+void FCesiumMaterialInstancePoolSpec::Define() {
+  BeforeEach([this]() {
+    pPool = NewObject<UCesiumMaterialInstancePool>();
+    pParent = UMaterial::GetDefaultMaterial(MD_Surface);
+  });
+
+  AfterEach([this]() { pPool->clear(); });
+
+  It("returns nullptr when empty", [this]() {
+    TestNull("acquire", pPool->acquire(pParent));
+  });
+
+  It("reuses a released material instance with the same parent", [this]() {
+    UMaterialInstanceDynamic* pMaterial =
+        UMaterialInstanceDynamic::Create(pParent, nullptr);
+    pMaterial->SetScalarParameterValue("Test", 1.0f);
+    pPool->release(pMaterial);
+    TestEqual("getPooledCount", pPool->getPooledCount(), 1);
+
+    UMaterialInstanceDynamic* pAcquired = pPool->acquire(pParent);
+    TestEqual("acquire", pAcquired, pMaterial);
+    TestEqual("parameters", pAcquired->ScalarParameterValues.Num(), 0);
+    TestEqual("getPooledCount", pPool->getPooledCount(), 0);
+  });
+
+  It("doesn't reuse a material instance with a different parent", [this]() {
+    pPool->release(UMaterialInstanceDynamic::Create(pParent, nullptr));
+    TestNull(
+        "acquire",
+        pPool->acquire(UMaterial::GetDefaultMaterial(MD_PostProcess)));
+    TestEqual("getPooledCount", pPool->getPooledCount(), 1);
+  });
+
+  It("keeps at most the maximum number of material instances", [this]() {
+    for (int32 i = 0;
+         i < UCesiumMaterialInstancePool::MaximumPooledMaterials + 1;
+         ++i) {
+      pPool->release(UMaterialInstanceDynamic::Create(pParent, nullptr));
+    }
+    TestEqual(
+        "getPooledCount",
+        pPool->getPooledCount(),
+        UCesiumMaterialInstancePool::MaximumPooledMaterials);
+  });
+}
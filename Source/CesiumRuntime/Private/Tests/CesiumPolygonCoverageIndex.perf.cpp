@@ -0,0 +1,161 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumPolygonCoverageIndex.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+
+#include <glm/trigonometric.hpp>
+
+#include <cmath>
+#include <vector>
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCesiumPolygonCoverageIndex10kPolygons,
+    "Cesium.Performance.PolygonCoverageIndex.Classify tiles against 10k building footprints",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+using namespace CesiumGeospatial;
+
+namespace {
+
+constexpr int32 FootprintsPerSide = 100;
+constexpr int32 QueryCount = 20000;
+
+// A grid of building footprints, each about 20 meters across, in Philadelphia.
+constexpr double GridWestDegrees = -75.18;
+constexpr double GridSouthDegrees = 39.94;
+constexpr double FootprintSpacingDegrees = 0.0005;
+constexpr double FootprintSizeDegrees = 0.0002;
+
+std::vector<CartographicPolygon> CreateFootprints(FRandomStream& random) {
+  std::vector<CartographicPolygon> polygons;
+  polygons.reserve(FootprintsPerSide * FootprintsPerSide);
+
+  for (int32 x = 0; x < FootprintsPerSide; ++x) {
+    for (int32 y = 0; y < FootprintsPerSide; ++y) {
+      const double west = GridWestDegrees + x * FootprintSpacingDegrees;
+      const double south = GridSouthDegrees + y * FootprintSpacingDegrees;
+      const double size =
+          FootprintSizeDegrees * random.FRandRange(0.5f, 1.0f);
+
+      // An L-shaped footprint, so that it isn't the same as its bounds.
+      std::vector<glm::dvec2> vertices{
+          glm::dvec2(west, south),
+          glm::dvec2(west + size, south),
+          glm::dvec2(west + size, south + size * 0.5),
+          glm::dvec2(west + size * 0.5, south + size * 0.5),
+          glm::dvec2(west + size * 0.5, south + size),
+          glm::dvec2(west, south + size)};
+      for (glm::dvec2& vertex : vertices) {
+        vertex = glm::radians(vertex);
+      }
+
+      polygons.emplace_back(vertices);
+    }
+  }
+
+  return polygons;
+}
+
+// Creates the rectangles of tiles of random levels of a geographic quadtree
+// around the footprints, from tiles much larger than the grid down to tiles
+// smaller than a single footprint.
+std::vector<GlobeRectangle> CreateTileRectangles(FRandomStream& random) {
+  std::vector<GlobeRectangle> rectangles;
+  rectangles.reserve(QueryCount);
+
+  const double gridSize = FootprintsPerSide * FootprintSpacingDegrees;
+
+  for (int32 i = 0; i < QueryCount; ++i) {
+    const int32 level = random.RandRange(10, 20);
+    const double tileWidth = 360.0 / double(1 << (level + 1));
+    const double tileHeight = 180.0 / double(1 << level);
+
+    const double longitude = GridWestDegrees + random.FRandRange(
+                                                   -0.1f * gridSize,
+                                                   1.1f * gridSize);
+    const double latitude = GridSouthDegrees + random.FRandRange(
+                                                   -0.1f * gridSize,
+                                                   1.1f * gridSize);
+    const double west = std::floor(longitude / tileWidth) * tileWidth;
+    const double south = std::floor(latitude / tileHeight) * tileHeight;
+
+    rectangles.emplace_back(GlobeRectangle::fromDegrees(
+        west,
+        south,
+        west + tileWidth,
+        south + tileHeight));
+  }
+
+  return rectangles;
+}
+
+} // namespace
+
+bool FCesiumPolygonCoverageIndex10kPolygons::RunTest(
+    const FString& Parameters) {
+  FRandomStream random(42);
+  const std::vector<CartographicPolygon> polygons = CreateFootprints(random);
+  const std::vector<GlobeRectangle> rectangles = CreateTileRectangles(random);
+
+  uint64 start = FPlatformTime::Cycles64();
+  CesiumPolygonCoverageIndex index(polygons);
+  const uint64 buildCycles = FPlatformTime::Cycles64() - start;
+
+  TestEqual(
+      "getPolygonCount",
+      index.getPolygonCount(),
+      size_t(FootprintsPerSide * FootprintsPerSide));
+
+  // Test every tile against every polygon, as the tile excluder did before the
+  // polygons were indexed.
+  std::vector<CesiumPolygonCoverageIndex::Coverage> expected;
+  expected.reserve(rectangles.size());
+  start = FPlatformTime::Cycles64();
+  for (const GlobeRectangle& rectangle : rectangles) {
+    if (CartographicPolygon::rectangleIsWithinPolygons(rectangle, polygons)) {
+      expected.push_back(CesiumPolygonCoverageIndex::Coverage::Full);
+    } else if (CartographicPolygon::rectangleIsOutsidePolygons(
+                   rectangle,
+                   polygons)) {
+      expected.push_back(CesiumPolygonCoverageIndex::Coverage::None);
+    } else {
+      expected.push_back(CesiumPolygonCoverageIndex::Coverage::Partial);
+    }
+  }
+  const uint64 linearCycles = FPlatformTime::Cycles64() - start;
+
+  std::vector<CesiumPolygonCoverageIndex::Coverage> actual;
+  actual.reserve(rectangles.size());
+  start = FPlatformTime::Cycles64();
+  for (const GlobeRectangle& rectangle : rectangles) {
+    actual.push_back(index.classify(rectangle));
+  }
+  const uint64 indexedCycles = FPlatformTime::Cycles64() - start;
+
+  int32 mismatches = 0;
+  int32 counts[3] = {0, 0, 0};
+  for (size_t i = 0; i < actual.size(); ++i) {
+    mismatches += actual[i] != expected[i];
+    ++counts[int32(actual[i])];
+  }
+  TestEqual("mismatches", mismatches, 0);
+
+  AddInfo(FString::Printf(
+      TEXT(
+          "Indexed %d polygons in %.3f ms. Classified %d tiles (%d none, %d partial, %d full): linear %.3f ms, indexed %.3f ms"),
+      int32(index.getPolygonCount()),
+      FPlatformTime::ToMilliseconds64(buildCycles),
+      QueryCount,
+      counts[int32(CesiumPolygonCoverageIndex::Coverage::None)],
+      counts[int32(CesiumPolygonCoverageIndex::Coverage::Partial)],
+      counts[int32(CesiumPolygonCoverageIndex::Coverage::Full)],
+      FPlatformTime::ToMilliseconds64(linearCycles),
+      FPlatformTime::ToMilliseconds64(indexedCycles)));
+
+  return true;
+}
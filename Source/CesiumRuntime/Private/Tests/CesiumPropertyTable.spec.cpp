@@ -495,6 +495,74 @@ void FCesiumPropertyTableSpec::Define() {
     });
   });
 
+  Describe("FindProperties", [this]() {
+    BeforeEach([this]() { pPropertyTable->classProperty = "testClass"; });
+
+    It("finds properties in the order of the names", [this]() {
+      std::string scalarPropertyName("scalarProperty");
+      std::vector<int32_t> scalarValues{1, 2, 3, 4};
+      pPropertyTable->count = static_cast<int64_t>(scalarValues.size());
+      AddPropertyTablePropertyToModel(
+          model,
+          *pPropertyTable,
+          scalarPropertyName,
+          CesiumGltf::ClassProperty::Type::SCALAR,
+          CesiumGltf::ClassProperty::ComponentType::INT32,
+          scalarValues);
+
+      std::string floatPropertyName("floatProperty");
+      std::vector<float> floatValues{0.5f, 1.5f, 2.5f, 3.5f};
+      AddPropertyTablePropertyToModel(
+          model,
+          *pPropertyTable,
+          floatPropertyName,
+          CesiumGltf::ClassProperty::Type::SCALAR,
+          CesiumGltf::ClassProperty::ComponentType::FLOAT32,
+          floatValues);
+
+      FCesiumPropertyTable propertyTable(model, *pPropertyTable);
+      TArray<FCesiumPropertyTableProperty> properties =
+          UCesiumPropertyTableBlueprintLibrary::FindProperties(
+              propertyTable,
+              {FString(floatPropertyName.c_str()),
+               FString("nonexistent property"),
+               FString(scalarPropertyName.c_str())});
+      TestEqual("number of properties", properties.Num(), 3);
+
+      TestEqual(
+          "float property status",
+          UCesiumPropertyTablePropertyBlueprintLibrary::
+              GetPropertyTablePropertyStatus(properties[0]),
+          ECesiumPropertyTablePropertyStatus::Valid);
+      TestEqual(
+          "nonexistent property status",
+          UCesiumPropertyTablePropertyBlueprintLibrary::
+              GetPropertyTablePropertyStatus(properties[1]),
+          ECesiumPropertyTablePropertyStatus::ErrorInvalidProperty);
+      TestEqual(
+          "scalar property status",
+          UCesiumPropertyTablePropertyBlueprintLibrary::
+              GetPropertyTablePropertyStatus(properties[2]),
+          ECesiumPropertyTablePropertyStatus::Valid);
+
+      TArray<float> floats =
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetFloatValues(
+              properties[0],
+              {2, 1});
+      TestEqual("number of floats", floats.Num(), 2);
+      TestEqual("float0", floats[0], floatValues[2]);
+      TestEqual("float1", floats[1], floatValues[1]);
+
+      TArray<int32> integers =
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetIntegerValues(
+              properties[2],
+              {2, 1});
+      TestEqual("number of integers", integers.Num(), 2);
+      TestEqual("integer0", integers[0], scalarValues[2]);
+      TestEqual("integer1", integers[1], scalarValues[1]);
+    });
+  });
+
   Describe("GetMetadataValuesForFeature", [this]() {
     BeforeEach([this]() { pPropertyTable->classProperty = "testClass"; });
 
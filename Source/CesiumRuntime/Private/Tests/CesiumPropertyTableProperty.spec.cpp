@@ -1797,6 +1797,118 @@ void FCesiumPropertyTablePropertySpec::Define() {
     });
   });
 
+  Describe("GetFloatValues", [this]() {
+    It("returns default values for invalid property", [this]() {
+      FCesiumPropertyTableProperty property;
+      TArray<float> values =
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetFloatValues(
+              property,
+              {0, 1},
+              -1.0f);
+      TestEqual("number of values", values.Num(), 2);
+      TestEqual("value0", values[0], -1.0f);
+      TestEqual("value1", values[1], -1.0f);
+    });
+
+    It("gets values in the order of the feature IDs", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::FLOAT32;
+
+      std::vector<float> values{-1.0f, 2.0f, -3.5f, 4.25f};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<float> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      TArray<float> result =
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetFloatValues(
+              property,
+              {3, 0, -1, 2, 10},
+              0.5f);
+      TestEqual("number of values", result.Num(), 5);
+      TestEqual("value0", result[0], values[3]);
+      TestEqual("value1", result[1], values[0]);
+      TestEqual("negative index", result[2], 0.5f);
+      TestEqual("value3", result[3], values[2]);
+      TestEqual("out-of-range positive index", result[4], 0.5f);
+    });
+
+    It("matches GetFloat for transformed property", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::INT16;
+      classProperty.normalized = true;
+      classProperty.offset = 1.0;
+      classProperty.scale = 2.0;
+      classProperty.noData = 0;
+      classProperty.defaultProperty = 12.5;
+
+      std::vector<int16_t> values{-32767, 0, 100, 32767};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<int16_t, true> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      const TArray<int64> featureIDs{0, 1, 2, 3};
+      TArray<float> result =
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetFloatValues(
+              property,
+              featureIDs);
+      TestEqual("number of values", result.Num(), featureIDs.Num());
+      for (int32 i = 0; i < featureIDs.Num(); ++i) {
+        TestEqual(
+            std::string("value" + std::to_string(i)).c_str(),
+            result[i],
+            UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat(
+                property,
+                featureIDs[i]));
+      }
+    });
+  });
+
+  Describe("GetInteger64Values", [this]() {
+    It("converts values and uses default for unconvertible ones", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::UINT64;
+
+      std::vector<uint64_t> values{
+          1,
+          uint64_t(std::numeric_limits<int64_t>::max()) + 1,
+          3};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<uint64_t> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      TArray<int64> result =
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetInteger64Values(
+              property,
+              {0, 1, 2},
+              -1);
+      TestEqual("number of values", result.Num(), 3);
+      TestEqual<int64>("value0", result[0], 1);
+      TestEqual<int64>("out-of-range value", result[1], -1);
+      TestEqual<int64>("value2", result[2], 3);
+    });
+  });
+
   Describe("GetIntPoint", [this]() {
     It("returns default value for invalid property", [this]() {
       FCesiumPropertyTableProperty property;
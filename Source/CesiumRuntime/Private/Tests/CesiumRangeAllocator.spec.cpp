@@ -0,0 +1,82 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumRangeAllocator.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumRangeAllocatorSpec,
+    "Cesium.Unit.RangeAllocator",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FCesiumRangeAllocatorSpec)
+
+void FCesiumRangeAllocatorSpec::Define() {
+  It("allocates consecutive ranges until full", [this]() {
+    CesiumRangeAllocator allocator(100);
+    TestEqual("first", allocator.allocate(40).value_or(-1), 0);
+    TestEqual("second", allocator.allocate(40).value_or(-1), 40);
+    TestEqual("end", allocator.getEnd(), 80);
+    TestFalse("too large", allocator.allocate(21).has_value());
+    TestEqual("exact fit", allocator.allocate(20).value_or(-1), 80);
+  });
+
+  It("reuses freed ranges first-fit", [this]() {
+    CesiumRangeAllocator allocator(100);
+    allocator.allocate(10);
+    allocator.allocate(20);
+    allocator.allocate(10);
+
+    allocator.free(10, 20);
+    TestEqual("fragmented", allocator.getFreeCountBeforeEnd(), 20);
+    TestEqual("end unchanged", allocator.getEnd(), 40);
+
+    TestEqual("reused", allocator.allocate(15).value_or(-1), 10);
+    TestEqual("remainder", allocator.allocate(5).value_or(-1), 25);
+    TestEqual("no longer fragmented", allocator.getFreeCountBeforeEnd(), 0);
+    TestEqual("appended", allocator.allocate(5).value_or(-1), 40);
+  });
+
+  It("coalesces adjacent free ranges", [this]() {
+    CesiumRangeAllocator allocator(100);
+    allocator.allocate(10);
+    allocator.allocate(10);
+    allocator.allocate(10);
+    allocator.allocate(10);
+
+    allocator.free(0, 10);
+    allocator.free(20, 10);
+    allocator.free(10, 10);
+    TestEqual("fragmented", allocator.getFreeCountBeforeEnd(), 30);
+    TestEqual("merged", allocator.allocate(30).value_or(-1), 0);
+  });
+
+  It("lowers the end when the last range is freed", [this]() {
+    CesiumRangeAllocator allocator(100);
+    allocator.allocate(10);
+    allocator.allocate(10);
+    allocator.allocate(10);
+
+    allocator.free(10, 10);
+    allocator.free(20, 10);
+    TestEqual("end", allocator.getEnd(), 10);
+    TestEqual("fragmented", allocator.getFreeCountBeforeEnd(), 0);
+
+    allocator.free(0, 10);
+    TestEqual("empty", allocator.getEnd(), 0);
+  });
+
+  It("resets to a new capacity", [this]() {
+    CesiumRangeAllocator allocator(10);
+    allocator.allocate(5);
+    allocator.allocate(5);
+    allocator.free(0, 5);
+
+    allocator.reset(20);
+    TestEqual("capacity", allocator.getCapacity(), 20);
+    TestEqual("end", allocator.getEnd(), 0);
+    TestEqual("fragmented", allocator.getFreeCountBeforeEnd(), 0);
+    TestEqual("allocated", allocator.allocate(20).value_or(-1), 0);
+  });
+}
@@ -0,0 +1,66 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumTextureBudget.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumTextureBudgetSpec,
+    "Cesium.Unit.CesiumTextureBudget",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter | EAutomationTestFlags::NonNullRHI)
+END_DEFINE_SPEC(FCesiumTextureBudgetSpec)
+
+void FCesiumTextureBudgetSpec::Define() {
+  It("tracks the size of textures", [this]() {
+    CesiumTextureBudget budget;
+    budget.addTexture(1000);
+    budget.addTexture(500);
+    budget.removeTexture(1000);
+    TestEqual("getTextureBytes", budget.getTextureBytes(), int64(500));
+  });
+
+  It("does not shrink caches without a budget", [this]() {
+    CesiumTextureBudget budget;
+    budget.addTexture(1000000);
+    budget.update(0);
+    TestFalse("isOverBudget", budget.isOverBudget());
+    TestEqual("getCacheScale", budget.getCacheScale(), 1.0);
+    TestEqual("scaleCachedBytes", budget.scaleCachedBytes(1000), int64(1000));
+  });
+
+  It("shrinks caches while over budget", [this]() {
+    CesiumTextureBudget budget;
+    budget.addTexture(1500);
+    budget.update(1000);
+    TestTrue("isOverBudget", budget.isOverBudget());
+    const double firstScale = budget.getCacheScale();
+    TestTrue("shrunk", firstScale < 1.0);
+
+    budget.update(1000);
+    TestTrue("shrunk further", budget.getCacheScale() < firstScale);
+    TestTrue(
+        "scaleCachedBytes",
+        budget.scaleCachedBytes(1000) < int64(1000 * firstScale));
+  });
+
+  It("grows caches back once well under budget", [this]() {
+    CesiumTextureBudget budget;
+    budget.addTexture(4000);
+    for (int32 i = 0; i < 20; ++i) {
+      budget.update(1000);
+    }
+    const double shrunkScale = budget.getCacheScale();
+
+    // Just under the budget isn't enough to grow again.
+    budget.removeTexture(3050);
+    budget.update(1000);
+    TestFalse("isOverBudget", budget.isOverBudget());
+    TestEqual("held", budget.getCacheScale(), shrunkScale);
+
+    budget.removeTexture(500);
+    for (int32 i = 0; i < 200; ++i) {
+      budget.update(1000);
+    }
+    TestEqual("restored", budget.getCacheScale(), 1.0);
+  });
+}
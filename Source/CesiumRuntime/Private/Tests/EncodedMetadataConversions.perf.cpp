@@ -0,0 +1,153 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumFeaturesMetadataDescription.h"
+#include "CesiumGltfSpecUtility.h"
+#include "CesiumMetadataValue.h"
+#include "CesiumPropertyTableProperty.h"
+#include "EncodedMetadataConversions.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#include <CesiumGltf/MetadataConversions.h>
+#include <CesiumGltf/PropertyTablePropertyView.h>
+
+#include <cstring>
+#include <vector>
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FEncodedMetadataConversionsScalars,
+    "Cesium.Performance.EncodedMetadataConversions.Encode 500k float scalars",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FEncodedMetadataConversionsVec2s,
+    "Cesium.Performance.EncodedMetadataConversions.Encode 500k uint16 vec2s as uint8",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+namespace {
+
+constexpr int64 FeatureCount = 500000;
+
+// Encodes the property the way it was done before the typed path existed, by
+// boxing each value into an FCesiumMetadataValue.
+void EncodeThroughMetadataValues(
+    const FCesiumPropertyTablePropertyDescription& description,
+    const FCesiumPropertyTableProperty& property,
+    std::vector<std::byte>& textureData,
+    size_t pixelSize) {
+  const int64 propertySize =
+      UCesiumPropertyTablePropertyBlueprintLibrary::GetPropertySize(property);
+  uint8* pWritePos = reinterpret_cast<uint8*>(textureData.data());
+  for (int64 i = 0; i < propertySize; ++i) {
+    FCesiumMetadataValue value =
+        UCesiumPropertyTablePropertyBlueprintLibrary::GetRawValue(property, i);
+    if (description.EncodingDetails.Type ==
+        ECesiumEncodedMetadataType::Scalar) {
+      *reinterpret_cast<float*>(pWritePos) =
+          UCesiumMetadataValueBlueprintLibrary::GetFloat(value, 0.0f);
+    } else {
+      FIntPoint vec2 = UCesiumMetadataValueBlueprintLibrary::GetIntPoint(
+          value,
+          FIntPoint(0));
+      for (int32 j = 0; j < 2; ++j) {
+        pWritePos[j] =
+            CesiumGltf::MetadataConversions<uint8, int32>::convert(vec2[j])
+                .value_or(0);
+      }
+    }
+    pWritePos += pixelSize;
+  }
+}
+
+template <typename T>
+void RunEncodeTest(
+    FAutomationTestBase& test,
+    const CesiumGltf::ClassProperty& classProperty,
+    const std::vector<T>& values,
+    const FCesiumPropertyTablePropertyDescription& description,
+    size_t pixelSize) {
+  const std::vector<std::byte> data = GetValuesAsBytes(values);
+  CesiumGltf::PropertyTableProperty propertyTableProperty;
+  CesiumGltf::PropertyTablePropertyView<T> propertyView(
+      propertyTableProperty,
+      classProperty,
+      int64_t(values.size()),
+      std::span<const std::byte>(data.data(), data.size()));
+  FCesiumPropertyTableProperty property(propertyView);
+
+  std::vector<std::byte> expected(values.size() * pixelSize);
+  uint64 start = FPlatformTime::Cycles64();
+  EncodeThroughMetadataValues(description, property, expected, pixelSize);
+  const uint64 boxedCycles = FPlatformTime::Cycles64() - start;
+
+  std::vector<std::byte> actual(values.size() * pixelSize);
+  start = FPlatformTime::Cycles64();
+  CesiumEncodedMetadataCoerce::encode(
+      description,
+      property,
+      std::span<std::byte>(actual),
+      pixelSize);
+  const uint64 typedCycles = FPlatformTime::Cycles64() - start;
+
+  test.TestTrue(
+      "typed encoding matches boxed encoding",
+      std::memcmp(expected.data(), actual.data(), expected.size()) == 0);
+  test.AddInfo(FString::Printf(
+      TEXT("Encoded %lld values: boxed %.3f ms, typed %.3f ms"),
+      int64(values.size()),
+      FPlatformTime::ToMilliseconds64(boxedCycles),
+      FPlatformTime::ToMilliseconds64(typedCycles)));
+}
+
+} // namespace
+
+bool FEncodedMetadataConversionsScalars::RunTest(const FString& Parameters) {
+  CesiumGltf::ClassProperty classProperty;
+  classProperty.type = CesiumGltf::ClassProperty::Type::SCALAR;
+  classProperty.componentType =
+      CesiumGltf::ClassProperty::ComponentType::FLOAT32;
+
+  std::vector<float> values(FeatureCount);
+  for (int64 i = 0; i < FeatureCount; ++i) {
+    values[i] = float(i) * 0.25f;
+  }
+
+  FCesiumPropertyTablePropertyDescription description;
+  description.PropertyDetails = FCesiumMetadataPropertyDetails(
+      ECesiumMetadataType::Scalar,
+      ECesiumMetadataComponentType::Float32,
+      false);
+  description.EncodingDetails = FCesiumMetadataEncodingDetails(
+      ECesiumEncodedMetadataType::Scalar,
+      ECesiumEncodedMetadataComponentType::Float,
+      ECesiumEncodedMetadataConversion::Coerce);
+
+  RunEncodeTest(*this, classProperty, values, description, sizeof(float));
+  return true;
+}
+
+bool FEncodedMetadataConversionsVec2s::RunTest(const FString& Parameters) {
+  CesiumGltf::ClassProperty classProperty;
+  classProperty.type = CesiumGltf::ClassProperty::Type::VEC2;
+  classProperty.componentType =
+      CesiumGltf::ClassProperty::ComponentType::UINT16;
+
+  // Includes values that are out of the uint8 range.
+  std::vector<glm::u16vec2> values(FeatureCount);
+  for (int64 i = 0; i < FeatureCount; ++i) {
+    values[i] = glm::u16vec2(uint16(i % 300), uint16(i % 200));
+  }
+
+  FCesiumPropertyTablePropertyDescription description;
+  description.PropertyDetails = FCesiumMetadataPropertyDetails(
+      ECesiumMetadataType::Vec2,
+      ECesiumMetadataComponentType::Uint16,
+      false);
+  description.EncodingDetails = FCesiumMetadataEncodingDetails(
+      ECesiumEncodedMetadataType::Vec2,
+      ECesiumEncodedMetadataComponentType::Uint8,
+      ECesiumEncodedMetadataConversion::Coerce);
+
+  RunEncodeTest(*this, classProperty, values, description, 2);
+  return true;
+}
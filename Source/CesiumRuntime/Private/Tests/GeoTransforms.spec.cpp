@@ -1,8 +1,11 @@
 // Copyright 2020-2026 CesiumGS, Inc. and Contributors
 
 #include "GeoTransforms.h"
+#include "CesiumGeoreference.h"
 #include "CesiumGeospatial/Ellipsoid.h"
+#include "CesiumTestHelpers.h"
 #include "CesiumUtility/Math.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/AutomationTest.h"
 
 using namespace CesiumGeospatial;
@@ -30,4 +33,67 @@ void FGeoTransformsSpec::Define() {
       TestEqual("is at the origin", ue, glm::dvec3(0.0));
     });
   });
+
+  Describe("Batch transforms", [this]() {
+    It("match per-point transforms and report timings", [this]() {
+      UWorld* pWorld = CesiumTestHelpers::getGlobalWorldContext();
+      ACesiumGeoreference* pGeoreference =
+          pWorld->SpawnActor<ACesiumGeoreference>();
+      pGeoreference->SetOriginLongitudeLatitudeHeight(
+          FVector(-105.25737, 39.736401, 2250.0));
+
+      // A dense track of positions around the origin.
+      constexpr int32 count = 200000;
+      TArray<FVector> llhs;
+      llhs.SetNumUninitialized(count);
+      for (int32 i = 0; i < count; ++i) {
+        const double t = double(i) / double(count);
+        llhs[i] = FVector(
+            -105.25737 + 0.1 * t,
+            39.736401 + 0.05 * FMath::Sin(t * 20.0),
+            2250.0 + 100.0 * t);
+      }
+
+      uint64 start = FPlatformTime::Cycles64();
+      TArray<FVector> expected;
+      expected.SetNumUninitialized(count);
+      for (int32 i = 0; i < count; ++i) {
+        expected[i] =
+            pGeoreference->TransformLongitudeLatitudeHeightPositionToUnreal(
+                llhs[i]);
+      }
+      const uint64 perPointCycles = FPlatformTime::Cycles64() - start;
+
+      start = FPlatformTime::Cycles64();
+      TArray<FVector> actual =
+          pGeoreference->TransformLongitudeLatitudeHeightPositionsToUnreal(
+              llhs);
+      const uint64 batchCycles = FPlatformTime::Cycles64() - start;
+
+      TestEqual("number of positions", actual.Num(), count);
+      for (int32 i = 0; i < count; ++i) {
+        if (!actual[i].Equals(expected[i], 1e-6)) {
+          TestEqual("position", actual[i], expected[i]);
+          break;
+        }
+      }
+
+      pGeoreference->TransformUnrealPositionsToLongitudeLatitudeHeightInPlace(
+          actual);
+      for (int32 i = 0; i < count; ++i) {
+        if (!actual[i].Equals(llhs[i], 1e-5)) {
+          TestEqual("round trip", actual[i], llhs[i]);
+          break;
+        }
+      }
+
+      AddInfo(FString::Printf(
+          TEXT("Transformed %d positions: per-point %.3f ms, batch %.3f ms"),
+          count,
+          FPlatformTime::ToMilliseconds64(perPointCycles),
+          FPlatformTime::ToMilliseconds64(batchCycles)));
+
+      pGeoreference->Destroy();
+    });
+  });
 }
@@ -0,0 +1,164 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "ShardedFileCache.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <CesiumAsync/CacheItem.h>
+#include <CesiumAsync/SqliteCache.h>
+#include <spdlog/spdlog.h>
+THIRD_PARTY_INCLUDES_END
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <memory>
+#include <vector>
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRequestCacheConcurrentSqlite,
+    "Cesium.Performance.RequestCache.64 concurrent requests against SqliteCache",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRequestCacheConcurrentShardedFiles,
+    "Cesium.Performance.RequestCache.64 concurrent requests against ShardedFileCache",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+namespace {
+
+constexpr int32 ConcurrentRequests = 64;
+constexpr int32 RequestsPerWorker = 50;
+constexpr size_t ResponseBytes = 64 * 1024;
+
+std::string CreateKey(int32 worker, int32 i) {
+  return "https://example.com/" + std::to_string(worker) + "/" +
+         std::to_string(i);
+}
+
+// Runs `operation` for every key from 64 workers at once, and logs the mean,
+// median, and 99th percentile latency of a single call.
+template <typename TOperation>
+void MeasureConcurrently(
+    FAutomationTestBase& test,
+    const TCHAR* name,
+    TOperation&& operation) {
+  std::vector<uint64> cycles(size_t(ConcurrentRequests * RequestsPerWorker));
+
+  ParallelFor(ConcurrentRequests, [&](int32 worker) {
+    for (int32 i = 0; i < RequestsPerWorker; ++i) {
+      const std::string key = CreateKey(worker, i);
+      const uint64 start = FPlatformTime::Cycles64();
+      operation(key);
+      cycles[size_t(worker * RequestsPerWorker + i)] =
+          FPlatformTime::Cycles64() - start;
+    }
+  });
+
+  uint64 total = 0;
+  for (uint64 value : cycles) {
+    total += value;
+  }
+  std::sort(cycles.begin(), cycles.end());
+
+  test.AddInfo(FString::Printf(
+      TEXT("%s with %d concurrent workers: mean %.3f ms, median %.3f ms, p99 "
+           "%.3f ms"),
+      name,
+      ConcurrentRequests,
+      FPlatformTime::ToMilliseconds64(total) / double(cycles.size()),
+      FPlatformTime::ToMilliseconds64(cycles[cycles.size() / 2]),
+      FPlatformTime::ToMilliseconds64(cycles[cycles.size() * 99 / 100])));
+}
+
+// Stores, then hits, then misses the cache from 64 workers at once, so that
+// the latency of each kind of operation is measured under contention with
+// operations of the same kind.
+void RunConcurrentTest(
+    FAutomationTestBase& test,
+    CesiumAsync::ICacheDatabase& cache) {
+  const std::vector<std::byte> data(ResponseBytes, std::byte(0x2A));
+  const std::time_t expiry = std::time(nullptr) + 3600;
+
+  MeasureConcurrently(test, TEXT("Store"), [&](const std::string& key) {
+    cache.storeEntry(
+        key,
+        expiry,
+        key,
+        "GET",
+        CesiumAsync::HttpHeaders{},
+        200,
+        CesiumAsync::HttpHeaders{{"Content-Type", "application/octet-stream"}},
+        data);
+  });
+
+  std::atomic<int32> hits = 0;
+  MeasureConcurrently(test, TEXT("Hit"), [&](const std::string& key) {
+    if (cache.getEntry(key)) {
+      ++hits;
+    }
+  });
+  test.TestEqual(
+      "hits",
+      hits.load(),
+      int32(ConcurrentRequests * RequestsPerWorker));
+
+  MeasureConcurrently(test, TEXT("Miss"), [&](const std::string& key) {
+    cache.getEntry(key + "?missing");
+  });
+}
+
+FString CreateTemporaryPath() {
+  return FPaths::ConvertRelativePathToFull(
+      FPaths::CreateTempFilename(*FPaths::ProjectSavedDir()));
+}
+
+} // namespace
+
+bool FRequestCacheConcurrentSqlite::RunTest(const FString& Parameters) {
+  FString Filename = CreateTemporaryPath();
+  {
+    CesiumAsync::SqliteCache cache(
+        spdlog::default_logger(),
+        TCHAR_TO_UTF8(*Filename),
+        ConcurrentRequests * RequestsPerWorker);
+    RunConcurrentTest(*this, cache);
+  }
+  IFileManager::Get().Delete(*Filename);
+  return true;
+}
+
+bool FRequestCacheConcurrentShardedFiles::RunTest(const FString& Parameters) {
+  FString Directory = CreateTemporaryPath();
+  const int64 maximumBytes =
+      int64(ConcurrentRequests * RequestsPerWorker) * ResponseBytes * 2;
+  {
+    ShardedFileCache cache(Directory, maximumBytes);
+    RunConcurrentTest(*this, cache);
+  }
+
+  // Reopening the cache scans the existing entries in the background, so the
+  // first lookups don't wait for it.
+  {
+    const double start = FPlatformTime::Seconds();
+    ShardedFileCache cache(Directory, maximumBytes);
+    cache.getEntry(CreateKey(0, 0));
+    const double firstLookup = FPlatformTime::Seconds() - start;
+    cache.waitUntilScanned();
+    const double scanned = FPlatformTime::Seconds() - start;
+
+    AddInfo(FString::Printf(
+        TEXT("Reopened with %d entries: first lookup after %.3f ms, scan "
+             "finished after %.3f ms"),
+        ConcurrentRequests * RequestsPerWorker,
+        firstLookup * 1000.0,
+        scanned * 1000.0));
+  }
+
+  IFileManager::Get().DeleteDirectory(*Directory, false, true);
+  return true;
+}
@@ -27,6 +27,9 @@ bool RunSingleQueryTest(
 bool RunMultipleQueryTest(
     const FString& testName,
     std::function<void(SceneGenerationContext&)> setup);
+bool RunLargeBatchQueryTest(
+    const FString& testName,
+    std::function<void(SceneGenerationContext&)> setup);
 } // namespace
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -49,6 +52,11 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
     "Cesium.Performance.SampleHeightMostDetailed.Multiple queries against Google Photorealistic 3D Tiles",
     EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FSampleHeightMostDetailedCesiumWorldTerrainLargeBatch,
+    "Cesium.Performance.SampleHeightMostDetailed.Streaming 100k point query against Cesium World Terrain",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
 bool FSampleHeightMostDetailedCesiumWorldTerrainSingle::RunTest(
     const FString& Parameters) {
   return RunSingleQueryTest(
@@ -76,6 +84,13 @@ bool FSampleHeightMostDetailedGoogleMultiple::RunTest(
       setupDenverHillsGoogle);
 }
 
+bool FSampleHeightMostDetailedCesiumWorldTerrainLargeBatch::RunTest(
+    const FString& Parameters) {
+  return RunLargeBatchQueryTest(
+      this->GetBeautifiedTestName(),
+      setupDenverHillsCesiumWorldTerrain);
+}
+
 namespace {
 // Our test model path
 //
@@ -479,6 +494,127 @@ bool RunMultipleQueryTest(
   return RunLoadTest(testName, setup, testPasses, 1280, 720);
 }
 
+bool RunLargeBatchQueryTest(
+    const FString& testName,
+    std::function<void(SceneGenerationContext&)> setup) {
+  struct TestProcess {
+    TArray<FVector> positions;
+    TSharedPtr<FCesiumSampleHeightQuery> pQuery;
+    uint64 startCycles = 0;
+    int32 chunksReceived = 0;
+    int32 resultsReceived = 0;
+    int32 successCount = 0;
+    int32 warningCount = 0;
+    bool queryFinished = false;
+  };
+
+  auto pProcess = std::make_shared<TestProcess>();
+
+  // A dense grid of points around the camera position, in row order like a
+  // set of terrain profiles.
+  double testLongitude = -105.257595;
+  double testLatitude = 39.743103;
+
+  const int32 gridRowCount = 250;
+  const int32 gridColumnCount = 400;
+  double cartographicSpacing = 0.00005;
+
+  pProcess->positions.Reserve(gridRowCount * gridColumnCount);
+  for (int32 rowIndex = 0; rowIndex < gridRowCount; ++rowIndex) {
+    double rowLatitude = testLatitude + (cartographicSpacing * rowIndex);
+
+    for (int32 columnIndex = 0; columnIndex < gridColumnCount; ++columnIndex) {
+      pProcess->positions.Emplace(
+          testLongitude + (cartographicSpacing * columnIndex),
+          rowLatitude,
+          0.0);
+    }
+  }
+
+  auto clearCache = [](SceneGenerationContext&, TestPass::TestingParameter) {
+    std::shared_ptr<CesiumAsync::ICacheDatabase> pCacheDatabase =
+        getCacheDatabase();
+    pCacheDatabase->clearAll();
+  };
+
+  auto issueQueries = [pProcess](
+                          SceneGenerationContext& context,
+                          TestPass::TestingParameter) {
+    ACesium3DTileset* tileset = context.tilesets[0];
+
+    pProcess->startCycles = FPlatformTime::Cycles64();
+    pProcess->pQuery = tileset->SampleHeightMostDetailedStreaming(
+        pProcess->positions,
+        FCesiumSampleHeightChunkCallback::CreateLambda(
+            [pProcess](
+                ACesium3DTileset* pTileset,
+                int32 startIndex,
+                const TArray<FCesiumSampleHeightResult>& results,
+                const TArray<FString>& warnings) {
+              ++pProcess->chunksReceived;
+              pProcess->resultsReceived += results.Num();
+              pProcess->warningCount += warnings.Num();
+              for (const FCesiumSampleHeightResult& result : results) {
+                if (result.SampleSuccess)
+                  ++pProcess->successCount;
+              }
+            }),
+        FCesiumSampleHeightQueryCompleteCallback::CreateLambda(
+            [pProcess](bool success) { pProcess->queryFinished = true; }),
+        2048,
+        8);
+  };
+
+  auto waitForQueries = [pProcess](
+                            SceneGenerationContext&,
+                            SceneGenerationContext&,
+                            TestPass::TestingParameter) {
+    return pProcess->queryFinished;
+  };
+
+  auto reportResults = [pProcess](
+                           SceneGenerationContext& creationContext,
+                           SceneGenerationContext&,
+                           TestPass::TestingParameter) {
+    const double elapsedSeconds = FPlatformTime::ToSeconds64(
+        FPlatformTime::Cycles64() - pProcess->startCycles);
+
+    UE_LOG(
+        LogCesium,
+        Display,
+        TEXT(
+            "Sampled %d of %d heights in %d chunks in %.2f seconds (%.0f heights per second), with %d warnings."),
+        pProcess->successCount,
+        pProcess->positions.Num(),
+        pProcess->chunksReceived,
+        elapsedSeconds,
+        double(pProcess->resultsReceived) / FMath::Max(elapsedSeconds, 1e-6),
+        pProcess->warningCount);
+
+    if (pProcess->resultsReceived != pProcess->positions.Num()) {
+      UE_LOG(
+          LogCesium,
+          Error,
+          TEXT("Received %d results for %d positions."),
+          pProcess->resultsReceived,
+          pProcess->positions.Num());
+    }
+
+    // Turn on the editor tileset updates so we can see what we loaded
+    creationContext.setSuspendUpdate(false);
+    return true;
+  };
+
+  std::vector<TestPass> testPasses;
+  testPasses.push_back(
+      TestPass{"Load terrain from cold cache", clearCache, nullptr});
+  testPasses.push_back(
+      TestPass{"Issue height queries and wait", issueQueries, waitForQueries});
+  testPasses.push_back(TestPass{"Report results", nullptr, reportResults});
+
+  return RunLoadTest(testName, setup, testPasses, 1280, 720);
+}
+
 } // namespace
 
 #endif
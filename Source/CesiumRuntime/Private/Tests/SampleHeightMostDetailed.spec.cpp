@@ -355,6 +355,85 @@ void FSampleHeightMostDetailedSpec::Define() {
                   }));
         });
 
+    LatentIt(
+        "tileset destroyed during the query",
+        EAsyncExecution::TaskGraphMainThread,
+        [this](const FDoneDelegate& done) {
+          UWorld* pWorld = CesiumTestHelpers::getGlobalWorldContext();
+
+          ACesium3DTileset* pTileset = pWorld->SpawnActor<ACesium3DTileset>();
+          pTileset->SetIonAssetID(1);
+#if WITH_EDITOR
+          pTileset->SetIonAccessToken(
+              Cesium::SceneGenerationContext::testIonToken);
+#endif
+
+          pTileset->SampleHeightMostDetailed(
+              {FVector(-105.1, 40.1, 1.0)},
+              FCesiumSampleHeightMostDetailedCallback::CreateLambda(
+                  [this, done](
+                      ACesium3DTileset* pTileset,
+                      const TArray<FCesiumSampleHeightResult>& result,
+                      const TArray<FString>& warnings) {
+                    TestNull("Tileset", pTileset);
+                    TestEqual("Number of results", result.Num(), 1);
+                    TestTrue("Has warnings", warnings.Num() > 0);
+                    TestFalse("SampleSuccess", result[0].SampleSuccess);
+                    TestEqual(
+                        "Height",
+                        result[0].LongitudeLatitudeHeight.Z,
+                        1.0,
+                        1e-12);
+                    done.ExecuteIfBound();
+                  }));
+
+          pTileset->Destroy();
+        });
+
+    LatentIt(
+        "tileset destroyed during a streaming query",
+        EAsyncExecution::TaskGraphMainThread,
+        [this](const FDoneDelegate& done) {
+          UWorld* pWorld = CesiumTestHelpers::getGlobalWorldContext();
+
+          ACesium3DTileset* pTileset = pWorld->SpawnActor<ACesium3DTileset>();
+          pTileset->SetIonAssetID(1);
+#if WITH_EDITOR
+          pTileset->SetIonAccessToken(
+              Cesium::SceneGenerationContext::testIonToken);
+#endif
+
+          TArray<FVector> positions;
+          for (int32 i = 0; i < 100; ++i) {
+            positions.Emplace(-105.1 + i * 0.001, 40.1, 1.0);
+          }
+
+          TSharedRef<int32> pResultCount = MakeShared<int32>(0);
+          pTileset->SampleHeightMostDetailedStreaming(
+              positions,
+              FCesiumSampleHeightChunkCallback::CreateLambda(
+                  [this, pResultCount](
+                      ACesium3DTileset* pTileset,
+                      int32 startIndex,
+                      const TArray<FCesiumSampleHeightResult>& result,
+                      const TArray<FString>& warnings) {
+                    *pResultCount += result.Num();
+                    for (const FCesiumSampleHeightResult& sample : result) {
+                      TestFalse("SampleSuccess", sample.SampleSuccess);
+                    }
+                  }),
+              FCesiumSampleHeightQueryCompleteCallback::CreateLambda(
+                  [this, done, pResultCount](bool success) {
+                    TestFalse("Success", success);
+                    TestTrue("Some results missing", *pResultCount < 100);
+                    done.ExecuteIfBound();
+                  }),
+              10,
+              2);
+
+          pTileset->Destroy();
+        });
+
     LatentIt(
         "tileset parameter is nullptr",
         EAsyncExecution::TaskGraphMainThread,
@@ -0,0 +1,170 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "ShardedFileCache.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <CesiumAsync/CacheItem.h>
+THIRD_PARTY_INCLUDES_END
+
+#include <ctime>
+#include <vector>
+
+BEGIN_DEFINE_SPEC(
+    FShardedFileCacheSpec,
+    "Cesium.Unit.ShardedFileCache",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+
+FString Directory;
+
+bool Store(
+    ShardedFileCache& cache,
+    const std::string& key,
+    size_t dataSize,
+    std::time_t expiryTime = std::time(nullptr) + 3600) {
+  std::vector<std::byte> data(dataSize, std::byte(0x2A));
+  return cache.storeEntry(
+      key,
+      expiryTime,
+      "https://example.com/" + key,
+      "GET",
+      CesiumAsync::HttpHeaders{{"Accept", "*/*"}},
+      200,
+      CesiumAsync::HttpHeaders{{"Content-Type", "application/octet-stream"}},
+      data);
+}
+
+END_DEFINE_SPEC(FShardedFileCacheSpec)
+
+void FShardedFileCacheSpec::Define() {
+  BeforeEach([this]() {
+    Directory = FPaths::ConvertRelativePathToFull(
+        FPaths::CreateTempFilename(*FPaths::ProjectSavedDir()));
+  });
+
+  AfterEach([this]() {
+    IFileManager::Get().DeleteDirectory(*Directory, false, true);
+  });
+
+  It("round-trips an entry", [this]() {
+    ShardedFileCache cache(Directory, 1024 * 1024);
+    TestTrue("stored", Store(cache, "tile", 100));
+
+    std::optional<CesiumAsync::CacheItem> maybeItem = cache.getEntry("tile");
+    if (!TestTrue("found", maybeItem.has_value()))
+      return;
+
+    const CesiumAsync::CacheItem& item = *maybeItem;
+    TestEqual(
+        "url",
+        item.cacheRequest.url,
+        std::string("https://example.com/tile"));
+    TestEqual("method", item.cacheRequest.method, std::string("GET"));
+    TestEqual("status", item.cacheResponse.statusCode, uint16_t(200));
+    TestEqual("data size", item.cacheResponse.data.size(), size_t(100));
+    TestEqual(
+        "content type",
+        item.cacheResponse.headers.at("content-type"),
+        std::string("application/octet-stream"));
+
+    TestFalse("missing", cache.getEntry("other").has_value());
+  });
+
+  It("finds existing entries when reopened", [this]() {
+    {
+      ShardedFileCache cache(Directory, 1024 * 1024);
+      Store(cache, "tile", 100);
+    }
+
+    ShardedFileCache cache(Directory, 1024 * 1024);
+    cache.waitUntilScanned();
+    TestTrue("found", cache.getEntry("tile").has_value());
+    TestTrue("size", cache.getTotalBytes() > 100);
+  });
+
+  It("prunes expired entries found when reopened", [this]() {
+    {
+      ShardedFileCache cache(Directory, 1024 * 1024);
+      Store(cache, "old", 100, std::time(nullptr) - 10);
+      Store(cache, "new", 100);
+    }
+
+    ShardedFileCache cache(Directory, 1024 * 1024);
+    cache.waitUntilScanned();
+    const int64 bytesBeforePrune = cache.getTotalBytes();
+
+    // The expired entry is pruned without ever having been read.
+    TestTrue("prune", cache.prune());
+    TestTrue("smaller", cache.getTotalBytes() < bytesBeforePrune);
+    TestFalse("old", cache.getEntry("old").has_value());
+    TestTrue("new", cache.getEntry("new").has_value());
+  });
+
+  It("keeps entries stored again while being removed", [this]() {
+    // Expired entries are removed by prune while another thread keeps
+    // storing the same keys with a new expiry time. Whatever the
+    // interleaving, every entry in the index has its file.
+    ShardedFileCache cache(Directory, 1024 * 1024);
+    for (int32 round = 0; round < 20; ++round) {
+      for (int32 i = 0; i < 16; ++i) {
+        Store(cache, "tile-" + std::to_string(i), 100, std::time(nullptr) - 10);
+      }
+
+      TFuture<void> pruning =
+          Async(EAsyncExecution::Thread, [&cache]() { cache.prune(); });
+      for (int32 i = 0; i < 16; ++i) {
+        Store(cache, "tile-" + std::to_string(i), 100);
+      }
+      pruning.Wait();
+
+      for (int32 i = 0; i < 16; ++i) {
+        TestTrue(
+            "stored entry found",
+            cache.getEntry("tile-" + std::to_string(i)).has_value());
+      }
+    }
+  });
+
+  It("evicts least-recently-used entries when over budget", [this]() {
+    // Each shard gets 1/16th of the budget, so a budget of 16 * 3000 bytes
+    // fits two 1000-byte entries per shard, but not three.
+    ShardedFileCache cache(Directory, 16 * 3000);
+
+    std::vector<std::string> keys;
+    for (int32 i = 0; i < 200; ++i) {
+      keys.push_back("tile-" + std::to_string(i));
+      Store(cache, keys.back(), 1000);
+      TestTrue("within budget", cache.getTotalBytes() <= 16 * 3000);
+    }
+
+    // The most recent entry always survives.
+    TestTrue("newest", cache.getEntry(keys.back()).has_value());
+  });
+
+  It("prunes expired entries", [this]() {
+    ShardedFileCache cache(Directory, 1024 * 1024);
+    Store(cache, "old", 100, std::time(nullptr) - 10);
+    Store(cache, "new", 100);
+
+    TestTrue("prune", cache.prune());
+    TestFalse("old", cache.getEntry("old").has_value());
+    TestTrue("new", cache.getEntry("new").has_value());
+  });
+
+  It("clears all entries", [this]() {
+    ShardedFileCache cache(Directory, 1024 * 1024);
+    Store(cache, "a", 100);
+    Store(cache, "b", 100);
+
+    TestTrue("clearAll", cache.clearAll());
+    TestEqual("size", cache.getTotalBytes(), int64(0));
+    TestFalse("a", cache.getEntry("a").has_value());
+    TestFalse("b", cache.getEntry("b").has_value());
+  });
+}
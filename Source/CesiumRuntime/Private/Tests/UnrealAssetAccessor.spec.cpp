@@ -4,10 +4,16 @@
 #include "Async/Async.h"
 #include "CesiumAsync/IAssetResponse.h"
 #include "CesiumRuntime.h"
+#include "HAL/Event.h"
 #include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/AutomationTest.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "UnrealHttpHeaders.h"
+#include "UnrealTaskProcessor.h"
+#include <atomic>
 
 BEGIN_DEFINE_SPEC(
     FUnrealAssetAccessorSpec,
@@ -21,10 +27,13 @@ FString Filename;
 std::string randomText = "Some random text.";
 IPlatformFile* FileManager;
 
-void TestAccessorRequest(const FString& Uri, const std::string& expectedData) {
+void TestAccessorRequest(
+    const FString& Uri,
+    const std::string& expectedData,
+    bool useMemoryMappedFiles = false) {
   bool done = false;
 
-  UnrealAssetAccessor accessor{};
+  UnrealAssetAccessor accessor(useMemoryMappedFiles);
   accessor.get(getAsyncSystem(), TCHAR_TO_UTF8(*Uri), {})
       .thenInMainThread(
           [&](std::shared_ptr<CesiumAsync::IAssetRequest>&& pRequest) {
@@ -48,8 +57,63 @@ void TestAccessorRequest(const FString& Uri, const std::string& expectedData) {
   }
 }
 
+void WaitFor(const std::atomic<int32>& counter, int32 expected) {
+  const double timeout = FPlatformTime::Seconds() + 10.0;
+  while (counter.load() < expected && FPlatformTime::Seconds() < timeout) {
+    FPlatformProcess::Sleep(0.001f);
+  }
+}
+
 END_DEFINE_SPEC(FUnrealAssetAccessorSpec)
 
+namespace {
+class FakeFileRequest : public CesiumAsync::IAssetRequest {
+public:
+  explicit FakeFileRequest(const std::string& url) : _url(url) {}
+
+  virtual const std::string& method() const override { return this->_method; }
+  virtual const std::string& url() const override { return this->_url; }
+  virtual const CesiumAsync::HttpHeaders& headers() const override {
+    return this->_headers;
+  }
+  virtual const CesiumAsync::IAssetResponse* response() const override {
+    return nullptr;
+  }
+
+private:
+  std::string _method = "GET";
+  std::string _url;
+  CesiumAsync::HttpHeaders _headers;
+};
+
+// Reads files without touching the file system, blocking every read until
+// `pRelease` is triggered.
+struct BlockingFileReader {
+  FEvent* pRelease = FPlatformProcess::GetSynchEventFromPool(true);
+  std::atomic<int32> started = 0;
+  std::atomic<int32> active = 0;
+  std::atomic<int32> maximumActive = 0;
+
+  ~BlockingFileReader() { FPlatformProcess::ReturnSynchEventToPool(pRelease); }
+
+  UnrealAssetAccessor::FileReader createReader() {
+    return [this](const std::string& url) {
+      const int32 nowActive = ++this->active;
+      int32 maximum = this->maximumActive.load();
+      while (nowActive > maximum &&
+             !this->maximumActive.compare_exchange_weak(maximum, nowActive)) {
+      }
+      ++this->started;
+
+      this->pRelease->Wait();
+
+      --this->active;
+      return std::make_shared<FakeFileRequest>(url);
+    };
+  }
+};
+} // namespace
+
 void FUnrealAssetAccessorSpec::Define() {
   BeforeEach([this]() {
     Filename = FPaths::ConvertRelativePathToFull(
@@ -81,6 +145,222 @@ void FUnrealAssetAccessorSpec::Define() {
     TestAccessorRequest(Uri, randomText);
   });
 
+  It("Can access file:/// URLs with memory mapping", [this]() {
+    FString Uri = TEXT("file:///") + Filename;
+    Uri.ReplaceCharInline('\\', '/');
+    Uri.ReplaceInline(TEXT(" "), TEXT("%20"));
+
+    TestAccessorRequest(Uri, randomText, true);
+  });
+
+  It("Fails with non-existant file:/// URLs with memory mapping", [this]() {
+    FString Uri = TEXT("file:///") + Filename;
+    Uri.ReplaceCharInline('\\', '/');
+    Uri.ReplaceInline(TEXT(" "), TEXT("%20"));
+    Uri += ".bogusExtension";
+
+    TestAccessorRequest(Uri, "", true);
+  });
+
+  It("Shares a single read between simultaneous requests for a file:/// URL",
+     [this]() {
+       const std::string url = "file:///shared.glb";
+
+       BlockingFileReader reader;
+       UnrealAssetAccessor accessor(reader.createReader(), 1);
+
+       std::vector<std::shared_ptr<CesiumAsync::IAssetRequest>> results;
+       auto request = [&]() {
+         accessor.get(getAsyncSystem(), url, {})
+             .thenInMainThread(
+                 [&results](
+                     std::shared_ptr<CesiumAsync::IAssetRequest>&& pRequest) {
+                   results.emplace_back(std::move(pRequest));
+                 });
+       };
+
+       // Hold the first read open until the others have been requested, so
+       // that they are certain to arrive while it is in flight.
+       request();
+       WaitFor(reader.started, 1);
+       request();
+       request();
+       reader.pRelease->Trigger();
+
+       const double timeout = FPlatformTime::Seconds() + 10.0;
+       while (results.size() < 3 && FPlatformTime::Seconds() < timeout) {
+         accessor.tick();
+         getAsyncSystem().dispatchMainThreadTasks();
+       }
+
+       TestEqual("reads", reader.started.load(), 1);
+       if (TestEqual("results", results.size(), size_t(3))) {
+         TestEqual("first and second", results[0], results[1]);
+         TestEqual("first and third", results[0], results[2]);
+         TestEqual("url", results[0]->url(), url);
+       }
+     });
+
+  It("Queues file:/// reads beyond the maximum simultaneous reads", [this]() {
+    BlockingFileReader reader;
+    UnrealAssetAccessor accessor(reader.createReader(), 2);
+
+    std::atomic<int32> completed = 0;
+    for (int32 i = 0; i < 5; ++i) {
+      const std::string url = "file:///tile" + std::to_string(i) + ".glb";
+      accessor.get(getAsyncSystem(), url, {})
+          .thenImmediately(
+              [&completed](std::shared_ptr<CesiumAsync::IAssetRequest>&&) {
+                ++completed;
+              });
+    }
+
+    // Reads are started synchronously, so the excess requests are already
+    // queued even before the first reads begin running.
+    TestEqual("queued", accessor.getQueuedFileReadCount(), 3);
+    WaitFor(reader.started, 2);
+    TestEqual("started", reader.started.load(), 2);
+    TestEqual("still queued", accessor.getQueuedFileReadCount(), 3);
+
+    reader.pRelease->Trigger();
+    WaitFor(completed, 5);
+
+    TestEqual("completed", completed.load(), 5);
+    TestEqual("all started", reader.started.load(), 5);
+    TestEqual("queued after", accessor.getQueuedFileReadCount(), 0);
+    TestTrue("bounded", reader.maximumActive.load() <= 2);
+  });
+
+  It("Continues file:/// reads in the lane they were requested in", [this]() {
+    BlockingFileReader reader;
+    UnrealAssetAccessor accessor(reader.createReader(), 1);
+
+    std::atomic<int32> completed = 0;
+    std::atomic<UnrealTaskProcessor::Priority> continuationPriority =
+        UnrealTaskProcessor::Priority::Background;
+    {
+      UnrealTaskProcessor::ScopedPriority scope(
+          UnrealTaskProcessor::Priority::Visible);
+      accessor.get(getAsyncSystem(), "file:///visible.glb", {})
+          .thenImmediately(
+              [&continuationPriority](
+                  std::shared_ptr<CesiumAsync::IAssetRequest>&&) {
+                continuationPriority =
+                    UnrealTaskProcessor::getCurrentPriority();
+              })
+          .thenImmediately([&completed]() { ++completed; });
+    }
+
+    // The read completes on an I/O thread, which has no lane of its own.
+    reader.pRelease->Trigger();
+    WaitFor(completed, 1);
+
+    TestEqual("completed", completed.load(), 1);
+    TestTrue(
+        "continuation lane",
+        continuationPriority.load() == UnrealTaskProcessor::Priority::Visible);
+  });
+
+  It("Completes a shared file:/// read in the most urgent lane", [this]() {
+    const std::string url = "file:///shared.glb";
+
+    BlockingFileReader reader;
+    UnrealAssetAccessor accessor(reader.createReader(), 1);
+
+    std::atomic<int32> completed = 0;
+    std::atomic<UnrealTaskProcessor::Priority> continuationPriority =
+        UnrealTaskProcessor::Priority::Background;
+    auto request = [&](UnrealTaskProcessor::Priority priority) {
+      UnrealTaskProcessor::ScopedPriority scope(priority);
+      accessor.get(getAsyncSystem(), url, {})
+          .thenImmediately(
+              [&continuationPriority](
+                  std::shared_ptr<CesiumAsync::IAssetRequest>&&) {
+                continuationPriority =
+                    UnrealTaskProcessor::getCurrentPriority();
+              })
+          .thenImmediately([&completed]() { ++completed; });
+    };
+
+    // The read is started by a preload request, and then becomes needed by a
+    // visible tile while it is in flight.
+    request(UnrealTaskProcessor::Priority::Preload);
+    WaitFor(reader.started, 1);
+    request(UnrealTaskProcessor::Priority::Visible);
+    reader.pRelease->Trigger();
+    WaitFor(completed, 2);
+
+    TestEqual("completed", completed.load(), 2);
+    TestEqual("reads", reader.started.load(), 1);
+    TestTrue(
+        "continuation lane",
+        continuationPriority.load() == UnrealTaskProcessor::Priority::Visible);
+  });
+
+  Describe("UnrealHttpHeaders", [this]() {
+    It("parses keys and values", [this]() {
+      TArray<FString> unrealHeaders{
+          TEXT("Content-Type: application/json"),
+          TEXT("Cache-Control:max-age=3600"),
+          TEXT("ETag: \"abc:123\""),
+          TEXT("content-type: text/plain"),
+          TEXT("Not a header")};
+
+      CesiumAsync::HttpHeaders headers =
+          UnrealHttpHeaders::parse(unrealHeaders);
+      TestEqual("size", headers.size(), size_t(3));
+      TestEqual(
+          "Content-Type",
+          headers["Content-Type"],
+          std::string("application/json"));
+      TestEqual(
+          "Cache-Control",
+          headers["cache-control"],
+          std::string("max-age=3600"));
+      TestEqual("ETag", headers["ETag"], std::string("\"abc:123\""));
+    });
+
+    It("measures per-response parsing overhead", [this]() {
+      // A header set typical of a tile response from a CDN.
+      TArray<FString> unrealHeaders{
+          TEXT("Accept-Ranges: bytes"),
+          TEXT("Access-Control-Allow-Origin: *"),
+          TEXT("Age: 1234"),
+          TEXT("Cache-Control: public, max-age=86400"),
+          TEXT("Content-Encoding: gzip"),
+          TEXT("Content-Length: 123456"),
+          TEXT("Content-Type: application/octet-stream"),
+          TEXT("Date: Fri, 16 Oct 2026 12:00:00 GMT"),
+          TEXT("ETag: \"0123456789abcdef0123456789abcdef\""),
+          TEXT("Expires: Sat, 17 Oct 2026 12:00:00 GMT"),
+          TEXT("Last-Modified: Thu, 01 Oct 2026 12:00:00 GMT"),
+          TEXT("Server: cloudflare"),
+          TEXT("Vary: Accept-Encoding, Origin"),
+          TEXT("Via: 1.1 varnish"),
+          TEXT("X-Cache: HIT")};
+
+      const int32 iterations = 2000;
+      size_t total = 0;
+      const double start = FPlatformTime::Seconds();
+      for (int32 i = 0; i < iterations; ++i) {
+        total += UnrealHttpHeaders::parse(unrealHeaders).size();
+      }
+      const double elapsed = FPlatformTime::Seconds() - start;
+
+      TestEqual(
+          "headers parsed",
+          total,
+          size_t(iterations) * size_t(unrealHeaders.Num()));
+      AddInfo(FString::Printf(
+          TEXT("Parsed %d responses with %d headers each in %.3f ms (%.2f "
+               "us per response)."),
+          iterations,
+          unrealHeaders.Num(),
+          elapsed * 1000.0,
+          elapsed * 1000000.0 / double(iterations)));
+    });
+  });
+
   It("Can access file:/// URLs with unnecessary query params", [this]() {
     FString Uri = TEXT("file:///") + Filename;
     Uri.ReplaceCharInline('\\', '/');
@@ -0,0 +1,214 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "UnrealTaskProcessor.h"
+#include "BackgroundPruningCacheDatabase.h"
+#include "CesiumRuntime.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeLock.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <CesiumAsync/CacheItem.h>
+THIRD_PARTY_INCLUDES_END
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+BEGIN_DEFINE_SPEC(
+    FUnrealTaskProcessorSpec,
+    "Cesium.Unit.UnrealTaskProcessor",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+
+using Priority = UnrealTaskProcessor::Priority;
+
+void WaitFor(const std::atomic<int32>& counter, int32 expected) {
+  const double timeout = FPlatformTime::Seconds() + 10.0;
+  while (counter.load() < expected && FPlatformTime::Seconds() < timeout) {
+    FPlatformProcess::Sleep(0.001f);
+  }
+}
+
+END_DEFINE_SPEC(FUnrealTaskProcessorSpec)
+
+namespace {
+class FakeCacheDatabase : public CesiumAsync::ICacheDatabase {
+public:
+  virtual std::optional<CesiumAsync::CacheItem>
+  getEntry(const std::string& key) const override {
+    return std::nullopt;
+  }
+
+  virtual bool storeEntry(
+      const std::string& key,
+      std::time_t expiryTime,
+      const std::string& url,
+      const std::string& requestMethod,
+      const CesiumAsync::HttpHeaders& requestHeaders,
+      uint16_t statusCode,
+      const CesiumAsync::HttpHeaders& responseHeaders,
+      const std::span<const std::byte>& responseData) override {
+    return true;
+  }
+
+  virtual bool prune() override {
+    this->pruneWasBackground =
+        this->pProcessor
+            ->getStatistics(UnrealTaskProcessor::Priority::Background)
+            .started > this->backgroundStarted;
+    ++this->pruned;
+    return true;
+  }
+
+  virtual bool clearAll() override { return true; }
+
+  std::shared_ptr<UnrealTaskProcessor> pProcessor;
+  uint64 backgroundStarted = 0;
+  std::atomic<bool> pruneWasBackground = false;
+  std::atomic<int32> pruned = 0;
+};
+} // namespace
+
+void FUnrealTaskProcessorSpec::Define() {
+  It("runs tasks on the worker pool", [this]() {
+    UnrealTaskProcessor processor(2);
+    TestEqual("thread count", processor.getThreadCount(), 2);
+
+    std::atomic<int32> completed = 0;
+    for (int32 i = 0; i < 100; ++i) {
+      processor.startTask([&completed]() { ++completed; });
+    }
+
+    WaitFor(completed, 100);
+    TestEqual("completed", completed.load(), 100);
+
+    UnrealTaskProcessor::LaneStatistics stats =
+        processor.getStatistics(Priority::Preload);
+    TestEqual("started", stats.started, uint64(100));
+    TestEqual("queued", stats.queued, uint32(0));
+
+    processor.shutdown();
+  });
+
+  It("dequeues higher priority lanes first", [this]() {
+    UnrealTaskProcessor processor(1);
+
+    // Block the only worker so that the remaining tasks queue up.
+    FEvent* pRelease = FPlatformProcess::GetSynchEventFromPool(true);
+    std::atomic<int32> blocked = 0;
+    std::atomic<int32> completed = 0;
+    processor.startTask([pRelease, &blocked, &completed]() {
+      ++blocked;
+      pRelease->Wait();
+      ++completed;
+    });
+    WaitFor(blocked, 1);
+
+    std::vector<Priority> order;
+    FCriticalSection orderLock;
+    auto record = [&order, &orderLock, &completed](Priority priority) {
+      {
+        FScopeLock lock(&orderLock);
+        order.push_back(priority);
+      }
+      ++completed;
+    };
+
+    {
+      UnrealTaskProcessor::ScopedPriority scope(Priority::Background);
+      processor.startTask([record]() { record(Priority::Background); });
+    }
+    processor.startTask([record]() { record(Priority::Preload); });
+    {
+      UnrealTaskProcessor::ScopedPriority scope(Priority::Visible);
+      processor.startTask([record]() { record(Priority::Visible); });
+    }
+
+    TestEqual(
+        "queued visible",
+        processor.getStatistics(Priority::Visible).queued,
+        uint32(1));
+    TestEqual(
+        "queued background",
+        processor.getStatistics(Priority::Background).queued,
+        uint32(1));
+
+    pRelease->Trigger();
+    WaitFor(completed, 4);
+    FPlatformProcess::ReturnSynchEventToPool(pRelease);
+
+    if (TestEqual("order size", order.size(), size_t(3))) {
+      TestEqual("first", order[0], Priority::Visible);
+      TestEqual("second", order[1], Priority::Preload);
+      TestEqual("third", order[2], Priority::Background);
+    }
+
+    processor.shutdown();
+  });
+
+  It("continuations inherit the lane of their parent", [this]() {
+    UnrealTaskProcessor processor(2);
+
+    std::atomic<int32> completed = 0;
+    {
+      UnrealTaskProcessor::ScopedPriority scope(Priority::Visible);
+      processor.startTask([&processor, &completed]() {
+        processor.startTask([&completed]() { ++completed; });
+        ++completed;
+      });
+    }
+
+    WaitFor(completed, 2);
+    TestEqual(
+        "visible started",
+        processor.getStatistics(Priority::Visible).started,
+        uint64(2));
+    TestEqual(
+        "preload started",
+        processor.getStatistics(Priority::Preload).started,
+        uint64(0));
+
+    processor.shutdown();
+  });
+
+  It("prunes the request cache in the background lane", [this]() {
+    std::shared_ptr<FakeCacheDatabase> pFake =
+        std::make_shared<FakeCacheDatabase>();
+    pFake->pProcessor = getTaskProcessor();
+    if (pFake->pProcessor->getThreadCount() == 0) {
+      // Without the worker pool, tasks go to the engine and aren't counted.
+      return;
+    }
+    pFake->backgroundStarted =
+        pFake->pProcessor->getStatistics(Priority::Background).started;
+
+    // Prune from a visible-lane context, as cesium-native would while loading
+    // a visible tile.
+    BackgroundPruningCacheDatabase database(pFake);
+    {
+      UnrealTaskProcessor::ScopedPriority scope(Priority::Visible);
+      TestTrue("prune", database.prune());
+    }
+
+    WaitFor(pFake->pruned, 1);
+    TestEqual("pruned", pFake->pruned.load(), 1);
+    TestTrue("background", pFake->pruneWasBackground.load());
+  });
+
+  It("falls back to the engine after shutdown", [this]() {
+    UnrealTaskProcessor processor(1);
+    processor.shutdown();
+    TestEqual("thread count", processor.getThreadCount(), 0);
+
+    std::atomic<int32> completed = 0;
+    processor.startTask([&completed]() { ++completed; });
+    WaitFor(completed, 1);
+    TestEqual("completed", completed.load(), 1);
+  });
+}
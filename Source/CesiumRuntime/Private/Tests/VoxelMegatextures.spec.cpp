@@ -0,0 +1,184 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "CesiumGltfVoxelComponent.h"
+#include "CesiumVoxelMetadataComponent.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+#include "VoxelMegatextures.h"
+
+BEGIN_DEFINE_SPEC(
+    FVoxelMegatexturesSpec,
+    "Cesium.Unit.VoxelMegatextures",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter | EAutomationTestFlags::NonNullRHI)
+
+// Each tile holds a single uint8 property, sized so that a fixed number of
+// tiles are uploaded per frame.
+static constexpr uint32 UploadsPerFrame = 4;
+
+FCesiumVoxelClassDescription description;
+TUniquePtr<FVoxelMegatextures> pMegatextures;
+UCesiumGltfVoxelComponent* pComponent;
+
+void CreateMegatextures(uint32 tileCount) {
+  FCesiumPropertyAttributePropertyDescription& property =
+      description.Properties.Emplace_GetRef();
+  property.Name = "a";
+  property.EncodingDetails = FCesiumMetadataEncodingDetails(
+      ECesiumEncodedMetadataType::Scalar,
+      ECesiumEncodedMetadataComponentType::Uint8,
+      ECesiumEncodedMetadataConversion::Coerce);
+
+  const uint32 slotBytes =
+      FVoxelMegatextures::MaximumUploadBytesPerFrame / UploadsPerFrame;
+  pMegatextures = MakeUnique<FVoxelMegatextures>(
+      description,
+      glm::uvec3(128, 128, slotBytes / (128 * 128)),
+      GMaxRHIFeatureLevel,
+      tileCount);
+}
+
+void WaitForConversions() {
+  while (!pMegatextures->canBeDestroyed()) {
+    FPlatformProcess::Sleep(0.001f);
+  }
+}
+
+uint32 CountLoadedSlots() {
+  uint32 count = 0;
+  for (uint32 i = 0; i < pMegatextures->getMaximumTileCount(); ++i) {
+    count += pMegatextures->isSlotLoaded(int64(i)) ? 1 : 0;
+  }
+  return count;
+}
+
+END_DEFINE_SPEC(FVoxelMegatexturesSpec)
+
+void FVoxelMegatexturesSpec::Define() {
+  Describe("findStagingOffset", [this]() {
+    It("starts at the beginning of an unused buffer", [this]() {
+      TestTrue(
+          "offset",
+          FVoxelMegatextures::findStagingOffset(40, 10, std::nullopt, 0) ==
+              size_t(0));
+    });
+
+    It("fails for a region larger than the buffer", [this]() {
+      TestFalse(
+          "offset",
+          FVoxelMegatextures::findStagingOffset(40, 50, std::nullopt, 0)
+              .has_value());
+    });
+
+    It("follows the newest region", [this]() {
+      TestTrue(
+          "offset",
+          FVoxelMegatextures::findStagingOffset(40, 10, 0, 10) == size_t(20));
+    });
+
+    It("wraps to the beginning once the end is used", [this]() {
+      TestTrue(
+          "offset",
+          FVoxelMegatextures::findStagingOffset(40, 10, 20, 30) == size_t(0));
+      // The leftover bytes at the end are too few for a region.
+      TestTrue(
+          "offset with leftover bytes",
+          FVoxelMegatextures::findStagingOffset(35, 10, 10, 20) == size_t(0));
+    });
+
+    It("follows the newest region after wrapping", [this]() {
+      TestTrue(
+          "offset",
+          FVoxelMegatextures::findStagingOffset(40, 10, 20, 0) == size_t(10));
+    });
+
+    It("fails when the buffer is full", [this]() {
+      TestFalse(
+          "full without wrapping",
+          FVoxelMegatextures::findStagingOffset(40, 10, 0, 30).has_value());
+      TestFalse(
+          "full after wrapping",
+          FVoxelMegatextures::findStagingOffset(40, 10, 20, 10).has_value());
+      TestFalse(
+          "no room before the oldest region",
+          FVoxelMegatextures::findStagingOffset(35, 10, 5, 20).has_value());
+    });
+  });
+
+  Describe("submitUploads", [this]() {
+    BeforeEach([this]() {
+      description = FCesiumVoxelClassDescription();
+      pComponent = NewObject<UCesiumGltfVoxelComponent>();
+    });
+
+    AfterEach([this]() {
+      if (pMegatextures) {
+        FlushRenderingCommands();
+        WaitForConversions();
+        pMegatextures.Reset();
+      }
+    });
+
+    It("uploads a limited number of bytes per frame", [this]() {
+      const uint32 tileCount = 2 * UploadsPerFrame;
+      CreateMegatextures(tileCount);
+      if (!TestTrue(
+              "slot count",
+              pMegatextures->getMaximumTileCount() >= tileCount)) {
+        return;
+      }
+
+      for (uint32 i = 0; i < tileCount; ++i) {
+        TestTrue("slot", pMegatextures->add(*pComponent) >= 0);
+      }
+      WaitForConversions();
+
+      pMegatextures->submitUploads();
+      FlushRenderingCommands();
+      TestTrue("first frame loaded", pMegatextures->pollLoadingSlots());
+      TestEqual("first frame", CountLoadedSlots(), UploadsPerFrame);
+
+      pMegatextures->submitUploads();
+      FlushRenderingCommands();
+      TestTrue("second frame loaded", pMegatextures->pollLoadingSlots());
+      TestEqual("second frame", CountLoadedSlots(), tileCount);
+    });
+
+    It("skips slots released before their data was uploaded", [this]() {
+      CreateMegatextures(1);
+      const int64 slot = pMegatextures->add(*pComponent);
+      if (!TestTrue("slot", slot >= 0)) {
+        return;
+      }
+
+      TestTrue("release", pMegatextures->release(slot));
+      WaitForConversions();
+
+      pMegatextures->submitUploads();
+      FlushRenderingCommands();
+      TestFalse("any loaded", pMegatextures->pollLoadingSlots());
+      TestFalse("slot loaded", pMegatextures->isSlotLoaded(slot));
+    });
+
+    It("loads the new occupant of a slot released before its upload",
+       [this]() {
+         CreateMegatextures(1);
+         const int64 slot = pMegatextures->add(*pComponent);
+         if (!TestTrue("slot", slot >= 0)) {
+           return;
+         }
+
+         TestTrue("release", pMegatextures->release(slot));
+         TestEqual("reused slot", pMegatextures->add(*pComponent), slot);
+         WaitForConversions();
+
+         // The previous occupant's upload is submitted along with the new one,
+         // but only the new one marks the slot as loaded.
+         pMegatextures->submitUploads();
+         FlushRenderingCommands();
+         TestTrue("any loaded", pMegatextures->pollLoadingSlots());
+         TestTrue("slot loaded", pMegatextures->isSlotLoaded(slot));
+         TestTrue("uploads complete", pMegatextures->canBeDestroyed());
+       });
+  });
+}
@@ -0,0 +1,356 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "Misc/AutomationTest.h"
+#include "VoxelOctree.h"
+
+using namespace CesiumGeometry;
+
+BEGIN_DEFINE_SPEC(
+    FVoxelOctreeSpec,
+    "Cesium.Unit.VoxelOctree",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FVoxelOctreeSpec)
+
+namespace {
+constexpr uint32 TexelsPerNode = UVoxelOctreeTexture::TexelsPerNode;
+constexpr uint8 EmptyFlag = uint8(UVoxelOctreeTexture::ENodeFlag::Empty);
+constexpr uint8 LeafFlag = uint8(UVoxelOctreeTexture::ENodeFlag::Leaf);
+constexpr uint8 InternalFlag = uint8(UVoxelOctreeTexture::ENodeFlag::Internal);
+
+struct EncodedEntry {
+  uint8 flag;
+  uint8 levelDifference;
+  uint16 value;
+};
+
+EncodedEntry
+readEntry(const std::vector<std::byte>& data, uint32 textureIndex) {
+  const size_t offset = size_t(textureIndex) * sizeof(uint32);
+  return EncodedEntry{
+      uint8(data[offset]),
+      uint8(data[offset + 1]),
+      uint16(uint16(data[offset + 2]) | (uint16(data[offset + 3]) << 8))};
+}
+
+bool texelsMatch(
+    const std::vector<std::byte>& actual,
+    const std::vector<std::byte>& expected,
+    uint32 firstTexel,
+    uint32 texelCount) {
+  const size_t begin = size_t(firstTexel) * sizeof(uint32);
+  const size_t end = begin + size_t(texelCount) * sizeof(uint32);
+  return actual.size() >= end && expected.size() >= end &&
+         std::equal(
+             actual.begin() + begin,
+             actual.begin() + end,
+             expected.begin() + begin);
+}
+
+/**
+ * Checks that the encoding the octree has built up from its changes matches
+ * an encoding of every node from scratch. Only the texels that can be reached
+ * from the root are compared, since the texels of nodes that have lost their
+ * children are left as they were until they are reused.
+ */
+bool matchesFullEncoding(const FVoxelOctree& octree) {
+  std::vector<OctreeTileID> nodeIds;
+  std::vector<uint32> internalNodes;
+  std::vector<const FVoxelOctree::Node*> stack{
+      octree.getNode(OctreeTileID(0, 0, 0, 0))};
+  while (!stack.empty()) {
+    const FVoxelOctree::Node* pNode = stack.back();
+    stack.pop_back();
+    nodeIds.push_back(pNode->tileId);
+    if (pNode->hasChildren()) {
+      internalNodes.push_back(pNode->textureIndex);
+      for (uint32 i = 0; i < 8; ++i) {
+        stack.push_back(&octree.getChild(*pNode, i));
+      }
+    }
+  }
+
+  std::vector<std::byte> expected;
+  UVoxelOctreeTexture::encode(octree, nodeIds, expected);
+  const std::vector<std::byte>& actual = octree.getEncodedData();
+
+  if (!texelsMatch(actual, expected, 0, 1)) {
+    return false;
+  }
+  for (uint32 textureIndex : internalNodes) {
+    if (!texelsMatch(
+            actual,
+            expected,
+            textureIndex * TexelsPerNode,
+            TexelsPerNode)) {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+void FVoxelOctreeSpec::Define() {
+  Describe("UVoxelOctreeTexture::encode", [this]() {
+    It("does not render children of an empty node with ancestor data",
+       [this]() {
+         FVoxelOctree octree(16);
+         octree.createNode(OctreeTileID(2, 0, 0, 0));
+         octree.createNode(OctreeTileID(2, 2, 0, 0));
+
+         // The root has data, (1, 0, 0, 0) is empty, and (1, 1, 0, 0) has
+         // no data of its own. None of their children have data.
+         const OctreeTileID rootId(0, 0, 0, 0);
+         const OctreeTileID emptyId(1, 0, 0, 0);
+         const OctreeTileID unloadedId(1, 1, 0, 0);
+         octree.setNodeData(rootId, 1, true);
+         octree.setNodeEmpty(emptyId);
+
+         std::vector<std::byte> data;
+         UVoxelOctreeTexture::encode(
+             octree,
+             {rootId, emptyId, unloadedId},
+             data);
+
+         const FVoxelOctree::Node* pEmpty = octree.getNode(emptyId);
+         const FVoxelOctree::Node* pUnloaded = octree.getNode(unloadedId);
+         if (!TestNotNull("pEmpty", pEmpty) ||
+             !TestNotNull("pUnloaded", pUnloaded) ||
+             !TestTrue("empty has children", pEmpty->hasChildren()) ||
+             !TestTrue("unloaded has children", pUnloaded->hasChildren())) {
+           return;
+         }
+
+         for (uint32 i = 0; i < 8; ++i) {
+           const EncodedEntry entry =
+               readEntry(data, pEmpty->textureIndex * TexelsPerNode + 1 + i);
+           TestEqual("child of empty node flag", entry.flag, EmptyFlag);
+         }
+
+         // Children of a node that is merely unloaded still fall back to the
+         // root's data.
+         for (uint32 i = 0; i < 8; ++i) {
+           const EncodedEntry entry = readEntry(
+               data,
+               pUnloaded->textureIndex * TexelsPerNode + 1 + i);
+           TestEqual("child of unloaded node flag", entry.flag, LeafFlag);
+           TestEqual("child of unloaded node value", entry.value, uint16(1));
+           TestEqual(
+               "child of unloaded node level difference",
+               entry.levelDifference,
+               uint8(2));
+         }
+       });
+  });
+
+  Describe("FVoxelOctree", [this]() {
+    It("gets the index of each child among its siblings", [this]() {
+      FVoxelOctree octree(16);
+      octree.createNode(OctreeTileID(1, 1, 0, 0));
+
+      const FVoxelOctree::Node* pRoot =
+          octree.getNode(OctreeTileID(0, 0, 0, 0));
+      if (!TestNotNull("pRoot", pRoot)) {
+        return;
+      }
+
+      TestEqual("root", octree.getChildIndex(*pRoot), uint32(0));
+      for (uint32 i = 0; i < 8; ++i) {
+        const FVoxelOctree::Node& child = octree.getChild(*pRoot, i);
+        TestEqual("child index", octree.getChildIndex(child), i);
+        TestTrue("child's parent", octree.getParent(child) == pRoot);
+        TestTrue("child lookup", octree.getNode(child.tileId) == &child);
+      }
+    });
+
+    It("reuses the child blocks and texture indices of removed nodes",
+       [this]() {
+         FVoxelOctree octree(16);
+         const OctreeTileID rootId(0, 0, 0, 0);
+         const OctreeTileID firstId(1, 0, 0, 0);
+         const OctreeTileID secondId(1, 1, 0, 0);
+         const OctreeTileID leafId(2, 2, 0, 0);
+
+         TestTrue("create", octree.createNode(OctreeTileID(2, 0, 0, 0)));
+         TestFalse("create again", octree.createNode(firstId));
+
+         const FVoxelOctree::Node* pRoot = octree.getNode(rootId);
+         const FVoxelOctree::Node* pFirst = octree.getNode(firstId);
+         if (!TestNotNull("pRoot", pRoot) || !TestNotNull("pFirst", pFirst)) {
+           return;
+         }
+
+         const uint32 rootChildBlock = pRoot->firstChildIndex;
+         const uint32 firstChildBlock = pFirst->firstChildIndex;
+         TestEqual("root texture index", pRoot->textureIndex, uint32(0));
+         TestEqual("first texture index", pFirst->textureIndex, uint32(1));
+
+         // Nothing is renderable, so removing the deepest node prunes the
+         // whole tree back to the root.
+         TestTrue("remove", octree.removeNode(OctreeTileID(2, 0, 0, 0)));
+         TestFalse("cannot remove root", octree.removeNode(rootId));
+         TestNull("first removed", octree.getNode(firstId));
+         pRoot = octree.getNode(rootId);
+         if (!TestNotNull("pRoot", pRoot)) {
+           return;
+         }
+         TestFalse("root has children", pRoot->hasChildren());
+
+         // The blocks and texture index that were released are taken back
+         // rather than growing the pool.
+         TestTrue("re-create", octree.createNode(leafId));
+         pRoot = octree.getNode(rootId);
+         const FVoxelOctree::Node* pSecond = octree.getNode(secondId);
+         if (!TestNotNull("pRoot", pRoot) ||
+             !TestNotNull("pSecond", pSecond)) {
+           return;
+         }
+         TestEqual("root block", pRoot->firstChildIndex, rootChildBlock);
+         TestEqual("second block", pSecond->firstChildIndex, firstChildBlock);
+         TestEqual("second texture index", pSecond->textureIndex, uint32(1));
+
+         std::vector<OctreeTileID> allNodes{rootId};
+         for (uint32 i = 0; i < 8; ++i) {
+           allNodes.push_back(octree.getChild(*pRoot, i).tileId);
+           allNodes.push_back(octree.getChild(*pSecond, i).tileId);
+         }
+
+         std::vector<std::byte> data;
+         const std::vector<uint32> modifiedNodes =
+             UVoxelOctreeTexture::encode(octree, allNodes, data);
+         TestTrue(
+             "modified nodes",
+             modifiedNodes == std::vector<uint32>{0, 1});
+
+         const uint32 secondEntry = 1 + octree.getChildIndex(*pSecond);
+         TestEqual(
+             "second flag",
+             readEntry(data, secondEntry).flag,
+             InternalFlag);
+         TestEqual(
+             "second points to its texels",
+             readEntry(data, secondEntry).value,
+             uint16(1));
+
+         const uint32 secondTexels = pSecond->textureIndex * TexelsPerNode;
+         TestEqual(
+             "second points to its parent",
+             readEntry(data, secondTexels).value,
+             uint16(0));
+         for (uint32 i = 0; i < 8; ++i) {
+           TestEqual(
+               "unloaded child flag",
+               readEntry(data, secondTexels + 1 + i).flag,
+               EmptyFlag);
+         }
+
+         // Only the changed leaf's entry is rewritten.
+         octree.setNodeData(leafId, 3, true);
+         TestTrue(
+             "modified leaf",
+             UVoxelOctreeTexture::encode(octree, {leafId}, data) ==
+                 std::vector<uint32>{1});
+
+         const uint32 leafEntry =
+             secondTexels + 1 + octree.getChildIndex(*octree.getNode(leafId));
+         TestEqual("leaf flag", readEntry(data, leafEntry).flag, LeafFlag);
+         TestEqual("leaf value", readEntry(data, leafEntry).value, uint16(3));
+         TestEqual(
+             "leaf level difference",
+             readEntry(data, leafEntry).levelDifference,
+             uint8(0));
+       });
+  });
+
+  Describe("FVoxelOctree::encodeChangedNodes", [this]() {
+    It("matches a full encoding after each change", [this]() {
+      FVoxelOctree octree(16);
+      const OctreeTileID rootId(0, 0, 0, 0);
+
+      struct Step {
+        const TCHAR* name;
+        TFunction<void()> apply;
+      };
+      const Step steps[] = {
+          {TEXT("create a branch"),
+           [&octree]() { octree.createNode(OctreeTileID(2, 0, 0, 0)); }},
+          {TEXT("load the root"),
+           [&octree, rootId]() { octree.setNodeData(rootId, 1, false); }},
+          {TEXT("root data is ready"),
+           [&octree, rootId]() { octree.setNodeData(rootId, 1, true); }},
+          {TEXT("deepen the branch"),
+           [&octree]() { octree.createNode(OctreeTileID(3, 0, 0, 0)); }},
+          {TEXT("load a node in the branch"),
+           [&octree]() {
+             octree.setNodeData(OctreeTileID(2, 0, 0, 0), 2, true);
+           }},
+          {TEXT("add an empty branch"),
+           [&octree]() {
+             octree.createNode(OctreeTileID(2, 2, 0, 0));
+             octree.setNodeEmpty(OctreeTileID(1, 1, 0, 0));
+           }},
+          {TEXT("unload a node in the branch"),
+           [&octree]() {
+             octree.setNodeData(OctreeTileID(2, 0, 0, 0), -1, false);
+           }},
+          {TEXT("remove the branch"),
+           [&octree]() { octree.removeNode(OctreeTileID(3, 0, 0, 0)); }},
+          {TEXT("reuse the removed nodes"),
+           [&octree]() {
+             octree.createNode(OctreeTileID(3, 4, 0, 0));
+             octree.setNodeData(OctreeTileID(3, 4, 0, 0), 3, true);
+           }},
+          {TEXT("load below the empty node"),
+           [&octree]() {
+             octree.setNodeData(OctreeTileID(2, 2, 0, 0), 4, true);
+           }},
+          {TEXT("unload the root"),
+           [&octree, rootId]() { octree.setNodeData(rootId, -1, false); }},
+      };
+
+      for (const Step& step : steps) {
+        step.apply();
+        octree.encodeChangedNodes();
+        TestTrue(step.name, matchesFullEncoding(octree));
+      }
+
+      TestTrue(
+          "nothing left to encode",
+          octree.encodeChangedNodes().empty());
+    });
+  });
+
+  Describe("FVoxelEvictionQueue", [this]() {
+    It("pops nodes from lowest to highest priority", [this]() {
+      FVoxelOctree octree(16);
+      octree.createNode(OctreeTileID(1, 0, 0, 0));
+
+      const std::vector<OctreeTileID> nodeIds{
+          OctreeTileID(1, 0, 0, 0),
+          OctreeTileID(1, 1, 0, 0),
+          // Not in the octree.
+          OctreeTileID(2, 3, 3, 3),
+          OctreeTileID(1, 0, 1, 0),
+          OctreeTileID(1, 1, 1, 0)};
+      const double screenSpaceErrors[] = {5.0, 1.0, 0.0, 3.0, 0.5};
+      for (size_t i = 0; i < nodeIds.size(); ++i) {
+        FVoxelOctree::Node* pNode = octree.getNode(nodeIds[i]);
+        if (pNode) {
+          pNode->lastKnownScreenSpaceError = screenSpaceErrors[i];
+        }
+      }
+
+      // The last node is not a candidate, as if it were added this frame.
+      FVoxelEvictionQueue queue;
+      TestTrue("missing first", queue.pop(octree, nodeIds, 4) == size_t(2));
+      TestTrue("then lowest", queue.pop(octree, nodeIds, 4) == size_t(1));
+      TestTrue("then next", queue.pop(octree, nodeIds, 4) == size_t(3));
+      TestTrue("then highest", queue.pop(octree, nodeIds, 4) == size_t(0));
+      TestFalse("empty", queue.pop(octree, nodeIds, 4).has_value());
+
+      queue.reset();
+      TestTrue("after reset", queue.pop(octree, nodeIds, 5) == size_t(2));
+      TestTrue("new candidate", queue.pop(octree, nodeIds, 5) == size_t(4));
+    });
+  });
+}
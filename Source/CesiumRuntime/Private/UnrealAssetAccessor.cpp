@@ -3,6 +3,7 @@
 #include "UnrealAssetAccessor.h"
 #include "Async/Async.h"
 #include "Async/AsyncWork.h"
+#include "Async/MappedFileHandle.h"
 
 #include "CesiumAsync/AsyncSystem.h"
 #include "CesiumAsync/IAssetRequest.h"
@@ -12,6 +13,9 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 #include "CesiumCommon.h"
 #include "CesiumRuntime.h"
+#include "CesiumRuntimeSettings.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProperties.h"
 #include "HttpManager.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
@@ -20,45 +24,87 @@ THIRD_PARTY_INCLUDES_END
 #include "Misc/App.h"
 #include "Misc/EngineVersion.h"
 #include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Stats/Stats.h"
+#include "UnrealHttpHeaders.h"
+#include "UnrealTaskProcessor.h"
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <unordered_map>
+
+DECLARE_STATS_GROUP(
+    TEXT("Cesium File I/O"),
+    STATGROUP_CesiumFileIO,
+    STATCAT_Advanced);
+DECLARE_CYCLE_STAT(
+    TEXT("Read File"),
+    STAT_CesiumFileRead,
+    STATGROUP_CesiumFileIO);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Queued File Reads"),
+    STAT_CesiumQueuedFileReads,
+    STATGROUP_CesiumFileIO);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Active File Reads"),
+    STAT_CesiumActiveFileReads,
+    STATGROUP_CesiumFileIO);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Coalesced File Reads"),
+    STAT_CesiumFileReadsCoalesced,
+    STATGROUP_CesiumFileIO);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("File Bytes Read"),
+    STAT_CesiumFileBytesRead,
+    STATGROUP_CesiumFileIO);
 
 namespace {
 
-CesiumAsync::HttpHeaders parseHeaders(const TArray<FString>& unrealHeaders) {
-  CesiumAsync::HttpHeaders result;
-  for (const FString& header : unrealHeaders) {
-    int32_t separator = -1;
-    if (header.FindChar(':', separator)) {
-      FString fstrKey = header.Left(separator);
-      FString fstrValue = header.Right(header.Len() - separator - 2);
-      std::string key = std::string(TCHAR_TO_UTF8(*fstrKey));
-      std::string value = std::string(TCHAR_TO_UTF8(*fstrValue));
-      result.insert({std::move(key), std::move(value)});
-    }
+/**
+ * Header and string accessors that are converted from their Unreal form on
+ * first use and then cached. Most responses are consumed without ever
+ * looking at the headers, so there is no reason to pay for parsing them up
+ * front.
+ */
+class LazyHttpHeaders {
+public:
+  template <typename TGetHeaders>
+  const CesiumAsync::HttpHeaders& get(TGetHeaders&& getHeaders) const {
+    std::call_once(this->_parsed, [this, &getHeaders]() {
+      this->_headers = UnrealHttpHeaders::parse(getHeaders());
+    });
+    return this->_headers;
   }
 
-  return result;
-}
+private:
+  mutable std::once_flag _parsed;
+  mutable CesiumAsync::HttpHeaders _headers;
+};
 
 class UnrealAssetResponse : public CesiumAsync::IAssetResponse {
 public:
   UnrealAssetResponse(FHttpResponsePtr pResponse)
-      : _pResponse(pResponse),
-        _headers(parseHeaders(pResponse->GetAllHeaders())) {}
+      : _pResponse(pResponse), _headers(), _contentType() {}
 
   virtual uint16_t statusCode() const override {
     return static_cast<uint16_t>(this->_pResponse->GetResponseCode());
   }
 
   virtual std::string contentType() const override {
-    return TCHAR_TO_UTF8(*this->_pResponse->GetContentType());
+    std::call_once(this->_contentTypeConverted, [this]() {
+      this->_contentType =
+          UnrealHttpHeaders::toUtf8(this->_pResponse->GetContentType());
+    });
+    return this->_contentType;
   }
 
   virtual const CesiumAsync::HttpHeaders& headers() const override {
-    return this->_headers;
+    return this->_headers.get(
+        [this]() { return this->_pResponse->GetAllHeaders(); });
   }
 
   virtual std::span<const std::byte> data() const override {
@@ -70,25 +116,27 @@ public:
 
 private:
   FHttpResponsePtr _pResponse;
-  CesiumAsync::HttpHeaders _headers;
+  LazyHttpHeaders _headers;
+  mutable std::once_flag _contentTypeConverted;
+  mutable std::string _contentType;
 };
 
 class UnrealAssetRequest : public CesiumAsync::IAssetRequest {
 public:
   UnrealAssetRequest(FHttpRequestPtr pRequest, FHttpResponsePtr pResponse)
       : _pRequest(pRequest),
-        _pResponse(std::make_unique<UnrealAssetResponse>(pResponse)) {
-    this->_headers = parseHeaders(this->_pRequest->GetAllHeaders());
-    this->_url = TCHAR_TO_UTF8(*this->_pRequest->GetURL());
-    this->_method = TCHAR_TO_UTF8(*this->_pRequest->GetVerb());
-  }
+        _pResponse(std::make_unique<UnrealAssetResponse>(pResponse)),
+        _url(UnrealHttpHeaders::toUtf8(pRequest->GetURL())),
+        _method(UnrealHttpHeaders::toUtf8(pRequest->GetVerb())),
+        _headers() {}
 
   virtual const std::string& method() const { return this->_method; }
 
   virtual const std::string& url() const { return this->_url; }
 
   virtual const CesiumAsync::HttpHeaders& headers() const override {
-    return _headers;
+    return this->_headers.get(
+        [this]() { return this->_pRequest->GetAllHeaders(); });
   }
 
   virtual const CesiumAsync::IAssetResponse* response() const override {
@@ -100,13 +148,43 @@ private:
   std::unique_ptr<UnrealAssetResponse> _pResponse;
   std::string _url;
   std::string _method;
-  CesiumAsync::HttpHeaders _headers;
+  LazyHttpHeaders _headers;
 };
 
 } // namespace
 
 UnrealAssetAccessor::UnrealAssetAccessor()
-    : _userAgent(), _cesiumRequestHeaders() {
+    : UnrealAssetAccessor(
+          GetDefault<UCesiumRuntimeSettings>()->UseMemoryMappedFileReads,
+          GetDefault<UCesiumRuntimeSettings>()->MaximumSimultaneousFileReads) {
+}
+
+UnrealAssetAccessor::UnrealAssetAccessor(
+    bool useMemoryMappedFiles,
+    int32 maximumSimultaneousFileReads)
+    : _userAgent(),
+      _cesiumRequestHeaders(),
+      _pFileReadQueue(std::make_shared<FileReadQueue>(
+          maximumSimultaneousFileReads,
+          useMemoryMappedFiles &&
+              FPlatformProperties::SupportsMemoryMappedFiles(),
+          FileReader())) {
+  this->initializeRequestHeaders();
+}
+
+UnrealAssetAccessor::UnrealAssetAccessor(
+    FileReader&& fileReader,
+    int32 maximumSimultaneousFileReads)
+    : _userAgent(),
+      _cesiumRequestHeaders(),
+      _pFileReadQueue(std::make_shared<FileReadQueue>(
+          maximumSimultaneousFileReads,
+          false,
+          std::move(fileReader))) {
+  this->initializeRequestHeaders();
+}
+
+void UnrealAssetAccessor::initializeRequestHeaders() {
   FString OsVersion, OsSubVersion;
   FPlatformMisc::GetOSVersions(OsVersion, OsSubVersion);
   OsVersion += " " + FPlatformMisc::GetOSVersion();
@@ -166,6 +244,16 @@ void rejectPromiseOnUnsuccessfulConnection(
   }
 }
 
+// Requests complete on HTTP or I/O threads, which have no worker pool lane of
+// their own. Resolving the promise in the lane the request was issued in keeps
+// the worker thread continuations of the request, such as tile content
+// decoding, in that lane.
+template <typename TFunction>
+void resolveInLane(UnrealTaskProcessor::Priority priority, TFunction&& f) {
+  UnrealTaskProcessor::ScopedPriority scope(priority);
+  f();
+}
+
 } // namespace
 
 CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
@@ -183,9 +271,12 @@ UnrealAssetAccessor::get(
   const FString& userAgent = this->_userAgent;
   const TMap<FString, FString>& cesiumRequestHeaders =
       this->_cesiumRequestHeaders;
+  const UnrealTaskProcessor::Priority priority =
+      UnrealTaskProcessor::getCurrentPriority();
 
   return asyncSystem.createFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>(
-      [&url, &headers, &userAgent, &cesiumRequestHeaders](const auto& promise) {
+      [&url, &headers, &userAgent, &cesiumRequestHeaders, priority](
+          const auto& promise) {
         FHttpModule& httpModule = FHttpModule::Get();
         TSharedRef<IHttpRequest, ESPMode::ThreadSafe> pRequest =
             httpModule.CreateRequest();
@@ -204,19 +295,22 @@ UnrealAssetAccessor::get(
         pRequest->AppendToHeader(TEXT("User-Agent"), userAgent);
 
         pRequest->OnProcessRequestComplete().BindLambda(
-            [promise, CESIUM_TRACE_LAMBDA_CAPTURE_TRACK()](
+            [promise, priority, CESIUM_TRACE_LAMBDA_CAPTURE_TRACK()](
                 FHttpRequestPtr pRequest,
                 FHttpResponsePtr pResponse,
                 bool connectedSuccessfully) mutable {
               CESIUM_TRACE_USE_CAPTURED_TRACK();
               CESIUM_TRACE_END_IN_TRACK("requestAsset");
 
-              if (connectedSuccessfully) {
-                promise.resolve(
-                    std::make_unique<UnrealAssetRequest>(pRequest, pResponse));
-              } else {
-                rejectPromiseOnUnsuccessfulConnection(promise, pRequest);
-              }
+              resolveInLane(priority, [&]() {
+                if (connectedSuccessfully) {
+                  promise.resolve(std::make_unique<UnrealAssetRequest>(
+                      pRequest,
+                      pResponse));
+                } else {
+                  rejectPromiseOnUnsuccessfulConnection(promise, pRequest);
+                }
+              });
             });
 
         pRequest->ProcessRequest();
@@ -234,6 +328,8 @@ UnrealAssetAccessor::request(
   const FString& userAgent = this->_userAgent;
   const TMap<FString, FString>& cesiumRequestHeaders =
       this->_cesiumRequestHeaders;
+  const UnrealTaskProcessor::Priority priority =
+      UnrealTaskProcessor::getCurrentPriority();
 
   return asyncSystem.createFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>(
       [&verb,
@@ -241,7 +337,8 @@ UnrealAssetAccessor::request(
        &headers,
        &userAgent,
        &cesiumRequestHeaders,
-       &contentPayload](const auto& promise) {
+       &contentPayload,
+       priority](const auto& promise) {
         FHttpModule& httpModule = FHttpModule::Get();
         TSharedRef<IHttpRequest, ESPMode::ThreadSafe> pRequest =
             httpModule.CreateRequest();
@@ -265,16 +362,19 @@ UnrealAssetAccessor::request(
             contentPayload.size()));
 
         pRequest->OnProcessRequestComplete().BindLambda(
-            [promise](
+            [promise, priority](
                 FHttpRequestPtr pRequest,
                 FHttpResponsePtr pResponse,
                 bool connectedSuccessfully) {
-              if (connectedSuccessfully) {
-                promise.resolve(
-                    std::make_unique<UnrealAssetRequest>(pRequest, pResponse));
-              } else {
-                rejectPromiseOnUnsuccessfulConnection(promise, pRequest);
-              }
+              resolveInLane(priority, [&]() {
+                if (connectedSuccessfully) {
+                  promise.resolve(std::make_unique<UnrealAssetRequest>(
+                      pRequest,
+                      pResponse));
+                } else {
+                  rejectPromiseOnUnsuccessfulConnection(promise, pRequest);
+                }
+              });
             });
 
         pRequest->ProcessRequest();
@@ -295,7 +395,32 @@ public:
       std::string&& url,
       uint16_t statusCode,
       TArray64<uint8>&& data)
-      : _url(std::move(url)), _statusCode(statusCode), _data(data) {}
+      : _url(std::move(url)),
+        _statusCode(statusCode),
+        _data(std::move(data)),
+        _pMappedFile(),
+        _pMappedRegion() {}
+
+  /**
+   * Creates a successful response whose data points directly into a
+   * memory-mapped file region. The response keeps the mapping alive for as
+   * long as it exists.
+   */
+  UnrealFileAssetRequestResponse(
+      std::string&& url,
+      TUniquePtr<IMappedFileHandle>&& pMappedFile,
+      TUniquePtr<IMappedFileRegion>&& pMappedRegion)
+      : _url(std::move(url)),
+        _statusCode(200),
+        _data(),
+        _pMappedFile(std::move(pMappedFile)),
+        _pMappedRegion(std::move(pMappedRegion)) {}
+
+  virtual ~UnrealFileAssetRequestResponse() {
+    // The region must be unmapped before the file handle is closed.
+    this->_pMappedRegion.Reset();
+    this->_pMappedFile.Reset();
+  }
 
   virtual const std::string& method() const { return getMethod; }
 
@@ -314,6 +439,13 @@ public:
   virtual std::string contentType() const override { return std::string(); }
 
   virtual std::span<const std::byte> data() const override {
+    if (this->_pMappedRegion) {
+      return std::span<const std::byte>(
+          reinterpret_cast<const std::byte*>(
+              this->_pMappedRegion->GetMappedPtr()),
+          size_t(this->_pMappedRegion->GetMappedSize()));
+    }
+
     return std::span<const std::byte>(
         reinterpret_cast<const std::byte*>(this->_data.GetData()),
         size_t(this->_data.Num()));
@@ -326,6 +458,8 @@ private:
   std::string _url;
   uint16_t _statusCode;
   TArray64<uint8> _data;
+  TUniquePtr<IMappedFileHandle> _pMappedFile;
+  TUniquePtr<IMappedFileRegion> _pMappedRegion;
 };
 
 const std::string UnrealFileAssetRequestResponse::getMethod = "GET";
@@ -337,50 +471,189 @@ std::string convertFileUriToFilename(const std::string& url) {
       std::string(parsedUri.getPath()));
 }
 
-class FCesiumReadFileWorker : public FNonAbandonableTask {
-public:
-  FCesiumReadFileWorker(
-      const std::string& url,
-      const CesiumAsync::AsyncSystem& asyncSystem)
-      : _url(url),
-        _promise(
-            asyncSystem
-                .createPromise<std::shared_ptr<CesiumAsync::IAssetRequest>>()) {
+std::shared_ptr<CesiumAsync::IAssetRequest>
+tryMapFile(std::string& url, const FString& filename) {
+  IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+  TUniquePtr<IMappedFileHandle> pMappedFile(platformFile.OpenMapped(*filename));
+  if (!pMappedFile || pMappedFile->GetFileSize() <= 0) {
+    // Empty files cannot be mapped; read them the normal way.
+    return nullptr;
   }
 
-  FORCEINLINE TStatId GetStatId() const {
-    RETURN_QUICK_DECLARE_CYCLE_STAT(
-        FCesiumReadFileWorker,
-        STATGROUP_ThreadPoolAsyncTasks);
+  TUniquePtr<IMappedFileRegion> pMappedRegion(pMappedFile->MapRegion());
+  if (!pMappedRegion) {
+    return nullptr;
+  }
+
+  INC_DWORD_STAT_BY(
+      STAT_CesiumFileBytesRead,
+      uint32(pMappedRegion->GetMappedSize()));
+
+  return std::make_shared<UnrealFileAssetRequestResponse>(
+      std::move(url),
+      std::move(pMappedFile),
+      std::move(pMappedRegion));
+}
+
+std::shared_ptr<CesiumAsync::IAssetRequest>
+readFile(std::string url, bool useMemoryMappedFiles) {
+  SCOPE_CYCLE_COUNTER(STAT_CesiumFileRead);
+
+  FString filename = UTF8_TO_TCHAR(convertFileUriToFilename(url).c_str());
+
+  if (useMemoryMappedFiles) {
+    std::shared_ptr<CesiumAsync::IAssetRequest> pMapped =
+        tryMapFile(url, filename);
+    if (pMapped) {
+      return pMapped;
+    }
   }
 
-  CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> GetFuture() {
-    return this->_promise.getFuture();
+  TArray64<uint8> data;
+  if (FFileHelper::LoadFileToArray(data, *filename)) {
+    INC_DWORD_STAT_BY(STAT_CesiumFileBytesRead, uint32(data.Num()));
+    return std::make_shared<UnrealFileAssetRequestResponse>(
+        std::move(url),
+        200,
+        std::move(data));
   }
 
-  void DoWork() {
-    FString filename =
-        UTF8_TO_TCHAR(convertFileUriToFilename(this->_url).c_str());
-    TArray64<uint8> data;
-    if (FFileHelper::LoadFileToArray(data, *filename)) {
-      this->_promise.resolve(std::make_shared<UnrealFileAssetRequestResponse>(
-          std::move(this->_url),
-          200,
-          std::move(data)));
-    } else {
-      this->_promise.resolve(std::make_shared<UnrealFileAssetRequestResponse>(
-          std::move(this->_url),
-          404,
-          TArray64<uint8>()));
+  return std::make_shared<UnrealFileAssetRequestResponse>(
+      std::move(url),
+      404,
+      TArray64<uint8>());
+}
+
+} // namespace
+
+/**
+ * Schedules reads of `file:///` URLs on the engine's I/O thread pool, with at
+ * most a fixed number of reads in flight at once so that a large local
+ * tileset cannot starve the engine's own asset streaming. Simultaneous
+ * requests for the same URL share a single read.
+ */
+class UnrealAssetAccessor::FileReadQueue
+    : public std::enable_shared_from_this<FileReadQueue> {
+public:
+  FileReadQueue(
+      int32 maximumSimultaneousReads,
+      bool useMemoryMappedFiles,
+      FileReader&& fileReader)
+      : _maximumSimultaneousReads(FMath::Max(maximumSimultaneousReads, 1)),
+        _readFile(
+            fileReader ? std::move(fileReader)
+                       : [useMemoryMappedFiles](const std::string& url) {
+                           return readFile(url, useMemoryMappedFiles);
+                         }),
+        _activeReads(0),
+        _pending(),
+        _inFlight(),
+        _lock() {}
+
+  CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  read(const CesiumAsync::AsyncSystem& asyncSystem, const std::string& url) {
+    FScopeLock lock(&this->_lock);
+
+    const UnrealTaskProcessor::Priority priority =
+        UnrealTaskProcessor::getCurrentPriority();
+
+    auto it = this->_inFlight.find(url);
+    if (it != this->_inFlight.end()) {
+      INC_DWORD_STAT(STAT_CesiumFileReadsCoalesced);
+
+      // A shared read completes in the most urgent lane of its requesters.
+      it->second.priority = std::min(it->second.priority, priority);
+
+      return it->second.future.thenImmediately(
+          [](const std::shared_ptr<CesiumAsync::IAssetRequest>& pRequest) {
+            return pRequest;
+          });
     }
+
+    CesiumAsync::Promise<std::shared_ptr<CesiumAsync::IAssetRequest>> promise =
+        asyncSystem.createPromise<std::shared_ptr<CesiumAsync::IAssetRequest>>();
+    CesiumAsync::SharedFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>
+        future = promise.getFuture().share();
+
+    this->_inFlight.emplace(url, InFlightRead{future, priority});
+    this->_pending.push_back(PendingRead{url, std::move(promise)});
+    INC_DWORD_STAT(STAT_CesiumQueuedFileReads);
+
+    this->startReads();
+
+    return future.thenImmediately(
+        [](const std::shared_ptr<CesiumAsync::IAssetRequest>& pRequest) {
+          return pRequest;
+        });
+  }
+
+  int32 getQueuedCount() const {
+    FScopeLock lock(&this->_lock);
+    return int32(this->_pending.size());
   }
 
 private:
-  std::string _url;
-  CesiumAsync::Promise<std::shared_ptr<CesiumAsync::IAssetRequest>> _promise;
-};
+  struct PendingRead {
+    std::string url;
+    CesiumAsync::Promise<std::shared_ptr<CesiumAsync::IAssetRequest>> promise;
+  };
+
+  struct InFlightRead {
+    CesiumAsync::SharedFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>
+        future;
+    UnrealTaskProcessor::Priority priority;
+  };
+
+  // Must be called with _lock held.
+  void startReads() {
+    while (this->_activeReads < this->_maximumSimultaneousReads &&
+           !this->_pending.empty()) {
+      PendingRead read = std::move(this->_pending.front());
+      this->_pending.pop_front();
+      ++this->_activeReads;
+      DEC_DWORD_STAT(STAT_CesiumQueuedFileReads);
+      INC_DWORD_STAT(STAT_CesiumActiveFileReads);
+
+      AsyncPool(
+          *GIOThreadPool,
+          [pThis = this->shared_from_this(), read = std::move(read)]() {
+            pThis->completeRead(read, pThis->_readFile(read.url));
+          });
+    }
+  }
 
-} // namespace
+  void completeRead(
+      const PendingRead& read,
+      std::shared_ptr<CesiumAsync::IAssetRequest>&& pRequest) {
+    UnrealTaskProcessor::Priority priority =
+        UnrealTaskProcessor::Priority::Preload;
+    {
+      FScopeLock lock(&this->_lock);
+      auto it = this->_inFlight.find(read.url);
+      if (it != this->_inFlight.end()) {
+        priority = it->second.priority;
+        this->_inFlight.erase(it);
+      }
+      --this->_activeReads;
+      DEC_DWORD_STAT(STAT_CesiumActiveFileReads);
+      this->startReads();
+    }
+
+    // Resolve outside the lock, because continuations attached with
+    // thenImmediately may run inline and issue further reads.
+    resolveInLane(priority, [&]() {
+      read.promise.resolve(std::move(pRequest));
+    });
+  }
+
+  int32 _maximumSimultaneousReads;
+  FileReader _readFile;
+  int32 _activeReads;
+  std::deque<PendingRead> _pending;
+  std::unordered_map<std::string, InFlightRead> _inFlight;
+  mutable FCriticalSection _lock;
+};
 
 CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
 UnrealAssetAccessor::getFromFile(
@@ -388,23 +661,9 @@ UnrealAssetAccessor::getFromFile(
     const std::string& url,
     const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers) {
   check(!url.empty());
+  return this->_pFileReadQueue->read(asyncSystem, url);
+}
 
-  auto pTaskOwner =
-      std::make_unique<FAsyncTask<FCesiumReadFileWorker>>(url, asyncSystem);
-
-  FAsyncTask<FCesiumReadFileWorker>* pTask = pTaskOwner.get();
-
-  CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> future =
-      pTask->GetTask().GetFuture().thenInWorkerThread(
-          [pTaskOwner = std::move(pTaskOwner)](
-              std::shared_ptr<CesiumAsync::IAssetRequest>&& pRequest) {
-            // This lambda, via its capture, keeps the task instance alive until
-            // it is complete.
-            pTaskOwner->EnsureCompletion(false, false);
-            return pRequest;
-          });
-
-  pTask->StartBackgroundTask(GIOThreadPool);
-
-  return future;
+int32 UnrealAssetAccessor::getQueuedFileReadCount() const {
+  return this->_pFileReadQueue->getQueuedCount();
 }
@@ -0,0 +1,32 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#include "UnrealHttpHeaders.h"
+#include "Containers/StringConv.h"
+#include "Containers/StringView.h"
+
+namespace UnrealHttpHeaders {
+
+std::string toUtf8(FStringView view) {
+  FTCHARToUTF8 converted(view.GetData(), view.Len());
+  return std::string(converted.Get(), size_t(converted.Length()));
+}
+
+CesiumAsync::HttpHeaders parse(const TArray<FString>& unrealHeaders) {
+  CesiumAsync::HttpHeaders result;
+  for (const FString& header : unrealHeaders) {
+    FStringView view(header);
+
+    int32 separator = INDEX_NONE;
+    if (!view.FindChar(TEXT(':'), separator)) {
+      continue;
+    }
+
+    FStringView key = view.Left(separator);
+    FStringView value = view.Mid(separator + 1).TrimStart();
+    result.emplace(toUtf8(key), toUtf8(value));
+  }
+
+  return result;
+}
+
+} // namespace UnrealHttpHeaders
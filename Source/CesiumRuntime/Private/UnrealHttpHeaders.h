@@ -0,0 +1,28 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <CesiumAsync/HttpHeaders.h>
+THIRD_PARTY_INCLUDES_END
+
+namespace UnrealHttpHeaders {
+
+/**
+ * Parses headers in the `Key: Value` form returned by
+ * `IHttpBase::GetAllHeaders` into cesium-native's header map. Each key and
+ * value is converted to UTF-8 directly from the original string, without
+ * allocating an intermediate `FString`. If a key appears more than once, the
+ * first value is kept.
+ */
+CesiumAsync::HttpHeaders parse(const TArray<FString>& unrealHeaders);
+
+/**
+ * Converts a TCHAR string to a UTF-8 `std::string`.
+ */
+std::string toUtf8(FStringView view);
+
+} // namespace UnrealHttpHeaders
@@ -5,6 +5,7 @@
 #include "Cesium3DTilesetLifecycleEventReceiver.h"
 #include "CesiumGltfComponent.h"
 #include "CesiumLifetime.h"
+#include "CesiumMaterialInstancePool.h"
 #include "CesiumRasterOverlay.h"
 #include "CesiumRuntime.h"
 #include "CesiumVoxelRendererComponent.h"
@@ -21,6 +22,14 @@ THIRD_PARTY_INCLUDES_START
 #include <glm/mat4x4.hpp>
 THIRD_PARTY_INCLUDES_END
 
+#include <array>
+#include <atomic>
+
+namespace {
+std::array<std::atomic<uint64>, UnrealTaskProcessor::PriorityCount>
+    loadThreadPreparationCounts{};
+} // namespace
+
 UnrealPrepareRendererResources::UnrealPrepareRendererResources(
     ACesium3DTileset* pActor)
     : _pActor(pActor) {}
@@ -31,6 +40,9 @@ UnrealPrepareRendererResources::prepareInLoadThread(
     Cesium3DTilesSelection::TileLoadResult&& tileLoadResult,
     const glm::dmat4& transform,
     const std::any& rendererOptions) {
+  loadThreadPreparationCounts[size_t(UnrealTaskProcessor::getCurrentPriority())]
+      .fetch_add(1, std::memory_order_relaxed);
+
   CreateGltfOptions::CreateModelOptions options(std::move(tileLoadResult));
   if (!options.pModel) {
     return asyncSystem.createResolvedFuture(
@@ -40,6 +52,10 @@ UnrealPrepareRendererResources::prepareInLoadThread(
   }
 
   options.alwaysIncludeTangents = this->_pActor->GetAlwaysIncludeTangents();
+  options.shareVerticesForGeneratedTangents =
+      this->_pActor->GetShareVerticesForGeneratedTangents();
+  options.useCompactTextureCoordinates =
+      this->_pActor->GetUseCompactTextureCoordinates();
   options.createPhysicsMeshes = this->_pActor->GetCreatePhysicsMeshes();
 
   options.ignoreKhrMaterialsUnlit = this->_pActor->GetIgnoreKhrMaterialsUnlit();
@@ -108,11 +124,30 @@ void UnrealPrepareRendererResources::free(
   } else if (pMainThreadResult) {
     UCesiumGltfComponent* pGltf =
         reinterpret_cast<UCesiumGltfComponent*>(pMainThreadResult);
-    if (ICesium3DTilesetLifecycleEventReceiver* Receiver =
-            this->_pActor->GetLifecycleEventReceiver()) {
+    ICesium3DTilesetLifecycleEventReceiver* Receiver =
+        this->_pActor->GetLifecycleEventReceiver();
+    if (Receiver) {
       Receiver->OnTileUnloading(*pGltf);
     }
+
+    // Keep the material instances for tiles loaded later, if they came from
+    // the pool. Whether they did was recorded when the tile was loaded, since
+    // the lifecycle event receiver may have changed since then. The tile's
+    // components and meshes are destroyed either way.
+    UCesiumMaterialInstancePool* pMaterialPool =
+        pGltf->UsesMaterialInstancePool
+            ? this->_pActor->GetMaterialInstancePool()
+            : nullptr;
+    TArray<UMaterialInstanceDynamic*> materials;
+    if (pMaterialPool) {
+      materials = UCesiumMaterialInstancePool::takeMaterials(*pGltf);
+    }
+
     CesiumLifetime::destroyComponentRecursively(pGltf);
+
+    if (pMaterialPool) {
+      pMaterialPool->releaseMaterials(materials);
+    }
   }
 }
 
@@ -262,3 +297,10 @@ void UnrealPrepareRendererResources::detachRasterInMainThread(
     }
   }
 }
+
+/*static*/ uint64
+UnrealPrepareRendererResources::getLoadThreadPreparationCount(
+    UnrealTaskProcessor::Priority priority) {
+  return loadThreadPreparationCounts[size_t(priority)].load(
+      std::memory_order_relaxed);
+}
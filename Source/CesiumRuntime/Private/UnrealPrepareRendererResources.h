@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UnrealTaskProcessor.h"
 
 THIRD_PARTY_INCLUDES_START
 #include <Cesium3DTilesSelection/IPrepareRendererResources.h>
@@ -65,6 +66,13 @@ public:
       const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
       void* pMainThreadRendererResources) noexcept override;
 
+  /**
+   * Gets the number of tile contents, across all tilesets, whose load thread
+   * preparation ran in the given lane of the worker pool.
+   */
+  static uint64
+  getLoadThreadPreparationCount(UnrealTaskProcessor::Priority priority);
+
 private:
   ACesium3DTileset* _pActor;
 };
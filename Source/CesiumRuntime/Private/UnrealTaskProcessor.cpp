@@ -2,11 +2,262 @@
 
 #include "UnrealTaskProcessor.h"
 #include "Async/Async.h"
+#include "CesiumRuntimeSettings.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/QueuedThreadPool.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(
+    TEXT("Cesium Tasks"),
+    STATGROUP_CesiumTasks,
+    STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Queued Visible Tasks"),
+    STAT_CesiumQueuedVisibleTasks,
+    STATGROUP_CesiumTasks);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Queued Preload Tasks"),
+    STAT_CesiumQueuedPreloadTasks,
+    STATGROUP_CesiumTasks);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Queued Background Tasks"),
+    STAT_CesiumQueuedBackgroundTasks,
+    STATGROUP_CesiumTasks);
+
+namespace {
+
+using Priority = UnrealTaskProcessor::Priority;
+
+thread_local Priority CurrentPriority = Priority::Preload;
+
+EQueuedWorkPriority getQueuedWorkPriority(Priority priority) {
+  switch (priority) {
+  case Priority::Visible:
+    return EQueuedWorkPriority::High;
+  case Priority::Background:
+    return EQueuedWorkPriority::Low;
+  case Priority::Preload:
+  default:
+    return EQueuedWorkPriority::Normal;
+  }
+}
+
+void incrementQueuedStat(Priority priority) {
+  switch (priority) {
+  case Priority::Visible:
+    INC_DWORD_STAT(STAT_CesiumQueuedVisibleTasks);
+    break;
+  case Priority::Background:
+    INC_DWORD_STAT(STAT_CesiumQueuedBackgroundTasks);
+    break;
+  case Priority::Preload:
+  default:
+    INC_DWORD_STAT(STAT_CesiumQueuedPreloadTasks);
+    break;
+  }
+}
+
+void decrementQueuedStat(Priority priority) {
+  switch (priority) {
+  case Priority::Visible:
+    DEC_DWORD_STAT(STAT_CesiumQueuedVisibleTasks);
+    break;
+  case Priority::Background:
+    DEC_DWORD_STAT(STAT_CesiumQueuedBackgroundTasks);
+    break;
+  case Priority::Preload:
+  default:
+    DEC_DWORD_STAT(STAT_CesiumQueuedPreloadTasks);
+    break;
+  }
+}
+
+void runWithPriority(Priority priority, const std::function<void()>& f) {
+  UnrealTaskProcessor::ScopedPriority scope(priority);
+  f();
+}
+
+void startEngineTask(Priority priority, std::function<void()>&& f) {
+  AsyncTask(
+      ENamedThreads::Type::AnyBackgroundThreadNormalTask,
+      [priority, f = std::move(f)]() {
+        TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::AsyncTask)
+        runWithPriority(priority, f);
+      });
+}
+
+} // namespace
+
+class UnrealTaskProcessor::FCesiumQueuedTask : public IQueuedWork {
+public:
+  FCesiumQueuedTask(
+      std::function<void()>&& f,
+      Priority priority,
+      LaneCounters& counters)
+      : _f(std::move(f)),
+        _priority(priority),
+        _counters(counters),
+        _queuedCycles(FPlatformTime::Cycles64()) {
+    this->_counters.queued.fetch_add(1, std::memory_order_relaxed);
+    incrementQueuedStat(this->_priority);
+  }
+
+  virtual void DoThreadedWork() override {
+    this->dequeue();
+
+    {
+      TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::AsyncTask)
+      runWithPriority(this->_priority, this->_f);
+    }
+
+    delete this;
+  }
+
+  virtual void Abandon() override {
+    // Abandoned work must still run, or the cesium-native futures waiting on
+    // it would never resolve. Hand it to the engine instead.
+    this->dequeue();
+    startEngineTask(this->_priority, std::move(this->_f));
+    delete this;
+  }
+
+  virtual const TCHAR* GetDebugName() const override {
+    return TEXT("FCesiumQueuedTask");
+  }
+
+private:
+  void dequeue() {
+    const uint64 latency = FPlatformTime::Cycles64() - this->_queuedCycles;
+
+    this->_counters.queued.fetch_sub(1, std::memory_order_relaxed);
+    this->_counters.started.fetch_add(1, std::memory_order_relaxed);
+    this->_counters.totalLatencyCycles.fetch_add(
+        latency,
+        std::memory_order_relaxed);
+
+    uint64 maximum =
+        this->_counters.maximumLatencyCycles.load(std::memory_order_relaxed);
+    while (latency > maximum &&
+           !this->_counters.maximumLatencyCycles.compare_exchange_weak(
+               maximum,
+               latency,
+               std::memory_order_relaxed)) {
+    }
+
+    decrementQueuedStat(this->_priority);
+  }
+
+  std::function<void()> _f;
+  Priority _priority;
+  LaneCounters& _counters;
+  uint64 _queuedCycles;
+};
+
+UnrealTaskProcessor::ScopedPriority::ScopedPriority(Priority priority) noexcept
+    : _previous(CurrentPriority) {
+  CurrentPriority = priority;
+}
+
+UnrealTaskProcessor::ScopedPriority::~ScopedPriority() noexcept {
+  CurrentPriority = this->_previous;
+}
+
+/*static*/ UnrealTaskProcessor::Priority
+UnrealTaskProcessor::getCurrentPriority() noexcept {
+  return CurrentPriority;
+}
+
+UnrealTaskProcessor::UnrealTaskProcessor()
+    : UnrealTaskProcessor(
+          GetDefault<UCesiumRuntimeSettings>()->WorkerThreadCount) {}
+
+UnrealTaskProcessor::UnrealTaskProcessor(int32 threadCount)
+    : _pPool(nullptr), _threadCount(0), _lanes() {
+  if (!FPlatformProcess::SupportsMultithreading()) {
+    return;
+  }
+
+  if (threadCount <= 0) {
+    threadCount = FMath::Max(FPlatformMisc::NumberOfWorkerThreadsToSpawn(), 1);
+  }
+
+  // glTF, Draco and KTX2 decoding can use a lot of stack. A stack size of zero
+  // gives each thread the platform's default thread stack size, like the
+  // engine's own worker threads, rather than a small fixed one.
+  FQueuedThreadPool* pPool = FQueuedThreadPool::Allocate();
+  if (!pPool->Create(
+          uint32(threadCount),
+          0,
+          TPri_BelowNormal,
+          TEXT("CesiumWorkerPool"))) {
+    delete pPool;
+    return;
+  }
+
+  this->_threadCount = threadCount;
+  this->_pPool.store(pPool, std::memory_order_release);
+}
+
+UnrealTaskProcessor::~UnrealTaskProcessor() {
+  // The pool should already have been shut down from the module's shutdown.
+  // If it wasn't, leak it rather than attempt to join threads that may no
+  // longer exist.
+  ensure(this->_pPool.load() == nullptr);
+}
 
 void UnrealTaskProcessor::startTask(std::function<void()> f) {
-  AsyncTask(ENamedThreads::Type::AnyBackgroundThreadNormalTask, [f]() {
-    TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::AsyncTask)
-    f();
-  });
+  const Priority priority = CurrentPriority;
+
+  FQueuedThreadPool* pPool = this->_pPool.load(std::memory_order_acquire);
+  if (!pPool) {
+    startEngineTask(priority, std::move(f));
+    return;
+  }
+
+  pPool->AddQueuedWork(
+      new FCesiumQueuedTask(
+          std::move(f),
+          priority,
+          this->_lanes[size_t(priority)]),
+      getQueuedWorkPriority(priority));
+}
+
+void UnrealTaskProcessor::shutdown() {
+  // Tasks started from here on go to the engine. Queued work is abandoned by
+  // Destroy, which also forwards it to the engine.
+  FQueuedThreadPool* pPool = this->_pPool.exchange(nullptr);
+  if (!pPool) {
+    return;
+  }
+
+  this->_threadCount = 0;
+  pPool->Destroy();
+  delete pPool;
+}
+
+int32 UnrealTaskProcessor::getThreadCount() const noexcept {
+  return this->_threadCount;
+}
+
+UnrealTaskProcessor::LaneStatistics
+UnrealTaskProcessor::getStatistics(Priority priority) const noexcept {
+  const LaneCounters& counters = this->_lanes[size_t(priority)];
+
+  LaneStatistics result;
+  result.queued = counters.queued.load(std::memory_order_relaxed);
+  result.started = counters.started.load(std::memory_order_relaxed);
+
+  if (result.started > 0) {
+    result.averageLatencySeconds =
+        FPlatformTime::ToSeconds64(
+            counters.totalLatencyCycles.load(std::memory_order_relaxed)) /
+        double(result.started);
+  }
+
+  result.maximumLatencySeconds = FPlatformTime::ToSeconds64(
+      counters.maximumLatencyCycles.load(std::memory_order_relaxed));
+
+  return result;
 }
@@ -17,6 +17,7 @@
 #include "UObject/Package.h"
 
 #include <Cesium3DTiles/Class.h>
+#include <CesiumAsync/AsyncSystem.h>
 #include <CesiumGltf/PropertyType.h>
 #include <glm/gtx/component_wise.hpp>
 
@@ -29,7 +30,10 @@ FVoxelMegatextures::FVoxelMegatextures(
     ERHIFeatureLevel::Type featureLevel,
     uint32 knownTileCount)
     : _slots(),
-      _loadingSlots(),
+      _stagingBuffer(),
+      _stagingBytesPerSlot(0),
+      _uploads(),
+      _uploadBatches(),
       _pEmptySlotsHead(nullptr),
       _pOccupiedSlotsHead(nullptr),
       _slotDimensions(slotDimensions),
@@ -124,6 +128,15 @@ FVoxelMegatextures::FVoxelMegatextures(
 
   this->_pEmptySlotsHead = &this->_slots[0];
 
+  // Every tile writes each of its properties to the staging buffer.
+  for (const auto& propertyIt : this->_propertyMap) {
+    this->_stagingBytesPerSlot +=
+        size_t(texelsPerSlot) * propertyIt.Value.texelSizeBytes;
+  }
+  this->_stagingBuffer.resize(FMath::Max(
+      size_t(StagingBufferBytes),
+      this->_stagingBytesPerSlot));
+
   // Create the actual textures.
   for (auto& propertyIt : this->_propertyMap) {
     FTextureResource* pResource = FCesiumTextureResource::CreateEmpty(
@@ -172,7 +185,19 @@ FVoxelMegatextures::~FVoxelMegatextures() {
 }
 
 bool FVoxelMegatextures::canBeDestroyed() const {
-  return this->_loadingSlots.size() == 0;
+  // Worker threads may still be writing to the staging buffer, and the render
+  // thread may still be reading from it.
+  for (const Upload& upload : this->_uploads) {
+    if (!upload.conversion.isReady()) {
+      return false;
+    }
+  }
+  for (const UploadBatch& batch : this->_uploadBatches) {
+    if (!batch.fence.IsFenceComplete()) {
+      return false;
+    }
+  }
+  return true;
 }
 
 UTexture* FVoxelMegatextures::getTexture(const FString& attributeId) const {
@@ -180,98 +205,94 @@ UTexture* FVoxelMegatextures::getTexture(const FString& attributeId) const {
   return pProperty ? pProperty->pTexture : nullptr;
 }
 
-/*static*/ void FVoxelMegatextures::directCopyToTexture(
+/*static*/ void FVoxelMegatextures::stageProperty(
     const FCesiumPropertyAttributeProperty& property,
     const FVoxelMegatextures::TextureData& data,
-    const FUpdateTextureRegion3D& updateRegion) {
-  if (!data.pTexture) {
+    uint32 texelCount,
+    std::byte* pDestination) {
+  const size_t sizeBytes = size_t(texelCount) * data.texelSizeBytes;
+  if (property.getAccessorStride() == data.texelSizeBytes) {
+    FMemory::Memcpy(pDestination, property.getAccessorData(), sizeBytes);
     return;
   }
 
-  const uint8* pData =
-      reinterpret_cast<const uint8*>(property.getAccessorData());
-
-  ENQUEUE_RENDER_COMMAND(Cesium_DirectCopyVoxels)
-  ([pTexture = data.pTexture,
-    format = data.encodedFormat.format,
-    &property,
-    updateRegion,
-    texelSizeBytes = data.texelSizeBytes,
-    pData](FRHICommandListImmediate& RHICmdList) {
-    FTextureResource* pResource =
-        IsValid(pTexture) ? pTexture->GetResource() : nullptr;
-    if (!pResource)
-      return;
-
-    // Pitch = size in bytes of each row of the source image.
-    uint32 srcRowPitch = updateRegion.Width * texelSizeBytes;
-    uint32 srcDepthPitch =
-        updateRegion.Width * updateRegion.Height * texelSizeBytes;
-
-    FRHICommandListExecutor::GetImmediateCommandList().UpdateTexture3D(
-        pResource->TextureRHI,
-        0,
-        updateRegion,
-        srcRowPitch,
-        srcDepthPitch,
-        pData);
-  });
+  FMemory::Memzero(pDestination, sizeBytes);
+  for (uint32 i = 0; i < texelCount; i++) {
+    FCesiumMetadataValue rawValue =
+        UCesiumPropertyAttributePropertyBlueprintLibrary::GetRawValue(
+            property,
+            int64(i));
+
+    std::byte* pTexel = pDestination + size_t(i) * data.texelSizeBytes;
+    if (data.encodedFormat.bytesPerChannel == sizeof(float)) {
+      const float value =
+          UCesiumMetadataValueBlueprintLibrary::GetFloat(rawValue, 0.0f);
+      FMemory::Memcpy(pTexel, &value, sizeof(float));
+    } else {
+      const uint8 value =
+          UCesiumMetadataValueBlueprintLibrary::GetByte(rawValue, 0);
+      FMemory::Memcpy(pTexel, &value, sizeof(uint8));
+    }
+  }
 }
 
-/*static*/ void FVoxelMegatextures::incrementalWriteToTexture(
-    const FCesiumPropertyAttributeProperty& property,
-    const FVoxelMegatextures::TextureData& data,
-    const FUpdateTextureRegion3D& updateRegion) {
-  if (!data.pTexture)
-    return;
+std::optional<size_t> FVoxelMegatextures::findStagingOffset() const {
+  // Every tile occupies the same number of bytes, so the ring only needs to
+  // know where the oldest and newest tiles are.
+  if (this->_uploads.empty()) {
+    return findStagingOffset(
+        this->_stagingBuffer.size(),
+        this->_stagingBytesPerSlot,
+        std::nullopt,
+        0);
+  }
+  return findStagingOffset(
+      this->_stagingBuffer.size(),
+      this->_stagingBytesPerSlot,
+      this->_uploads.front().stagingOffset,
+      this->_uploads.back().stagingOffset);
+}
 
-  ENQUEUE_RENDER_COMMAND(Cesium_IncrementalWriteVoxels)
-  ([pTexture = data.pTexture,
-    format = data.encodedFormat.format,
-    &property,
-    updateRegion,
-    texelSizeBytes =
-        data.texelSizeBytes](FRHICommandListImmediate& RHICmdList) {
-    FTextureResource* pResource =
-        IsValid(pTexture) ? pTexture->GetResource() : nullptr;
-    if (!pResource)
-      return;
-
-    FUpdateTexture3DData UpdateData =
-        FRHICommandListExecutor::GetImmediateCommandList().BeginUpdateTexture3D(
-            pResource->TextureRHI,
-            0,
-            updateRegion);
-
-    for (uint32 z = 0; z < updateRegion.Depth; z++) {
-      for (uint32 y = 0; y < updateRegion.Height; y++) {
-        int64_t sourceIndex = int64_t(
-            z * updateRegion.Width * updateRegion.Height +
-            y * updateRegion.Width);
-        uint8* pDestRow = UpdateData.Data + z * UpdateData.DepthPitch +
-                          y * UpdateData.RowPitch;
-
-        for (uint32 x = 0; x < updateRegion.Width; x++) {
-          FCesiumMetadataValue rawValue =
-              UCesiumPropertyAttributePropertyBlueprintLibrary::GetRawValue(
-                  property,
-                  sourceIndex++);
-
-          float* pFloat =
-              reinterpret_cast<float*>(pDestRow + x * texelSizeBytes);
-          FMemory::Memcpy<float>(
-              *pFloat,
-              UCesiumMetadataValueBlueprintLibrary::GetFloat(rawValue, 0.0f));
-        }
-      }
+/*static*/ std::optional<size_t> FVoxelMegatextures::findStagingOffset(
+    size_t capacity,
+    size_t size,
+    std::optional<size_t> oldestOffset,
+    size_t newestOffset) {
+  if (size == 0 || size > capacity) {
+    return std::nullopt;
+  }
+
+  if (!oldestOffset) {
+    return 0;
+  }
+
+  const size_t tail = *oldestOffset;
+  const size_t head = newestOffset + size;
+  if (tail < head) {
+    // The used region doesn't wrap, so there may be space after it or before
+    // it.
+    if (capacity - head >= size) {
+      return head;
+    }
+    if (tail >= size) {
+      return 0;
     }
+    return std::nullopt;
+  }
 
-    FRHICommandListExecutor::GetImmediateCommandList().EndUpdateTexture3D(
-        UpdateData);
-  });
+  // The used region wraps around, so the only space is between its ends.
+  if (tail - head >= size) {
+    return head;
+  }
+  return std::nullopt;
 }
 
-int64 FVoxelMegatextures::add(const UCesiumGltfVoxelComponent& voxelComponent) {
+int64 FVoxelMegatextures::add(UCesiumGltfVoxelComponent& voxelComponent) {
+  const std::optional<size_t> stagingOffset = this->findStagingOffset();
+  if (!stagingOffset) {
+    return -1;
+  }
+
   int64 slotIndex = this->reserveNextSlot();
   if (slotIndex < 0) {
     return -1;
@@ -294,40 +315,157 @@ int64 FVoxelMegatextures::add(const UCesiumGltfVoxelComponent& voxelComponent) {
   updateRegion.DestY = indexY * this->_slotDimensions.y;
   updateRegion.DestX = indexX * this->_slotDimensions.x;
 
-  uint32 index = static_cast<uint32>(slotIndex);
+  Upload& upload = this->_uploads.emplace_back();
+  upload.slotIndex = slotIndex;
+  upload.slotGeneration = this->_slots[slotIndex].generation;
+  upload.region = updateRegion;
+  upload.stagingOffset = *stagingOffset;
+
+  struct PropertyToStage {
+    FCesiumPropertyAttributeProperty property;
+    TextureData data;
+    std::byte* pDestination;
+  };
+  std::vector<PropertyToStage> propertiesToStage;
+
+  const uint32 texelCount = glm::compMul(this->_slotDimensions);
+  size_t propertyOffset = *stagingOffset;
 
   for (const auto& PropertyIt : this->_propertyMap) {
+    const size_t propertyOffsetBefore = propertyOffset;
+    propertyOffset += size_t(texelCount) * PropertyIt.Value.texelSizeBytes;
+
     const FCesiumPropertyAttributeProperty& property =
         UCesiumPropertyAttributeBlueprintLibrary::FindProperty(
             voxelComponent.PropertyAttribute,
             PropertyIt.Key);
 
-    if (UCesiumPropertyAttributePropertyBlueprintLibrary::
-            GetPropertyAttributePropertyStatus(property) !=
-        ECesiumPropertyAttributePropertyStatus::Valid) {
+    if (!PropertyIt.Value.pTexture ||
+        UCesiumPropertyAttributePropertyBlueprintLibrary::
+                GetPropertyAttributePropertyStatus(property) !=
+            ECesiumPropertyAttributePropertyStatus::Valid) {
       continue;
     }
 
-    if (property.getAccessorStride() == PropertyIt.Value.texelSizeBytes) {
-      directCopyToTexture(property, PropertyIt.Value, updateRegion);
-    } else {
-      incrementalWriteToTexture(property, PropertyIt.Value, updateRegion);
-    }
+    upload.properties.push_back(
+        {PropertyIt.Value.pTexture,
+         PropertyIt.Value.texelSizeBytes,
+         propertyOffsetBefore});
+    propertiesToStage.push_back(
+        {property,
+         PropertyIt.Value,
+         this->_stagingBuffer.data() + propertyOffsetBefore});
   }
 
-  this->_slots[slotIndex].fence.emplace().BeginFence();
-  this->_loadingSlots.insert(slotIndex);
+  upload.conversion =
+      getAsyncSystem()
+          .runInWorkerThread(
+              [propertiesToStage = std::move(propertiesToStage),
+               texelCount]() {
+                TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::StageVoxels)
+                for (const PropertyToStage& toStage : propertiesToStage) {
+                  stageProperty(
+                      toStage.property,
+                      toStage.data,
+                      texelCount,
+                      toStage.pDestination);
+                }
+              })
+          .share();
+
+  // The conversion reads the tile's glTF, so the tile must not be unloaded
+  // until it finishes.
+  voxelComponent.addPendingRead(upload.conversion);
 
   return slotIndex;
 }
 
+void FVoxelMegatextures::submitUploads() {
+  struct TextureUpload {
+    UTexture* pTexture;
+    FUpdateTextureRegion3D region;
+    uint32 texelSizeBytes;
+    const uint8* pData;
+  };
+  TArray<TextureUpload> textureUploads;
+
+  size_t uploadCount = 0;
+  size_t uploadBytes = 0;
+
+  for (Upload& upload : this->_uploads) {
+    if (upload.isSubmitted) {
+      continue;
+    }
+
+    // Submit uploads in the order they were added, so that the staging buffer
+    // is released in the same order.
+    if (!upload.conversion.isReady()) {
+      break;
+    }
+    if (uploadCount > 0 && uploadBytes + this->_stagingBytesPerSlot >
+                               MaximumUploadBytesPerFrame) {
+      break;
+    }
+
+    upload.isSubmitted = true;
+    ++uploadCount;
+    uploadBytes += this->_stagingBytesPerSlot;
+
+    if (this->_slots[upload.slotIndex].generation != upload.slotGeneration) {
+      // The slot was released before its data could be uploaded.
+      continue;
+    }
+
+    for (const Upload::Property& property : upload.properties) {
+      textureUploads.Add(
+          {property.pTexture,
+           upload.region,
+           property.texelSizeBytes,
+           reinterpret_cast<const uint8*>(
+               this->_stagingBuffer.data() + property.stagingOffset)});
+    }
+  }
+
+  if (uploadCount == 0) {
+    return;
+  }
+
+  ENQUEUE_RENDER_COMMAND(Cesium_UploadVoxels)
+  ([textureUploads = MoveTemp(textureUploads)](
+       FRHICommandListImmediate& RHICmdList) {
+    for (const TextureUpload& upload : textureUploads) {
+      FTextureResource* pResource =
+          IsValid(upload.pTexture) ? upload.pTexture->GetResource() : nullptr;
+      if (!pResource)
+        continue;
+
+      // Pitch = size in bytes of each row of the source image.
+      uint32 srcRowPitch = upload.region.Width * upload.texelSizeBytes;
+      uint32 srcDepthPitch = srcRowPitch * upload.region.Height;
+
+      RHICmdList.UpdateTexture3D(
+          pResource->TextureRHI,
+          0,
+          upload.region,
+          srcRowPitch,
+          srcDepthPitch,
+          upload.pData);
+    }
+  });
+
+  UploadBatch& batch = this->_uploadBatches.emplace_back();
+  batch.uploadCount = uploadCount;
+  batch.fence.BeginFence();
+}
+
 bool FVoxelMegatextures::release(int64_t slotIndex) {
   if (slotIndex < 0 || slotIndex >= int64(this->_slots.size())) {
     return false; // Index out of bounds
   }
 
   Slot* pSlot = &this->_slots[slotIndex];
-  pSlot->fence.reset();
+  pSlot->generation++;
+  pSlot->isLoaded = false;
 
   if (pSlot->pPrevious) {
     pSlot->pPrevious->pNext = pSlot->pNext;
@@ -375,14 +513,25 @@ bool FVoxelMegatextures::isSlotLoaded(int64 index) const {
   if (index < 0 || index >= int64(this->_slots.size()))
     return false;
 
-  return this->_slots[size_t(index)].fence &&
-         this->_slots[size_t(index)].fence->IsFenceComplete();
+  return this->_slots[size_t(index)].isLoaded;
 }
 
 bool FVoxelMegatextures::pollLoadingSlots() {
-  size_t loadingSlotCount = this->_loadingSlots.size();
-  std::erase_if(this->_loadingSlots, [thiz = this](size_t i) {
-    return thiz->isSlotLoaded(i);
-  });
-  return loadingSlotCount != this->_loadingSlots.size();
+  bool anySlotLoaded = false;
+
+  while (!this->_uploadBatches.empty() &&
+         this->_uploadBatches.front().fence.IsFenceComplete()) {
+    for (size_t i = 0; i < this->_uploadBatches.front().uploadCount; i++) {
+      const Upload& upload = this->_uploads.front();
+      Slot& slot = this->_slots[upload.slotIndex];
+      if (slot.generation == upload.slotGeneration) {
+        slot.isLoaded = true;
+        anySlotLoaded = true;
+      }
+      this->_uploads.pop_front();
+    }
+    this->_uploadBatches.pop_front();
+  }
+
+  return anySlotLoaded;
 }
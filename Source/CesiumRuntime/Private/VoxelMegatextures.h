@@ -7,9 +7,13 @@
 #include "EncodedFeaturesMetadata.h"
 #include "RenderCommandFence.h"
 
+#include <CesiumAsync/SharedFuture.h>
 #include <CesiumGltf/PropertyType.h>
 #include <glm/glm.hpp>
-#include <unordered_set>
+
+#include <deque>
+#include <optional>
+#include <vector>
 
 struct FCesiumVoxelClassDescription;
 struct FCesiumPropertyAttributeProperty;
@@ -29,6 +33,14 @@ class UCesiumGltfVoxelComponent;
  *
  * This is the counterpart to Megatexture.js in CesiumJS, but this takes
  * advantage of 3D textures to simplify some of the texture read/write math.
+ *
+ * Tile data is uploaded in stages so that large tiles don't stall the render
+ * thread. When a tile is added, its data is converted to the texture formats
+ * on a worker thread, into a region of a persistent staging buffer. Once per
+ * frame, \ref submitUploads copies the converted tiles to the textures in a
+ * single render command, up to a byte budget. The staging buffer is used as a
+ * ring, so its regions are reused once the render thread has finished copying
+ * them.
  */
 class FVoxelMegatextures {
 public:
@@ -77,11 +89,19 @@ public:
   bool isFull() const { return this->_pEmptySlotsHead == nullptr; }
 
   /**
-   * @brief Attempts to add the voxel tile to the data textures.
+   * @brief Whether the staging buffer has no room for another tile. Tiles
+   * cannot be added until earlier uploads are complete.
+   */
+  bool isStagingFull() const { return !this->findStagingOffset(); }
+
+  /**
+   * @brief Attempts to add the voxel tile to the data textures. The tile's data
+   * is converted on a worker thread, and uploaded by a later call to \ref
+   * submitUploads.
    *
    * @returns The index of the reserved slot, or -1 if none were available.
    */
-  int64 add(const UCesiumGltfVoxelComponent& voxelComponent);
+  int64 add(UCesiumGltfVoxelComponent& voxelComponent);
 
   /**
    * @brief Releases the slot at the specified index, making the space available
@@ -94,9 +114,16 @@ public:
    */
   bool isSlotLoaded(int64 index) const;
 
+  /**
+   * @brief Copies the tiles whose data has finished converting to the textures,
+   * up to \ref MaximumUploadBytesPerFrame. This should be called once per
+   * frame.
+   */
+  void submitUploads();
+
   /**
    * @brief Checks the progress of slots with data being loaded into the
-   * megatexture. Retusn true if any slots completed loading.
+   * megatexture. Returns true if any slots completed loading.
    */
   bool pollLoadingSlots();
 
@@ -106,6 +133,34 @@ public:
    */
   bool canBeDestroyed() const;
 
+  /**
+   * @brief Finds where a region of the given size can be written in a ring
+   * buffer of equally-sized regions, if there is room.
+   *
+   * @param capacity The size of the ring buffer, in bytes.
+   * @param size The size of each region, in bytes.
+   * @param oldestOffset The offset of the oldest region in use, or
+   * `std::nullopt` if no regions are in use.
+   * @param newestOffset The offset of the newest region in use. Ignored if
+   * no regions are in use.
+   */
+  static std::optional<size_t> findStagingOffset(
+      size_t capacity,
+      size_t size,
+      std::optional<size_t> oldestOffset,
+      size_t newestOffset);
+
+  /**
+   * The size of the staging buffer, unless a single tile is larger.
+   */
+  static const uint32 StagingBufferBytes = 32 * 1024 * 1024;
+
+  /**
+   * The most tile data uploaded to the textures in one frame. At least one
+   * tile is uploaded per frame, even if it is larger.
+   */
+  static const uint32 MaximumUploadBytesPerFrame = 8 * 1024 * 1024;
+
 private:
   /**
    * Value constants taken from CesiumJS.
@@ -123,7 +178,16 @@ private:
     int64 index = -1;
     Slot* pNext = nullptr;
     Slot* pPrevious = nullptr;
-    std::optional<FRenderCommandFence> fence;
+    /**
+     * @brief Incremented whenever the slot is released, so that uploads for a
+     * previous occupant can be recognized and ignored.
+     */
+    uint32 generation = 0;
+    /**
+     * @brief Whether the current occupant's data has been uploaded to the
+     * textures.
+     */
+    bool isLoaded = false;
   };
 
   struct TextureData {
@@ -145,26 +209,60 @@ private:
   };
 
   /**
-   * @brief Directly copies the buffer from the given property attribute
-   * property to the texture. This is much faster than
-   * incrementalWriteToTexture, but requires the attribute data to be
-   * contiguous.
+   * @brief A tile's data in the staging buffer, waiting to be uploaded to the
+   * textures.
    */
-  static void directCopyToTexture(
-      const FCesiumPropertyAttributeProperty& property,
-      const TextureData& data,
-      const FUpdateTextureRegion3D& region);
+  struct Upload {
+    struct Property {
+      UTexture* pTexture;
+      uint32 texelSizeBytes;
+      size_t stagingOffset;
+    };
+
+    int64 slotIndex;
+    uint32 slotGeneration;
+    FUpdateTextureRegion3D region;
+    /**
+     * @brief The offset of the tile's data in the staging buffer. The data of
+     * each property follows the previous one.
+     */
+    size_t stagingOffset;
+    std::vector<Property> properties;
+    /**
+     * @brief Resolves when the tile's data has been written to the staging
+     * buffer.
+     */
+    CesiumAsync::SharedFuture<void> conversion;
+    bool isSubmitted = false;
+  };
 
   /**
-   * @brief Incrementally writes the data from the given property attribute
-   * property to the texture. Each element is converted to uint8 or float,
-   * depending on the texture format, before being written to the pixel.
-   * Necessary for some accessor types or accessors with non-continguous data.
+   * @brief Uploads that were copied to the textures in the same render
+   * command.
    */
-  static void incrementalWriteToTexture(
+  struct UploadBatch {
+    size_t uploadCount = 0;
+    FRenderCommandFence fence;
+  };
+
+  /**
+   * @brief Writes the data from the given property attribute property to the
+   * staging buffer, in the format of its texture. If the accessor data is
+   * contiguous and already in that format, it is copied directly. Otherwise,
+   * each element is converted to uint8 or float, depending on the texture
+   * format. This is much slower, so it is done on a worker thread.
+   */
+  static void stageProperty(
       const FCesiumPropertyAttributeProperty& property,
       const TextureData& data,
-      const FUpdateTextureRegion3D& region);
+      uint32 texelCount,
+      std::byte* pDestination);
+
+  /**
+   * @brief Finds where the next tile's data can be written in the staging
+   * buffer, if there is room.
+   */
+  std::optional<size_t> findStagingOffset() const;
 
   /**
    * @brief Reserves the next available empty slot.
@@ -174,7 +272,16 @@ private:
   int64 reserveNextSlot();
 
   std::vector<Slot> _slots;
-  std::unordered_set<size_t> _loadingSlots;
+
+  /**
+   * Tiles are written to the staging buffer in the order they are added, and
+   * released in the same order, so the uploads double as the record of which
+   * regions of the ring are in use.
+   */
+  std::vector<std::byte> _stagingBuffer;
+  size_t _stagingBytesPerSlot;
+  std::deque<Upload> _uploads;
+  std::deque<UploadBatch> _uploadBatches;
 
   Slot* _pEmptySlotsHead;
   Slot* _pOccupiedSlotsHead;
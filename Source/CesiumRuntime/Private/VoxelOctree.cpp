@@ -9,6 +9,10 @@
 #include <UObject/Package.h>
 #include <glm/glm.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+
 using namespace CesiumGeometry;
 using namespace Cesium3DTilesContent;
 
@@ -70,69 +74,119 @@ UVoxelOctreeTexture::create(uint32 maximumTileCount) {
   return pTexture;
 }
 
-void UVoxelOctreeTexture::update(
+/*static*/ std::vector<uint32> UVoxelOctreeTexture::encode(
     const FVoxelOctree& octree,
+    const std::vector<CesiumGeometry::OctreeTileID>& nodes,
     std::vector<std::byte>& result) {
-  result.clear();
-
-  uint32_t nodeCount = 0;
-  encodeNode(
-      octree,
-      CesiumGeometry::OctreeTileID(0, 0, 0, 0),
-      nodeCount,
-      0, /* octreeIndex */
-      0, /* textureIndex */
-      0, /* parentOctreeIndex */
-      0, /* parentTextureIndex */
-      result);
-
-  // Pad the data as necessary for the texture copy.
-  uint32 regionWidth = this->_tilesPerRow * TexelsPerNode * sizeof(uint32);
-  uint32 regionHeight = glm::ceil((float)result.size() / regionWidth);
-  uint32 expectedSize = regionWidth * regionHeight;
-
-  if (result.size() != expectedSize) {
-    result.resize(expectedSize, std::byte(0));
+  // The texture indices of the nodes whose texels were rewritten.
+  std::vector<uint32> modifiedNodes;
+
+  for (const CesiumGeometry::OctreeTileID& tileId : nodes) {
+    const FVoxelOctree::Node* pNode = octree.getNode(tileId);
+    if (!pNode) {
+      // The node was removed after it changed.
+      continue;
+    }
+
+    const FVoxelOctree::Node* pParent = octree.getParent(*pNode);
+    if (!pParent) {
+      // The root node is written to the first texel, whether it's a leaf or
+      // an internal node.
+      encodeEntry(octree, *pNode, 0, result);
+      modifiedNodes.push_back(0);
+    } else {
+      // Rewrite the node's entry in its parent.
+      encodeEntry(
+          octree,
+          *pNode,
+          pParent->textureIndex * TexelsPerNode + 1 +
+              octree.getChildIndex(*pNode),
+          result);
+      modifiedNodes.push_back(pParent->textureIndex);
+    }
+
+    if (pNode->hasChildren()) {
+      encodeInternalNode(octree, *pNode, result, modifiedNodes);
+    }
   }
 
-  // Compute the area of the texture that actually needs updating.
-  uint32 texelCount = result.size() / sizeof(uint32);
-  uint32 tileCount = texelCount / TexelsPerNode;
+  if (modifiedNodes.empty()) {
+    return modifiedNodes;
+  }
 
-  glm::uvec2 updateExtent;
-  if (tileCount <= this->_tilesPerRow) {
-    updateExtent.x = texelCount;
-    updateExtent.y = 1;
-  } else {
-    updateExtent.x = this->_tilesPerRow * TexelsPerNode;
-    updateExtent.y = texelCount / updateExtent.x;
+  std::sort(modifiedNodes.begin(), modifiedNodes.end());
+  modifiedNodes.erase(
+      std::unique(modifiedNodes.begin(), modifiedNodes.end()),
+      modifiedNodes.end());
+
+  // Make sure every texel of every modified node can be copied, even if some
+  // were never written.
+  const size_t bytesPerNode = TexelsPerNode * sizeof(uint32);
+  const size_t requiredSize = (size_t(modifiedNodes.back()) + 1) * bytesPerNode;
+  if (result.size() < requiredSize) {
+    result.resize(requiredSize, std::byte(0));
   }
-  updateExtent = glm::max(updateExtent, glm::uvec2(1, 1));
 
-  FUpdateTextureRegion2D region;
-  region.DestX = 0;
-  region.DestY = 0;
-  region.Width = updateExtent.x;
-  region.Height = updateExtent.y;
-  region.SrcX = 0;
-  region.SrcY = 0;
+  return modifiedNodes;
+}
 
-  region.Width = FMath::Clamp(region.Width, 1, this->GetResource()->GetSizeX());
-  region.Height =
-      FMath::Clamp(region.Height, 1, this->GetResource()->GetSizeY());
+void UVoxelOctreeTexture::upload(
+    const std::vector<uint32>& modifiedNodes,
+    const std::vector<std::byte>& data) {
+  if (modifiedNodes.empty()) {
+    return;
+  }
+
+  // Upload each run of consecutive modified nodes in the same row of the
+  // texture as a single region.
+  const size_t bytesPerNode = TexelsPerNode * sizeof(uint32);
+  struct RegionUpdate {
+    FUpdateTextureRegion2D region;
+    size_t byteOffset;
+  };
+  TArray<RegionUpdate> regionUpdates;
+
+  const uint32 textureHeight = this->GetResource()->GetSizeY();
+  size_t i = 0;
+  while (i < modifiedNodes.size()) {
+    const uint32 firstNode = modifiedNodes[i];
+    const uint32 row = firstNode / this->_tilesPerRow;
+    uint32 nodeCount = 1;
+    while (i + nodeCount < modifiedNodes.size() &&
+           modifiedNodes[i + nodeCount] == firstNode + nodeCount &&
+           modifiedNodes[i + nodeCount] / this->_tilesPerRow == row) {
+      ++nodeCount;
+    }
+    i += nodeCount;
 
-  // Pitch = size in bytes of each row of the source image
-  uint32 sourcePitch = region.Width * sizeof(uint32);
+    if (row >= textureHeight) {
+      // The octree has more internal nodes than the texture can hold.
+      continue;
+    }
+
+    RegionUpdate& update = regionUpdates.Emplace_GetRef();
+    update.region.DestX = (firstNode % this->_tilesPerRow) * TexelsPerNode;
+    update.region.DestY = row;
+    update.region.SrcX = 0;
+    update.region.SrcY = 0;
+    update.region.Width = nodeCount * TexelsPerNode;
+    update.region.Height = 1;
+    update.byteOffset = size_t(firstNode) * bytesPerNode;
+  }
 
   ENQUEUE_RENDER_COMMAND(Cesium_UpdateResource)
-  ([pResource = this->GetResource(), &result, region, sourcePitch](
+  ([pResource = this->GetResource(),
+    &data,
+    regionUpdates = MoveTemp(regionUpdates)](
        FRHICommandListImmediate& RHICmdList) {
-    RHICmdList.UpdateTexture2D(
-        pResource->TextureRHI,
-        0,
-        region,
-        sourcePitch,
-        reinterpret_cast<const uint8*>(result.data()));
+    for (const RegionUpdate& update : regionUpdates) {
+      RHICmdList.UpdateTexture2D(
+          pResource->TextureRHI,
+          0,
+          update.region,
+          update.region.Width * sizeof(uint32),
+          reinterpret_cast<const uint8*>(data.data() + update.byteOffset));
+    }
   });
 }
 
@@ -156,84 +210,78 @@ void UVoxelOctreeTexture::insertNodeData(
   data[dataIndex + 3] = std::byte(dataValue >> 8);
 };
 
-void UVoxelOctreeTexture::encodeNode(
+void UVoxelOctreeTexture::encodeEntry(
     const FVoxelOctree& octree,
-    const CesiumGeometry::OctreeTileID& tileId,
-    uint32& nodeCount,
-    uint32 octreeIndex,
-    uint32 textureIndex,
-    uint32 parentOctreeIndex,
-    uint32 parentTextureIndex,
+    const FVoxelOctree::Node& node,
+    uint32 entryTextureIndex,
     std::vector<std::byte>& result) {
-  const FVoxelOctree::Node* pNode = octree.getNode(tileId);
-  CESIUM_ASSERT(pNode);
-
-  if (pNode->hasChildren) {
-    // Point the parent and child octree indices at each other
-    insertNodeData(
-        result,
-        parentTextureIndex,
-        ENodeFlag::Internal,
-        octreeIndex);
+  if (node.hasChildren()) {
+    // Point the parent at the child's texels.
     insertNodeData(
         result,
-        textureIndex,
+        entryTextureIndex,
         ENodeFlag::Internal,
-        parentOctreeIndex);
-    nodeCount++;
-
-    // Continue traversing
-    parentOctreeIndex = octreeIndex;
-    parentTextureIndex = parentOctreeIndex * TexelsPerNode + 1;
+        node.textureIndex);
+    return;
+  }
 
-    uint32 childIndex = 0;
-    for (const CesiumGeometry::OctreeTileID& childId :
-         ImplicitTilingUtilities::getChildren(tileId)) {
-      octreeIndex = nodeCount;
-      textureIndex = octreeIndex * TexelsPerNode;
+  // Leaf nodes involve more complexity.
+  ENodeFlag flag = ENodeFlag::Empty;
+  uint16 value = 0;
+  uint16 levelDifference = 0;
 
-      encodeNode(
-          octree,
-          childId,
-          nodeCount,
-          octreeIndex,
-          textureIndex,
-          parentOctreeIndex,
-          parentTextureIndex + childIndex++,
-          result);
-    }
+  if (node.isEmpty) {
+    // Leave the node empty so that it's skipped.
+  } else if (node.isDataReady) {
+    flag = ENodeFlag::Leaf;
+    value = static_cast<uint16>(node.dataIndex);
   } else {
-    // Leaf nodes involve more complexity.
-    ENodeFlag flag = ENodeFlag::Empty;
-    uint16 value = 0;
-    uint16 levelDifference = 0;
-
-    if (pNode->isDataReady) {
-      flag = ENodeFlag::Leaf;
-      value = static_cast<uint16>(pNode->dataIndex);
-    } else if (pNode->pParent) {
-      FVoxelOctree::Node* pParent = pNode->pParent;
-
-      for (uint32 levelsAbove = 1; levelsAbove <= tileId.level; levelsAbove++) {
-        if (pParent->isDataReady) {
-          flag = ENodeFlag::Leaf;
-          value = static_cast<uint16>(pParent->dataIndex);
-          levelDifference = levelsAbove;
-          break;
-        }
-
-        // Continue trying to find a renderable ancestor.
-        pParent = pParent->pParent;
-
-        if (!pParent) {
-          // This happens if we've reached the root node and it's not
-          // renderable.
-          break;
-        }
+    // Try to find a renderable ancestor. If this reaches the root node and
+    // it's not renderable either, the node is empty. An empty ancestor has no
+    // voxels to offer its descendants, so the search also stops there rather
+    // than taking the data of a node above it.
+    uint32 levelsAbove = 1;
+    for (const FVoxelOctree::Node* pParent = octree.getParent(node); pParent;
+         pParent = octree.getParent(*pParent), ++levelsAbove) {
+      if (pParent->isEmpty) {
+        break;
+      }
+      if (pParent->isDataReady) {
+        flag = ENodeFlag::Leaf;
+        value = static_cast<uint16>(pParent->dataIndex);
+        levelDifference = levelsAbove;
+        break;
       }
     }
-    insertNodeData(result, parentTextureIndex, flag, value, levelDifference);
-    nodeCount++;
+  }
+  insertNodeData(result, entryTextureIndex, flag, value, levelDifference);
+}
+
+void UVoxelOctreeTexture::encodeInternalNode(
+    const FVoxelOctree& octree,
+    const FVoxelOctree::Node& node,
+    std::vector<std::byte>& result,
+    std::vector<uint32>& modifiedNodes) {
+  const uint32 textureIndex = node.textureIndex * TexelsPerNode;
+  const FVoxelOctree::Node* pParent = octree.getParent(node);
+
+  // Point the child at its parent's texels.
+  insertNodeData(
+      result,
+      textureIndex,
+      ENodeFlag::Internal,
+      pParent ? pParent->textureIndex : 0);
+  modifiedNodes.push_back(node.textureIndex);
+
+  for (uint32 childIndex = 0; childIndex < 8; ++childIndex) {
+    const FVoxelOctree::Node& child = octree.getChild(node, childIndex);
+    encodeEntry(octree, child, textureIndex + 1 + childIndex, result);
+
+    // Leaves below a child that has its own data or is empty never fall back
+    // to this node's data or its ancestors', so they are unaffected.
+    if (child.hasChildren() && !child.isDataReady && !child.isEmpty) {
+      encodeInternalNode(octree, child, result, modifiedNodes);
+    }
   }
 }
 
@@ -251,9 +299,24 @@ size_t FVoxelOctree::OctreeTileIDHash::operator()(
 }
 
 FVoxelOctree::FVoxelOctree(uint32 maximumTileCount)
-    : _nodes(), _pTexture(nullptr), _fence(std::nullopt), _data() {
-  CesiumGeometry::OctreeTileID rootTileID(0, 0, 0, 0);
-  this->_nodes.insert({rootTileID, Node()});
+    : _nodes(),
+      _freeChildBlocks(),
+      _nodeIndices(),
+      _pTexture(nullptr),
+      _fence(std::nullopt),
+      _data(),
+      _dirtyNodes(),
+      _freeTextureIndices(),
+      // The root node always occupies the first texels.
+      _textureIndexCount(1) {
+  // Each loaded tile may bring in up to seven siblings and the chain of
+  // ancestors above it, so this is only a starting point.
+  this->_nodes.reserve(size_t(maximumTileCount) * 8 + 1);
+  this->_nodeIndices.reserve(size_t(maximumTileCount) * 8 + 1);
+
+  Node& root = this->_nodes.emplace_back();
+  this->_nodeIndices.emplace(root.tileId, 0);
+  this->markDirty(root);
   this->_pTexture = UVoxelOctreeTexture::create(maximumTileCount);
 }
 
@@ -263,63 +326,74 @@ FVoxelOctree::~FVoxelOctree() {
 
 const FVoxelOctree::Node*
 FVoxelOctree::getNode(const CesiumGeometry::OctreeTileID& TileID) const {
-  return this->_nodes.contains(TileID) ? &this->_nodes.at(TileID) : nullptr;
+  auto it = this->_nodeIndices.find(TileID);
+  return it != this->_nodeIndices.end() ? &this->_nodes[it->second] : nullptr;
 }
 
 FVoxelOctree::Node*
 FVoxelOctree::getNode(const CesiumGeometry::OctreeTileID& TileID) {
-  return this->_nodes.contains(TileID) ? &this->_nodes.at(TileID) : nullptr;
+  auto it = this->_nodeIndices.find(TileID);
+  return it != this->_nodeIndices.end() ? &this->_nodes[it->second] : nullptr;
 }
 
 bool FVoxelOctree::createNode(const CesiumGeometry::OctreeTileID& TileID) {
-  FVoxelOctree::Node* pNode = this->getNode(TileID);
-  if (pNode) {
+  if (this->_nodeIndices.contains(TileID)) {
     return false;
   }
 
-  // Create the target node first.
-  this->_nodes.insert({TileID, Node()});
-  pNode = &this->_nodes[TileID];
-
-  // Starting from the target node, traverse the tree upwards and create the
-  // missing ancestors. Stop when we've found an existing parent node.
-  OctreeTileID currentTileID = TileID;
-  bool foundExistingParent = false;
+  // Starting from the target node, traverse the tree upwards until an existing
+  // ancestor is found. The root always exists, so this terminates.
+  std::vector<OctreeTileID> missingTileIDs{TileID};
+  OctreeTileID parentTileID = *ImplicitTilingUtilities::getParentID(TileID);
+  auto parentIt = this->_nodeIndices.find(parentTileID);
+  while (parentIt == this->_nodeIndices.end()) {
+    missingTileIDs.push_back(parentTileID);
+    parentTileID = *ImplicitTilingUtilities::getParentID(parentTileID);
+    parentIt = this->_nodeIndices.find(parentTileID);
+  }
 
-  for (uint32_t level = TileID.level; level > 0; level--) {
-    OctreeTileID parentTileID =
-        *ImplicitTilingUtilities::getParentID(currentTileID);
-    if (this->_nodes.contains(parentTileID)) {
-      foundExistingParent = true;
-    } else {
-      this->_nodes.insert({parentTileID, Node()});
-    }
+  // The existing ancestor *shouldn't* have children at this point. Otherwise,
+  // the missing node below it would have already been found. Create the
+  // children of each node on the way back down.
+  uint32 parentIndex = parentIt->second;
+  for (auto it = missingTileIDs.rbegin(); it != missingTileIDs.rend(); ++it) {
+    this->createChildren(parentIndex);
+    parentIndex = this->_nodeIndices.at(*it);
+  }
 
-    FVoxelOctree::Node* pParent = &this->_nodes[parentTileID];
-    pNode->pParent = pParent;
+  return true;
+}
 
-    // The parent *shouldn't* have children at this point. Otherwise, our
-    // target node would have already been found.
-    for (const CesiumGeometry::OctreeTileID& child :
-         ImplicitTilingUtilities::getChildren(parentTileID)) {
-      if (!this->_nodes.contains(child)) {
-        this->_nodes.insert({child, Node()});
-        this->_nodes[child].pParent = pParent;
-      }
-    }
+void FVoxelOctree::createChildren(uint32 nodeIndex) {
+  CESIUM_ASSERT(!this->_nodes[nodeIndex].hasChildren());
 
-    pParent->hasChildren = true;
-    if (foundExistingParent) {
-      // The parent already existed in the tree previously, no need to create
-      // its ancestors.
-      break;
-    }
+  uint32 firstChildIndex;
+  if (this->_freeChildBlocks.empty()) {
+    firstChildIndex = static_cast<uint32>(this->_nodes.size());
+    this->_nodes.resize(this->_nodes.size() + 8);
+  } else {
+    firstChildIndex = this->_freeChildBlocks.back();
+    this->_freeChildBlocks.pop_back();
+  }
 
-    currentTileID = parentTileID;
-    pNode = pParent;
+  // Resizing the pool may have moved the nodes, so only take references now.
+  Node& node = this->_nodes[nodeIndex];
+  uint32 childIndex = firstChildIndex;
+  for (const CesiumGeometry::OctreeTileID& childId :
+       ImplicitTilingUtilities::getChildren(node.tileId)) {
+    Node& child = this->_nodes[childIndex];
+    child = Node();
+    child.tileId = childId;
+    child.parentIndex = nodeIndex;
+    this->_nodeIndices.emplace(childId, childIndex++);
+    this->markDirty(child);
   }
 
-  return true;
+  node.firstChildIndex = firstChildIndex;
+  if (node.parentIndex != InvalidIndex) {
+    node.textureIndex = this->allocateTextureIndex();
+  }
+  this->markDirty(node);
 }
 
 bool FVoxelOctree::removeNode(const CesiumGeometry::OctreeTileID& tileId) {
@@ -327,47 +401,119 @@ bool FVoxelOctree::removeNode(const CesiumGeometry::OctreeTileID& tileId) {
     return false;
   }
 
+  const Node* pNode = this->getNode(tileId);
+  if (!pNode) {
+    return false;
+  }
+
   // Check the sibling nodes. If they are either leaves or have renderable
   // children, return true.
-  bool hasRenderableSiblings = false;
-
+  //
   // There may be cases where the children rely on the parent for rendering.
   // If so, the node's data cannot be easily released.
-  OctreeTileID parentTileId = *ImplicitTilingUtilities::getParentID(tileId);
-  OctreeChildren siblings = ImplicitTilingUtilities::getChildren(parentTileId);
-  for (const OctreeTileID& siblingId : siblings) {
-    if (siblingId == tileId)
-      continue;
-
-    if (isNodeRenderable(siblingId)) {
-      hasRenderableSiblings = true;
-      break;
+  const uint32 parentIndex = pNode->parentIndex;
+  Node& parent = this->_nodes[parentIndex];
+  for (uint32 i = 0; i < 8; ++i) {
+    const Node& sibling = this->_nodes[parent.firstChildIndex + i];
+    if (&sibling != pNode && isNodeRenderable(sibling)) {
+      // Don't remove this node yet. It will have to rely on its parent for
+      // rendering.
+      return false;
     }
   }
 
-  if (hasRenderableSiblings) {
-    // Don't remove this node yet. It will have to rely on its parent for
-    // rendering.
-    return false;
+  // Otherwise, okay to remove the nodes.
+  for (uint32 i = 0; i < 8; ++i) {
+    this->_nodeIndices.erase(this->_nodes[parent.firstChildIndex + i].tileId);
   }
+  this->_freeChildBlocks.push_back(parent.firstChildIndex);
 
-  // Otherwise, okay to remove the nodes.
-  for (const OctreeTileID& siblingId : siblings) {
-    this->_nodes.erase(this->_nodes.find(siblingId));
+  // The parent is now a leaf, so its texels can be given to another node.
+  parent.firstChildIndex = InvalidIndex;
+  if (parent.parentIndex != InvalidIndex) {
+    this->_freeTextureIndices.push_back(parent.textureIndex);
   }
-  this->getNode(parentTileId)->hasChildren = false;
+  this->markDirty(parent);
 
   // Continue to recursively remove parent nodes as long as they aren't
   // renderable either.
+  const CesiumGeometry::OctreeTileID parentTileId = parent.tileId;
   removeNode(parentTileId);
 
   return true;
 }
 
+bool FVoxelOctree::setNodeData(
+    const CesiumGeometry::OctreeTileID& TileID,
+    int64_t dataIndex,
+    bool isDataReady) {
+  FVoxelOctree::Node* pNode = this->getNode(TileID);
+  if (!pNode ||
+      (pNode->dataIndex == dataIndex && pNode->isDataReady == isDataReady)) {
+    return false;
+  }
+
+  pNode->dataIndex = dataIndex;
+  pNode->isDataReady = isDataReady;
+  this->markDirty(*pNode);
+  return true;
+}
+
+bool FVoxelOctree::setNodeEmpty(const CesiumGeometry::OctreeTileID& TileID) {
+  FVoxelOctree::Node* pNode = this->getNode(TileID);
+  if (!pNode || pNode->isEmpty) {
+    return false;
+  }
+
+  pNode->isEmpty = true;
+  this->markDirty(*pNode);
+  return true;
+}
+
+void FVoxelOctree::markDirty(Node& node) {
+  if (!node.isDirty) {
+    node.isDirty = true;
+    this->_dirtyNodes.push_back(node.tileId);
+  }
+}
+
+uint32 FVoxelOctree::allocateTextureIndex() {
+  if (this->_freeTextureIndices.empty()) {
+    return this->_textureIndexCount++;
+  }
+
+  uint32 textureIndex = this->_freeTextureIndices.back();
+  this->_freeTextureIndices.pop_back();
+  return textureIndex;
+}
+
 bool FVoxelOctree::isNodeRenderable(
     const CesiumGeometry::OctreeTileID& tileId) const {
   const FVoxelOctree::Node* pNode = this->getNode(tileId);
-  return pNode && (pNode->dataIndex > 0 || pNode->hasChildren);
+  return pNode && isNodeRenderable(*pNode);
+}
+
+/*static*/ bool FVoxelOctree::isNodeRenderable(const Node& node) {
+  return node.dataIndex > 0 || node.hasChildren();
+}
+
+std::vector<uint32> FVoxelOctree::encodeChangedNodes() {
+  if (this->_dirtyNodes.empty()) {
+    return {};
+  }
+
+  std::vector<uint32> modifiedNodes =
+      UVoxelOctreeTexture::encode(*this, this->_dirtyNodes, this->_data);
+
+  for (const CesiumGeometry::OctreeTileID& tileId : this->_dirtyNodes) {
+    FVoxelOctree::Node* pNode = this->getNode(tileId);
+    if (pNode) {
+      pNode->isDirty = false;
+    }
+  }
+  this->_dirtyNodes.clear();
+
+  return modifiedNodes;
 }
 
 bool FVoxelOctree::updateTexture() {
@@ -376,7 +522,12 @@ bool FVoxelOctree::updateTexture() {
   }
 
   this->_fence.reset();
-  this->_pTexture->update(*this, this->_data);
+  const std::vector<uint32> modifiedNodes = this->encodeChangedNodes();
+  if (modifiedNodes.empty()) {
+    return true;
+  }
+
+  this->_pTexture->upload(modifiedNodes, this->_data);
 
   // Prevent changes to the data while the texture is updating on the render
   // thread.
@@ -384,6 +535,47 @@ bool FVoxelOctree::updateTexture() {
   return true;
 }
 
+UTexture2D* FVoxelOctree::getTexture() const { return this->_pTexture; }
+
 bool FVoxelOctree::canBeDestroyed() const {
   return this->_fence ? this->_fence->IsFenceComplete() : true;
 }
+
+void FVoxelEvictionQueue::reset() {
+  this->_heap.clear();
+  this->_isBuilt = false;
+}
+
+std::optional<size_t> FVoxelEvictionQueue::pop(
+    const FVoxelOctree& octree,
+    const std::vector<CesiumGeometry::OctreeTileID>& nodeIds,
+    size_t candidateCount) {
+  if (!this->_isBuilt) {
+    this->_heap.reserve(candidateCount);
+    for (size_t i = 0; i < candidateCount; ++i) {
+      const FVoxelOctree::Node* pNode = octree.getNode(nodeIds[i]);
+      // Nodes missing from the tree are evicted first.
+      this->_heap.push_back(
+          {pNode ? pNode->lastKnownScreenSpaceError
+                 : -std::numeric_limits<double>::infinity(),
+           i});
+    }
+    std::make_heap(
+        this->_heap.begin(),
+        this->_heap.end(),
+        std::greater<Candidate>());
+    this->_isBuilt = true;
+  }
+
+  if (this->_heap.empty()) {
+    return std::nullopt;
+  }
+
+  std::pop_heap(
+      this->_heap.begin(),
+      this->_heap.end(),
+      std::greater<Candidate>());
+  const size_t nodeIndex = this->_heap.back().nodeIndex;
+  this->_heap.pop_back();
+  return nodeIndex;
+}
@@ -11,7 +11,324 @@
 #include <unordered_map>
 #include <vector>
 
-class FVoxelOctree;
+class UVoxelOctreeTexture;
+
+/**
+ * @brief A representation of an implicit octree tileset containing voxels.
+ *
+ * This is relevant to the raycasted approach for rendering voxels and
+ * is meant to be paired with \ref FVoxelDataTextures. The structure of
+ * the voxel tileset is communicated to the shader through a texture.
+ * Tiles with renderable data are linked to slots in \ref FVoxelDataTextures.
+ *
+ * The connection with \ref FVoxelDataTextures is managed externally by
+ * \UCesiumVoxelRendererComponent.
+ */
+class FVoxelOctree {
+public:
+  /**
+   * @brief Indicates that a node has no parent or no children.
+   */
+  static constexpr uint32 InvalidIndex = TNumericLimits<uint32>::Max();
+
+  /**
+   * @brief A tile in an implicitly tiled octree.
+   */
+  struct Node {
+    /**
+     * @brief The ID of the tile.
+     */
+    CesiumGeometry::OctreeTileID tileId{0, 0, 0, 0};
+    /**
+     * @brief The index of the node's parent in the octree's node pool, or
+     * \ref InvalidIndex if this is the root.
+     */
+    uint32 parentIndex = InvalidIndex;
+    /**
+     * @brief The index of the first of the node's eight children in the
+     * octree's node pool, or \ref InvalidIndex if the node has no children.
+     * The children are stored contiguously, in the order given by
+     * `ImplicitTilingUtilities::getChildren`.
+     */
+    uint32 firstChildIndex = InvalidIndex;
+    /**
+     * @brief The tile's last known screen space error.
+     */
+    double lastKnownScreenSpaceError = 0.0;
+    /**
+     * @brief The index of the slot that this tile occupies in \ref
+     * FVoxelDataTextures, if any.
+     */
+    int64_t dataIndex = -1;
+    /**
+     * @brief Whether this tile's data is actually loaded into \ref
+     * FVoxelDataTextures. Although the node may have an assigned slot index,
+     * the data must be uploaded to the texture during the render thread, and
+     * thus won't be immediately available to render.
+     */
+    bool isDataReady = false;
+    /**
+     * @brief Whether the tile is known to have no voxels to render. Unlike
+     * tiles whose data isn't loaded, empty tiles aren't rendered with the data
+     * of an ancestor, so the ray march can skip them entirely.
+     */
+    bool isEmpty = false;
+    /**
+     * @brief The index of the node's texels in the octree texture, if it has
+     * children. The root node always has index 0.
+     */
+    uint32 textureIndex = 0;
+    /**
+     * @brief Whether the node has changed since the octree texture was last
+     * updated.
+     */
+    bool isDirty = false;
+
+    /**
+     * @brief Whether the tile's children exist in the octree.
+     */
+    bool hasChildren() const { return this->firstChildIndex != InvalidIndex; }
+  };
+
+  /**
+   * @brief Constructs an initially empty octree with the specified tile
+   * capacity.
+   */
+  FVoxelOctree(uint32 maximumTileCount);
+
+  ~FVoxelOctree();
+
+  /**
+   * @brief Gets a node in the octree at the specified tile ID. Returns nullptr
+   * if it does not exist.
+   *
+   * The returned pointer is invalidated when nodes are created.
+   *
+   * @param TileID The octree tile ID.
+   */
+  const Node* getNode(const CesiumGeometry::OctreeTileID& TileID) const;
+
+  /**
+   * @copydoc getNode
+   */
+  Node* getNode(const CesiumGeometry::OctreeTileID& TileID);
+
+  /**
+   * @brief Gets the parent of a node, or nullptr if the node is the root.
+   */
+  const Node* getParent(const Node& node) const {
+    return node.parentIndex != InvalidIndex ? &this->_nodes[node.parentIndex]
+                                            : nullptr;
+  }
+
+  /**
+   * @brief Gets one of the eight children of a node that has children.
+   *
+   * @param node The parent node.
+   * @param childIndex The index of the child, in the order given by
+   * `ImplicitTilingUtilities::getChildren`.
+   */
+  const Node& getChild(const Node& node, uint32 childIndex) const {
+    return this->_nodes[node.firstChildIndex + childIndex];
+  }
+
+  /**
+   * @brief Gets the index of a node among its siblings, in the order given by
+   * `ImplicitTilingUtilities::getChildren`. The root has index 0.
+   */
+  uint32 getChildIndex(const Node& node) const {
+    const Node* pParent = this->getParent(node);
+    return pParent ? this->getIndex(node) - pParent->firstChildIndex : 0;
+  }
+
+  /**
+   * @brief Creates a node in the octree at the specified tile ID, including the
+   * parent nodes needed to traverse to it.
+   *
+   * If the node already exists, this returns false.
+   *
+   * @param TileID The octree tile ID.
+   * @param Whether the node was successfully added.
+   */
+  bool createNode(const CesiumGeometry::OctreeTileID& TileID);
+
+  /**
+   * @brief Attempts to remove the node at the specified tile ID.
+   *
+   * This will fail to remove the node from the tree if:
+   *
+   * - the node is the root of the tree
+   * - the node has renderable siblings
+   *
+   * @param TileID The octree tile ID.
+   * @return Whether the node was successfully removed.
+   */
+  bool removeNode(const CesiumGeometry::OctreeTileID& TileID);
+
+  /**
+   * @brief Sets the data slot of the node at the specified tile ID, and
+   * whether that data is ready to render.
+   *
+   * @param TileID The octree tile ID.
+   * @param dataIndex The index of the node's slot in \ref FVoxelDataTextures,
+   * or -1 if it has none.
+   * @param isDataReady Whether the data in the slot is ready to render.
+   * @return Whether the node changed as a result.
+   */
+  bool setNodeData(
+      const CesiumGeometry::OctreeTileID& TileID,
+      int64_t dataIndex,
+      bool isDataReady);
+
+  /**
+   * @brief Marks the node at the specified tile ID as empty, meaning it has no
+   * voxels to render.
+   *
+   * @param TileID The octree tile ID.
+   * @return Whether the node changed as a result.
+   */
+  bool setNodeEmpty(const CesiumGeometry::OctreeTileID& TileID);
+
+  /**
+   * @brief Retrieves the texture containing the encoded octree.
+   */
+  UTexture2D* getTexture() const;
+
+  /**
+   * @brief Re-encodes the nodes that have changed since they were last
+   * encoded, without uploading them to the texture.
+   *
+   * This must not be called while a texture update is in progress.
+   * \ref updateTexture calls it once the previous update has completed.
+   *
+   * @return The texture indices of the nodes whose texels were rewritten,
+   * sorted and without duplicates.
+   */
+  std::vector<uint32> encodeChangedNodes();
+
+  /**
+   * @brief Gets the encoding of the whole octree, as of the last call to
+   * \ref encodeChangedNodes.
+   */
+  const std::vector<std::byte>& getEncodedData() const { return this->_data; }
+
+  bool updateTexture();
+
+  bool canBeDestroyed() const;
+
+private:
+  bool isNodeRenderable(const CesiumGeometry::OctreeTileID& tileId) const;
+  static bool isNodeRenderable(const Node& node);
+
+  uint32 getIndex(const Node& node) const {
+    return static_cast<uint32>(&node - this->_nodes.data());
+  }
+
+  /**
+   * @brief Creates the eight children of a node that has none.
+   */
+  void createChildren(uint32 nodeIndex);
+
+  /**
+   * @brief Records that a node must be re-encoded in the texture.
+   */
+  void markDirty(Node& node);
+
+  /**
+   * @brief Gives a node that has gained children its own texels in the
+   * texture, reusing those of a node that has lost its children if possible.
+   */
+  uint32 allocateTextureIndex();
+
+  struct OctreeTileIDHash {
+    size_t operator()(const CesiumGeometry::OctreeTileID& tileId) const;
+  };
+
+  /**
+   * Nodes must track their parent / child relationships so that the tree
+   * structure can be encoded to a texture, for voxel raymarching. However,
+   * nodes must also be easily created and/or accessed. cesium-native passes
+   * tiles over in a vector without spatial organization, so walking down the
+   * tree to find each tile would be wasteful.
+   *
+   * The compromise: nodes are stored in a contiguous pool, with the root first
+   * and the children of each node together in a block of eight, and a hashmap
+   * from tile ID to pool index provides direct access. This is inspired by
+   * Linear (hashed) Octrees:
+   * https://geidav.wordpress.com/2014/08/18/advanced-octrees-2-node-representations/
+   *
+   * Blocks released when nodes lose their children are reused before the pool
+   * grows, so the pool stays as large as the largest tree seen so far.
+   */
+  std::vector<Node> _nodes;
+  std::vector<uint32> _freeChildBlocks;
+
+  using NodeIndexMap = std::
+      unordered_map<CesiumGeometry::OctreeTileID, uint32, OctreeTileIDHash>;
+  NodeIndexMap _nodeIndices;
+
+  UVoxelOctreeTexture* _pTexture;
+  uint32_t _tilesPerRow;
+  std::optional<FRenderCommandFence> _fence;
+
+  // The encoding of the whole octree. Only the nodes that change are
+  // rewritten, so this persists between updates.
+  std::vector<std::byte> _data;
+
+  std::vector<CesiumGeometry::OctreeTileID> _dirtyNodes;
+  std::vector<uint32> _freeTextureIndices;
+  uint32 _textureIndexCount;
+};
+
+/**
+ * @brief Chooses the nodes of a \ref FVoxelOctree to evict, from lowest to
+ * highest priority, where a node's priority is its last known screen space
+ * error.
+ *
+ * Usually only a few nodes are evicted per frame, so rather than sorting every
+ * candidate, they are put in a min-heap when the first eviction is needed and
+ * popped one at a time.
+ */
+class FVoxelEvictionQueue {
+public:
+  /**
+   * @brief Forgets the candidates of the previous frame. The heap is built
+   * again by the next call to \ref pop.
+   */
+  void reset();
+
+  /**
+   * @brief Removes the lowest priority candidate, returning its index in
+   * `nodeIds`, or std::nullopt if every candidate has already been popped
+   * since the last reset.
+   *
+   * @param octree The octree containing the nodes. Nodes missing from it have
+   * the lowest priority.
+   * @param nodeIds The IDs of the nodes that may be evicted.
+   * @param candidateCount The number of nodes at the start of `nodeIds` that
+   * may be evicted. This must not change between resets.
+   */
+  std::optional<size_t> pop(
+      const FVoxelOctree& octree,
+      const std::vector<CesiumGeometry::OctreeTileID>& nodeIds,
+      size_t candidateCount);
+
+private:
+  struct Candidate {
+    double sse;
+    size_t nodeIndex;
+
+    /**
+     * Orders a heap so that the lowest priority node is at the front.
+     */
+    bool operator>(const Candidate& other) const {
+      return this->sse > other.sse;
+    }
+  };
+
+  std::vector<Candidate> _heap;
+  bool _isBuilt = false;
+};
 
 /**
  * A texture that encodes information from \ref FVoxelOctree.
@@ -24,18 +341,44 @@ public:
   static UVoxelOctreeTexture* create(uint32 maximumTileCount);
 
   /**
-   * @brief Updates the texture, encoding the structure of the given octree as
-   * in the result vector and prompting an update during the render thread.
+   * @brief Prompts an update of the texels of the given nodes during the render
+   * thread, copying them from the encoded octree.
    *
    * Storing non-trivial types on `UVoxelOctreeTexture` often results in
    * memory corruption when the texture is created. Thus, this requires the
-   * vector to be externally supplied and managed. It is recommended to use a
-   * FRenderCommandFence to query when the texture update completes, as to avoid
-   * destroying the vector mid-update.
+   * encoded octree to be externally supplied and managed. It must not change
+   * until the update completes, so it is recommended to use a
+   * FRenderCommandFence to query when that happens.
+   *
+   * @param modifiedNodes The texture indices of the nodes to upload, sorted
+   * and without duplicates, as returned by \ref encode.
+   * @param data The encoded octree.
    */
-  void update(const FVoxelOctree& octree, std::vector<std::byte>& result);
+  void upload(
+      const std::vector<uint32>& modifiedNodes,
+      const std::vector<std::byte>& data);
+
+  /**
+   * @brief Re-encodes the given nodes of the octree into the result vector,
+   * without touching the texture.
+   *
+   * Each node's entry is written within its parent's texels, or to the first
+   * texel if it is the root. Nodes with children also have their own texels
+   * rewritten. Encoding every node of the octree into an empty vector produces
+   * the full encoding.
+   *
+   * @param octree The voxel octree.
+   * @param nodes The IDs of the nodes to encode. Nodes that don't exist are
+   * ignored.
+   * @param result The encoded octree.
+   * @return The texture indices of the nodes whose texels were written,
+   * sorted and without duplicates.
+   */
+  static std::vector<uint32> encode(
+      const FVoxelOctree& octree,
+      const std::vector<CesiumGeometry::OctreeTileID>& nodes,
+      std::vector<std::byte>& result);
 
-private:
   /**
    * @brief The number of texels used to represent a node in the texture.
    *
@@ -88,11 +431,13 @@ private:
     Internal = 2,
   };
 
+private:
+
   /**
    * @brief Inserts the input values to the given data vector, automatically
    * expanding it if the target index is out-of-bounds.
    */
-  void insertNodeData(
+  static void insertNodeData(
       std::vector<std::byte>& data,
       uint32 textureIndex,
       ENodeFlag nodeFlag,
@@ -100,8 +445,8 @@ private:
       uint8 renderableLevelDifference = 0);
 
   /**
-   * @brief Recursively writes octree nodes as their expected representation
-   * in the GPU texture.
+   * @brief Writes the entry for a node within its parent's representation in
+   * the GPU texture.
    *
    * Example Below (shown as binary tree instead of octree for
    * demonstration purposes)
@@ -124,169 +469,44 @@ private:
    * node index:   0_______  1________  2________  3_________
    * data array:  [*0, 1, 3, *0, L0, 2, *1 L1, L2, *0, L3, L4]
    *
-   * The array is generated from a depth-first traversal. The end result could
-   * be an unbalanced tree, so the parent index is stored at each node to make
-   * it possible to traverse upwards.
-   *
-   * Nodes are indexed by the order in which they appear in the traversal.
+   * Each internal node occupies the texels at its
+   * \ref FVoxelOctree::Node::textureIndex, which stays the same for as long
+   * as the node has children. The end result could be an unbalanced tree, so
+   * the parent index is stored at each node to make it possible to traverse
+   * upwards. Leaf nodes do not have texels of their own; they only appear as
+   * entries in their parent's texels.
    *
    * @param octree The voxel octree.
-   * @param tileId The ID of the node to be encoded.
-   * @param nodeCount The current number of encoded numbers, used to assign
-   * indices to each node. Accumulates over all calls of this function.
-   * @param octreeIndex The index of the node relative to all the nodes
-   * encountered in the octree, based on nodeCount. Acts as the identifier for
-   * the node.
-   * @param textureIndex The texel index of the node within the texture where
-   * the node will be expanded if it is an internal node.
-   * @param parentOctreeIndex The octree index of the parent.
-   * @param parentTextureIndex The texel index of the node within the texture
-   * where the node data will be written, relative to the parent's texel
-   * index.
+   * @param node The node to be encoded.
+   * @param entryTextureIndex The texel index where the node's entry will be
+   * written, within its parent's texels.
+   * @param result The encoded octree.
    */
-  void encodeNode(
+  static void encodeEntry(
       const FVoxelOctree& octree,
-      const CesiumGeometry::OctreeTileID& tileId,
-      uint32& nodeCount,
-      uint32 octreeIndex,
-      uint32 textureIndex,
-      uint32 parentOctreeIndex,
-      uint32 parentTextureIndex,
+      const FVoxelOctree::Node& node,
+      uint32 entryTextureIndex,
       std::vector<std::byte>& result);
 
-  uint32 _tilesPerRow;
-};
-
-/**
- * @brief A representation of an implicit octree tileset containing voxels.
- *
- * This is relevant to the raycasted approach for rendering voxels and
- * is meant to be paired with \ref FVoxelDataTextures. The structure of
- * the voxel tileset is communicated to the shader through a texture.
- * Tiles with renderable data are linked to slots in \ref FVoxelDataTextures.
- *
- * The connection with \ref FVoxelDataTextures is managed externally by
- * \UCesiumVoxelRendererComponent.
- */
-class FVoxelOctree {
-public:
-  /**
-   * @brief A tile in an implicitly tiled octree.
-   */
-  struct Node {
-    /**
-     * @brief Points to the parent of the node, if it exists.
-     */
-    Node* pParent = nullptr;
-    /**
-     * @brief Whether the tile's children exist in the octree.
-     */
-    bool hasChildren = false;
-    /**
-     * @brief The tile's last known screen space error.
-     */
-    double lastKnownScreenSpaceError = 0.0;
-    /**
-     * @brief The index of the slot that this tile occupies in \ref
-     * FVoxelDataTextures, if any.
-     */
-    int64_t dataIndex = -1;
-    /**
-     * @brief Whether this tile's data is actually loaded into \ref
-     * FVoxelDataTextures. Although the node may have an assigned slot index,
-     * the data must be uploaded to the texture during the render thread, and
-     * thus won't be immediately available to render.
-     */
-    bool isDataReady = false;
-  };
-
-  /**
-   * @brief Constructs an initially empty octree with the specified tile
-   * capacity.
-   */
-  FVoxelOctree(uint32 maximumTileCount);
-
-  ~FVoxelOctree();
-
-  /**
-   * @brief Gets a node in the octree at the specified tile ID. Returns nullptr
-   * if it does not exist.
-   *
-   * @param TileID The octree tile ID.
-   */
-  const Node* getNode(const CesiumGeometry::OctreeTileID& TileID) const;
-
-  /**
-   * @copydoc getNode
-   */
-  Node* getNode(const CesiumGeometry::OctreeTileID& TileID);
-
-  /**
-   * @brief Creates a node in the octree at the specified tile ID, including the
-   * parent nodes needed to traverse to it.
-   *
-   * If the node already exists, this returns false.
-   *
-   * @param TileID The octree tile ID.
-   * @param Whether the node was successfully added.
-   */
-  bool createNode(const CesiumGeometry::OctreeTileID& TileID);
-
   /**
-   * @brief Attempts to remove the node at the specified tile ID.
-   *
-   * This will fail to remove the node from the tree if:
-   *
-   * - the node is the root of the tree
-   * - the node has renderable siblings
-   *
-   * @param TileID The octree tile ID.
-   * @return Whether the node was successfully removed.
-   */
-  bool removeNode(const CesiumGeometry::OctreeTileID& TileID);
-
-  /**
-   * @brief Retrieves the texture containing the encoded octree.
-   */
-  UTexture2D* getTexture() const { return this->_pTexture; }
-
-  bool updateTexture();
-
-  bool canBeDestroyed() const;
-
-private:
-  bool isNodeRenderable(const CesiumGeometry::OctreeTileID& tileId) const;
-
-  struct OctreeTileIDHash {
-    size_t operator()(const CesiumGeometry::OctreeTileID& tileId) const;
-  };
-
-  /**
-   * This implementation is inspired by Linear (hashed) Octrees:
-   * https://geidav.wordpress.com/2014/08/18/advanced-octrees-2-node-representations/
+   * @brief Writes the texels of an internal node: the index of its parent
+   * followed by the entries of its children.
    *
-   * Nodes must track their parent / child relationships so that the tree
-   * structure can be encoded to a texture, for voxel raymarching. However,
-   * nodes must also be easily created and/or accessed. cesium-native passes
-   * tiles over in a vector without spatial organization. Typical tree
-   * queries are O(log(n)) where n = # tree levels. This is unideal, since it's
-   * likely that multiple tiles will be made visible in an update based on
-   * movement.
+   * The leaves below the node may be rendered with the data of the node or of
+   * one of its ancestors, so the children are re-encoded recursively, stopping
+   * at nodes that have their own data or are empty.
    *
-   * The compromise: a hashmap that stores octree nodes based on their tile ID.
-   * The nodes don't point to any children themselves; instead, they store a
-   * bool indicating whether or not children have been created for them. It's on
-   * the octree to properly manage this.
+   * @param octree The voxel octree.
+   * @param node The node to be encoded.
+   * @param result The encoded octree.
+   * @param modifiedNodes Accumulates the texture indices of the nodes whose
+   * texels were written.
    */
-  using NodeMap =
-      std::unordered_map<CesiumGeometry::OctreeTileID, Node, OctreeTileIDHash>;
-  NodeMap _nodes;
-
-  UVoxelOctreeTexture* _pTexture;
-  uint32_t _tilesPerRow;
-  std::optional<FRenderCommandFence> _fence;
+  static void encodeInternalNode(
+      const FVoxelOctree& octree,
+      const FVoxelOctree::Node& node,
+      std::vector<std::byte>& result,
+      std::vector<uint32>& modifiedNodes);
 
-  // As the octree grows, save the allocated memory so that recomputing the
-  // same-size octree won't require more allocations.
-  std::vector<std::byte> _data;
+  uint32 _tilesPerRow;
 };
@@ -38,6 +38,7 @@ class ACesiumCartographicSelection;
 class ACesiumCameraManager;
 class UCesiumBoundingVolumePoolComponent;
 class UCesiumFeaturesMetadataComponent;
+class UCesiumMaterialInstancePool;
 class UCesiumVoxelRendererComponent;
 class CesiumViewExtension;
 struct FCesiumCamera;
@@ -68,6 +69,50 @@ DECLARE_DELEGATE_ThreeParams(
     const TArray<FCesiumSampleHeightResult>&,
     const TArray<FString>&);
 
+/**
+ * The delegate invoked by ACesium3DTileset::SampleHeightMostDetailedStreaming
+ * each time the heights of a chunk of positions have been sampled. The second
+ * parameter is the index, in the original array of positions, of the first
+ * result in the chunk.
+ */
+DECLARE_DELEGATE_FourParams(
+    FCesiumSampleHeightChunkCallback,
+    ACesium3DTileset*,
+    int32,
+    const TArray<FCesiumSampleHeightResult>&,
+    const TArray<FString>&);
+
+/**
+ * The delegate invoked by ACesium3DTileset::SampleHeightMostDetailedStreaming
+ * when the query is finished. The parameter is true if every chunk was
+ * sampled, or false if the tileset was destroyed first, in which case only
+ * the chunks already delivered to the chunk callback have results.
+ */
+DECLARE_DELEGATE_OneParam(FCesiumSampleHeightQueryCompleteCallback, bool);
+
+/**
+ * A handle to a height query started with
+ * ACesium3DTileset::SampleHeightMostDetailedStreaming, which can be used to
+ * cancel it.
+ */
+class CESIUMRUNTIME_API FCesiumSampleHeightQuery {
+public:
+  /**
+   * Cancels the query. Chunks that have not been started yet will not be
+   * sampled, and no further callbacks will be invoked, including the
+   * completion callback.
+   */
+  void Cancel() { this->_cancelled = true; }
+
+  /**
+   * Gets whether the query has been cancelled.
+   */
+  bool IsCancelled() const { return this->_cancelled; }
+
+private:
+  std::atomic<bool> _cancelled = false;
+};
+
 /**
  * The delegate for the Acesium3DTileset::OnTilesetLoaded,
  * which is triggered from UpdateLoadStatus
@@ -142,12 +187,49 @@ public:
    * sample heights. The Longitude (X) and Latitude (Y) are expressed in
    * degrees, while Height (Z) is given in meters.
    * @param OnHeightsSampled A callback that is invoked in the game thread when
-   * heights have been sampled for all positions.
+   * heights have been sampled for all positions. It is invoked even if the
+   * tileset is destroyed first, in which case its tileset parameter is
+   * nullptr and every sample is reported as failed.
    */
   void SampleHeightMostDetailed(
       const TArray<FVector>& LongitudeLatitudeHeightArray,
       FCesiumSampleHeightMostDetailedCallback OnHeightsSampled);
 
+  /**
+   * @brief Initiates an asynchronous query for the height of this tileset at a
+   * list of cartographic positions, like SampleHeightMostDetailed, but
+   * delivers the results in chunks as they become available rather than all
+   * at once.
+   *
+   * The positions are split into consecutive chunks of at most ChunkSize
+   * positions, and at most MaxConcurrentChunks chunks are sampled at a time.
+   * Because all chunks are sampled by this tileset, tiles loaded for one chunk
+   * are reused by the chunks that follow it while they remain in the tile
+   * cache, so ordering the positions spatially (as in a terrain profile)
+   * reduces the number of tiles that need to be loaded.
+   *
+   * @param LongitudeLatitudeHeightArray The cartographic positions for which to
+   * sample heights. The Longitude (X) and Latitude (Y) are expressed in
+   * degrees, while Height (Z) is given in meters.
+   * @param OnChunkSampled A callback that is invoked in the game thread each
+   * time the heights of a chunk have been sampled. Chunks may complete out of
+   * order.
+   * @param OnComplete A callback that is invoked in the game thread after
+   * every chunk has been delivered, unless the query is cancelled first. If
+   * the tileset is destroyed first, it is invoked with false once the chunks
+   * in flight have been delivered, and the remaining chunks are not sampled.
+   * @param ChunkSize The maximum number of positions sampled together.
+   * @param MaxConcurrentChunks The maximum number of chunks that are sampled
+   * at the same time.
+   * @return A handle that can be used to cancel the query.
+   */
+  TSharedRef<FCesiumSampleHeightQuery> SampleHeightMostDetailedStreaming(
+      TArray<FVector> LongitudeLatitudeHeightArray,
+      FCesiumSampleHeightChunkCallback OnChunkSampled,
+      FCesiumSampleHeightQueryCompleteCallback OnComplete,
+      int32 ChunkSize = 1024,
+      int32 MaxConcurrentChunks = 4);
+
 private:
   /**
    * The designated georeference actor controlling how the actor's
@@ -872,6 +954,52 @@ private:
       Category = "Cesium|Rendering")
   bool AlwaysIncludeTangents = false;
 
+  /**
+   * Whether to generate missing tangents without duplicating the vertices of
+   * each triangle.
+   *
+   * By default, tangents are generated with the MikkTSpace algorithm on a copy
+   * of the mesh in which no vertex is shared between triangles, which
+   * multiplies the vertex count of an indexed mesh by as much as six. When
+   * this property is true, the per-triangle tangents computed by MikkTSpace
+   * are instead averaged onto the original, shared vertices, and the original
+   * index buffer is kept. This greatly reduces load time and memory use for
+   * large indexed meshes that need tangents, at the cost of tangents that may
+   * differ slightly from a true MikkTSpace basis across UV seams that share a
+   * vertex.
+   *
+   * This has no effect on primitives that need flat normals, because
+   * generating those always requires duplicating vertices.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetShareVerticesForGeneratedTangents,
+      BlueprintSetter = SetShareVerticesForGeneratedTangents,
+      Category = "Cesium|Rendering")
+  bool ShareVerticesForGeneratedTangents = false;
+
+  /**
+   * Whether to store the texture coordinates of tile meshes as 16-bit floats
+   * instead of 32-bit floats, to reduce GPU memory usage. Only texture
+   * coordinates are affected.
+   *
+   * This is not done for primitives with per-vertex feature IDs or metadata,
+   * which need the full precision to represent integer IDs exactly. Texture
+   * coordinates that span a very large texture, such as those for a
+   * high-resolution raster overlay, may show visible sampling artifacts at
+   * 16-bit precision.
+   *
+   * Normals and tangents are always stored in packed 8-bit form. Positions
+   * are always stored as 32-bit floats, relative to the tile, because that is
+   * what Unreal's local vertex factory requires.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetUseCompactTextureCoordinates,
+      BlueprintSetter = SetUseCompactTextureCoordinates,
+      Category = "Cesium|Rendering")
+  bool UseCompactTextureCoordinates = false;
+
   /**
    * Whether to generate smooth normals when normals are missing in the glTF.
    *
@@ -1161,6 +1289,23 @@ public:
   UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
   void SetAlwaysIncludeTangents(bool bAlwaysIncludeTangents);
 
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
+  bool GetShareVerticesForGeneratedTangents() const {
+    return ShareVerticesForGeneratedTangents;
+  }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
+  void SetShareVerticesForGeneratedTangents(
+      bool bShareVerticesForGeneratedTangents);
+
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
+  bool GetUseCompactTextureCoordinates() const {
+    return UseCompactTextureCoordinates;
+  }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
+  void SetUseCompactTextureCoordinates(bool bUseCompactTextureCoordinates);
+
   UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
   bool GetGenerateSmoothNormals() const { return GenerateSmoothNormals; }
 
@@ -1291,6 +1436,12 @@ protected:
 
 private:
   void LoadTileset();
+
+  /**
+   * Resolves the objects and creates the native tileset needed to sample
+   * heights, which may be requested before the first Tick.
+   */
+  void _prepareForHeightQueries();
   void DestroyTileset();
 
   static Cesium3DTilesSelection::ViewState CreateViewStateFromViewParameters(
@@ -1347,6 +1498,14 @@ public:
    */
   void SetLifecycleEventReceiver(UObject* EventReceiver);
 
+  /**
+   * Gets the pool of material instances reused by the primitives of this
+   * tileset's tiles. This is nullptr until the tileset is loaded.
+   */
+  UCesiumMaterialInstancePool* GetMaterialInstancePool() const {
+    return this->_pMaterialInstancePool;
+  }
+
 private:
   /**
    * The event handler for ACesiumGeoreference::OnEllipsoidChanged.
@@ -1439,6 +1598,13 @@ private:
    */
   UCesiumVoxelRendererComponent* _pVoxelRendererComponent = nullptr;
 
+  /**
+   * The material instances of unloaded tiles, kept to be reused by tiles that
+   * load later.
+   */
+  UPROPERTY(Transient)
+  UCesiumMaterialInstancePool* _pMaterialInstancePool = nullptr;
+
   // For debug output
   uint32_t _lastTilesRendered;
   uint32_t _lastWorkerThreadTileLoadQueueLength;
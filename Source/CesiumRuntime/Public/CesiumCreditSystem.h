@@ -7,9 +7,11 @@
 #include "GameFramework/Actor.h"
 #include "UObject/Class.h"
 #include "UObject/ConstructorHelpers.h"
+#include <CesiumUtility/CreditSystem.h>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #if WITH_EDITOR
 #include "IAssetViewport.h"
@@ -18,10 +20,6 @@
 
 #include "CesiumCreditSystem.generated.h"
 
-namespace CesiumUtility {
-class CreditSystem;
-}
-
 /**
  * Manages credits / atttribution for Cesium data sources. These credits
  * are displayed by the corresponding Blueprints class
@@ -84,7 +82,22 @@ private:
   // the underlying cesium-native credit system that is managed by this actor.
   std::shared_ptr<CesiumUtility::CreditSystem> _pCreditSystem;
 
-  size_t _lastCreditsCount;
+  /**
+   * A credit that was shown in the last frame in which the credits changed,
+   * along with its converted text.
+   */
+  struct CreditLayout {
+    CesiumUtility::Credit credit;
+    bool showOnScreen;
+    FString rtf;
+  };
+
+  bool _creditsChanged(
+      const std::vector<CesiumUtility::Credit>& creditsToShowThisFrame) const;
+  const FString& _getCreditRtf(const CesiumUtility::Credit& credit);
+
+  // The credits shown in the widget, in the order they were shown.
+  std::vector<CreditLayout> _creditLayouts;
 
   FString ConvertHtmlToRtf(std::string html);
   std::unordered_map<std::string, FString> _htmlToRtf;
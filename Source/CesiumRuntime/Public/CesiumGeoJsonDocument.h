@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "CesiumGeoJsonGeometryColumns.h"
 #include "CesiumGeoJsonObject.h"
 #include "CesiumUtility/IntrusivePointer.h"
 #include "CesiumVectorData/GeoJsonDocument.h"
@@ -15,6 +16,8 @@
 
 #include "CesiumGeoJsonDocument.generated.h"
 
+class CesiumGeoJsonSpatialIndex;
+
 /**
  * @brief A GeoJSON document containing a tree of `FCesiumGeoJsonObject` values.
  */
@@ -45,8 +48,72 @@ struct FCesiumGeoJsonDocument {
    */
   const std::shared_ptr<CesiumVectorData::GeoJsonDocument>& GetDocument() const;
 
+  /**
+   * @brief Builds a spatial index of the features in this document, replacing
+   * any existing index. Copies of this `FCesiumGeoJsonDocument` made after the
+   * index is built share it.
+   *
+   * This can be called from any thread, as long as the document is not being
+   * modified or queried at the same time.
+   */
+  void BuildSpatialIndex();
+
+  /**
+   * @brief Checks if this document has a spatial index.
+   */
+  bool HasSpatialIndex() const;
+
+  /**
+   * @brief Returns the spatial index of this document, or nullptr if it does
+   * not have one.
+   */
+  const std::shared_ptr<const CesiumGeoJsonSpatialIndex>&
+  GetSpatialIndex() const;
+
+  /**
+   * @brief Copies the geometry of every feature in this document into flat
+   * arrays, replacing any existing geometry columns. Copies of this
+   * `FCesiumGeoJsonDocument` made afterward share them. The coordinates are
+   * stored with reduced precision, as described in
+   * `FCesiumGeoJsonGeometryColumns`.
+   *
+   * This can be called from any thread, as long as the document is not being
+   * modified at the same time.
+   *
+   * @param onProgress If bound, called periodically with the fraction of the
+   * features that have been processed.
+   */
+  void BuildGeometryColumns(const TFunction<void(float)>& onProgress = nullptr);
+
+  /**
+   * @brief Like `BuildGeometryColumns`, but releases the geometry of each
+   * feature from the document as soon as it has been copied, so that the
+   * geometry is not held twice. The features keep their properties and
+   * other members. This also removes the spatial index, which needs the
+   * geometry.
+   *
+   * Afterward, the document's features have no geometry, so it can no longer
+   * be spatially indexed or drawn by a raster overlay. Because this modifies
+   * the document, it must only be called while nothing else refers to it,
+   * such as right after it has been loaded.
+   *
+   * @param onProgress If bound, called periodically with the fraction of the
+   * features that have been processed.
+   */
+  void
+  MoveGeometryToColumns(const TFunction<void(float)>& onProgress = nullptr);
+
+  /**
+   * @brief Returns the geometry columns of this document, or nullptr if they
+   * have not been built.
+   */
+  const std::shared_ptr<const FCesiumGeoJsonGeometryColumns>&
+  GetGeometryColumns() const;
+
 private:
   std::shared_ptr<CesiumVectorData::GeoJsonDocument> _pDocument;
+  std::shared_ptr<const CesiumGeoJsonSpatialIndex> _pSpatialIndex;
+  std::shared_ptr<const FCesiumGeoJsonGeometryColumns> _pGeometryColumns;
 
   friend class UCesiumGeoJsonDocumentBlueprintLibrary;
 };
@@ -86,6 +153,188 @@ public:
       meta = (DisplayName = "Get Root Node"))
   static FCesiumGeoJsonObject
   GetRootObject(const FCesiumGeoJsonDocument& InGeoJsonDocument);
+
+  /**
+   * Builds a spatial index of the features in the provided GeoJSON document,
+   * which makes the feature queries on this library fast enough to be used
+   * every frame, even for large documents.
+   *
+   * Building the index can take some time for large documents. The document
+   * loaders can build it on a worker thread instead.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Vector|Document",
+      meta = (DisplayName = "Build Spatial Index"))
+  static void
+  BuildSpatialIndex(UPARAM(Ref) FCesiumGeoJsonDocument& InGeoJsonDocument);
+
+  /**
+   * Checks if the provided GeoJSON document has a spatial index.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Vector|Document",
+      meta = (DisplayName = "Has Spatial Index"))
+  static bool HasSpatialIndex(const FCesiumGeoJsonDocument& InGeoJsonDocument);
+
+  /**
+   * Finds the features of the document whose Polygon or MultiPolygon
+   * geometry contains the given Longitude (X) and Latitude (Y), in degrees.
+   * Polygon holes are respected, and the Height (Z) is ignored.
+   *
+   * If the document has no spatial index, every feature is visited, which is
+   * slow for large documents that are queried often.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Vector|Document",
+      meta = (DisplayName = "Find Features At Position"))
+  static TArray<FCesiumGeoJsonFeature> FindFeaturesAtPosition(
+      const FCesiumGeoJsonDocument& InGeoJsonDocument,
+      const FVector& LongitudeLatitude);
+
+  /**
+   * Finds the features of the document whose bounds intersect a box, whose
+   * minimum and maximum X and Y are longitudes and latitudes in degrees. The
+   * Z components are ignored.
+   *
+   * If the document has no spatial index, every feature is visited, which is
+   * slow for large documents that are queried often.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Vector|Document",
+      meta = (DisplayName = "Find Features In Box"))
+  static TArray<FCesiumGeoJsonFeature> FindFeaturesInBox(
+      const FCesiumGeoJsonDocument& InGeoJsonDocument,
+      const FBox& LongitudeLatitudeBox);
+
+  /**
+   * Finds the feature of the document whose geometry is closest to the given
+   * Longitude (X) and Latitude (Y), in degrees. Distances are measured in
+   * degrees, so this is most accurate for features that are close together.
+   * If the document has no features with geometry, the `No Value` branch is
+   * taken.
+   *
+   * If the document has no spatial index, every feature is visited, which is
+   * slow for large documents that are queried often.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Vector|Document",
+      meta =
+          (DisplayName = "Find Nearest Feature",
+           ExpandEnumAsExecs = "Branches"))
+  static FCesiumGeoJsonFeature FindNearestFeature(
+      const FCesiumGeoJsonDocument& InGeoJsonDocument,
+      const FVector& LongitudeLatitude,
+      EHasValue& Branches);
+
+  /**
+   * Checks if the provided GeoJSON document has geometry columns, which are
+   * built when a document loader's `BuildGeometryColumns` option is true.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Vector|Document|Geometry Columns",
+      meta = (DisplayName = "Has Geometry Columns"))
+  static bool
+  HasGeometryColumns(const FCesiumGeoJsonDocument& InGeoJsonDocument);
+
+  /**
+   * Gets the number of features in the geometry columns of the provided
+   * GeoJSON document, or 0 if it has none. Features are numbered in the order
+   * they appear in the document.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Vector|Document|Geometry Columns",
+      meta = (DisplayName = "Get Geometry Columns Feature Count"))
+  static int32 GetGeometryColumnsFeatureCount(
+      const FCesiumGeoJsonDocument& InGeoJsonDocument);
+
+  /**
+   * Gets a feature in the geometry columns of the provided GeoJSON document,
+   * from which its ID and properties can be read. Returns an invalid feature
+   * if the index is out of range.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Vector|Document|Geometry Columns",
+      meta = (DisplayName = "Get Geometry Columns Feature"))
+  static FCesiumGeoJsonFeature GetGeometryColumnsFeature(
+      const FCesiumGeoJsonDocument& InGeoJsonDocument,
+      int32 FeatureIndex);
+
+  /**
+   * Gets the number of geometry parts of a feature in the geometry columns of
+   * the provided GeoJSON document, or 0 if the index is out of range. See
+   * `FCesiumGeoJsonGeometryColumns` for how geometry is divided into parts and
+   * lines.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Vector|Document|Geometry Columns",
+      meta = (DisplayName = "Get Geometry Columns Part Count"))
+  static int32 GetGeometryColumnsPartCount(
+      const FCesiumGeoJsonDocument& InGeoJsonDocument,
+      int32 FeatureIndex);
+
+  /**
+   * Gets the number of lines in a part of a feature in the geometry columns of
+   * the provided GeoJSON document, or 0 if an index is out of range.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Vector|Document|Geometry Columns",
+      meta = (DisplayName = "Get Geometry Columns Line Count"))
+  static int32 GetGeometryColumnsLineCount(
+      const FCesiumGeoJsonDocument& InGeoJsonDocument,
+      int32 FeatureIndex,
+      int32 PartIndex);
+
+  /**
+   * Gets the number of points in a line of a feature in the geometry columns
+   * of the provided GeoJSON document, or 0 if an index is out of range.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Vector|Document|Geometry Columns",
+      meta = (DisplayName = "Get Geometry Columns Point Count"))
+  static int32 GetGeometryColumnsPointCount(
+      const FCesiumGeoJsonDocument& InGeoJsonDocument,
+      int32 FeatureIndex,
+      int32 PartIndex,
+      int32 LineIndex);
+
+  /**
+   * Gets the Longitude-Latitude-Height of a point in a line of a feature in
+   * the geometry columns of the provided GeoJSON document, or a zero vector if
+   * an index is out of range.
+   *
+   * Unlike the geometry functions of `UCesiumGeoJsonObjectBlueprintLibrary`,
+   * this does not copy the rest of the line, so it is suitable for visiting
+   * the points of large documents in a loop.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Vector|Document|Geometry Columns",
+      meta = (DisplayName = "Get Geometry Columns Point"))
+  static FVector GetGeometryColumnsPoint(
+      const FCesiumGeoJsonDocument& InGeoJsonDocument,
+      int32 FeatureIndex,
+      int32 PartIndex,
+      int32 LineIndex,
+      int32 PointIndex);
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -95,6 +344,66 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     FCesiumGeoJsonDocument,
     Document);
 
+/**
+ * The delegate for the progress of the GeoJSON document loaders in processing
+ * a document once it has been parsed, which is broadcast in the game thread
+ * with a value between 0 and 1.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(
+    FCesiumGeoJsonDocumentProcessingProgressDelegate,
+    float);
+
+UCLASS()
+class CESIUMRUNTIME_API UCesiumLoadGeoJsonDocumentFromStringAsyncAction
+    : public UBlueprintAsyncActionBase {
+  GENERATED_BODY()
+public:
+  /**
+   * Attempts to load a GeoJSON document from a string containing GeoJSON
+   * data. Unlike `LoadGeoJsonFromString`, the document is parsed on a worker
+   * thread, so loading a large document does not stall the game thread.
+   *
+   * If successful, `Success` will be true and `Document` will contain the
+   * loaded document.
+   *
+   * If `BuildSpatialIndex` is true, a spatial index of the document's
+   * features is built on a worker thread before the document is returned.
+   * Likewise, if `BuildGeometryColumns` is true, the geometry of the
+   * document's features is moved into compact flat arrays, which can be read
+   * one point at a time with the Geometry Columns functions of
+   * `UCesiumGeoJsonDocumentBlueprintLibrary`, or as array views from C++.
+   * The document's features then have no geometry of their own, unless
+   * `BuildSpatialIndex` is also true, in which case the index needs the
+   * geometry and the document keeps a copy of it.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Vector|Document",
+      meta =
+          (BlueprintInternalUseOnly = true,
+           DisplayName = "Load GeoJSON Document from String Async"))
+  static UCesiumLoadGeoJsonDocumentFromStringAsyncAction* LoadFromString(
+      const FString& InString,
+      bool BuildSpatialIndex = false,
+      bool BuildGeometryColumns = false);
+
+  UPROPERTY(BlueprintAssignable)
+  FCesiumGeoJsonDocumentAsyncLoadDelegate OnLoadResult;
+
+  /**
+   * Broadcast as the geometry columns and spatial index are built, after the
+   * document has been parsed. Parsing is not covered: 0 is broadcast when it
+   * finishes, and 1 once the document is ready to be returned.
+   */
+  FCesiumGeoJsonDocumentProcessingProgressDelegate OnProcessingProgress;
+
+  virtual void Activate() override;
+
+  FString String;
+  bool BuildSpatialIndex;
+  bool BuildGeometryColumns;
+};
+
 UCLASS()
 class CESIUMRUNTIME_API UCesiumLoadGeoJsonDocumentFromIonAsyncAction
     : public UBlueprintAsyncActionBase {
@@ -109,6 +418,16 @@ public:
    *
    * If successful, `Success` will be true and `Document` will contain the
    * loaded document.
+   *
+   * If `BuildSpatialIndex` is true, a spatial index of the document's
+   * features is built on a worker thread before the document is returned.
+   * Likewise, if `BuildGeometryColumns` is true, the geometry of the
+   * document's features is moved into compact flat arrays, which can be read
+   * one point at a time with the Geometry Columns functions of
+   * `UCesiumGeoJsonDocumentBlueprintLibrary`, or as array views from C++.
+   * The document's features then have no geometry of their own, unless
+   * `BuildSpatialIndex` is also true, in which case the index needs the
+   * geometry and the document keeps a copy of it.
    */
   UFUNCTION(
       BlueprintCallable,
@@ -119,15 +438,27 @@ public:
   static UCesiumLoadGeoJsonDocumentFromIonAsyncAction* LoadFromIon(
       int64 AssetId,
       const FString& IonAccessToken,
-      const UCesiumIonServer* CesiumIonServer = nullptr);
+      const UCesiumIonServer* CesiumIonServer = nullptr,
+      bool BuildSpatialIndex = false,
+      bool BuildGeometryColumns = false);
 
   UPROPERTY(BlueprintAssignable)
   FCesiumGeoJsonDocumentAsyncLoadDelegate OnLoadResult;
 
+  /**
+   * Broadcast as the geometry columns and spatial index are built, after the
+   * document has been downloaded and parsed. Neither the download nor parsing
+   * is covered: 0 is broadcast when both finish, and 1 once the document is
+   * ready to be returned.
+   */
+  FCesiumGeoJsonDocumentProcessingProgressDelegate OnProcessingProgress;
+
   virtual void Activate() override;
 
   int64 AssetId;
   FString IonAccessToken;
+  bool BuildSpatialIndex;
+  bool BuildGeometryColumns;
 
   UPROPERTY()
   const UCesiumIonServer* CesiumIonServer;
@@ -143,6 +474,16 @@ public:
    *
    * If successful, `Success` will be true and `Document` will contain the
    * loaded document.
+   *
+   * If `BuildSpatialIndex` is true, a spatial index of the document's
+   * features is built on a worker thread before the document is returned.
+   * Likewise, if `BuildGeometryColumns` is true, the geometry of the
+   * document's features is moved into compact flat arrays, which can be read
+   * one point at a time with the Geometry Columns functions of
+   * `UCesiumGeoJsonDocumentBlueprintLibrary`, or as array views from C++.
+   * The document's features then have no geometry of their own, unless
+   * `BuildSpatialIndex` is also true, in which case the index needs the
+   * geometry and the document keeps a copy of it.
    */
   UFUNCTION(
       BlueprintCallable,
@@ -150,14 +491,27 @@ public:
       meta =
           (BlueprintInternalUseOnly = true,
            DisplayName = "Load GeoJSON Document from URL"))
-  static UCesiumLoadGeoJsonDocumentFromUrlAsyncAction*
-  LoadFromUrl(const FString& Url, const TMap<FString, FString>& Headers);
+  static UCesiumLoadGeoJsonDocumentFromUrlAsyncAction* LoadFromUrl(
+      const FString& Url,
+      const TMap<FString, FString>& Headers,
+      bool BuildSpatialIndex = false,
+      bool BuildGeometryColumns = false);
 
   UPROPERTY(BlueprintAssignable)
   FCesiumGeoJsonDocumentAsyncLoadDelegate OnLoadResult;
 
+  /**
+   * Broadcast as the geometry columns and spatial index are built, after the
+   * document has been downloaded and parsed. Neither the download nor parsing
+   * is covered: 0 is broadcast when both finish, and 1 once the document is
+   * ready to be returned.
+   */
+  FCesiumGeoJsonDocumentProcessingProgressDelegate OnProcessingProgress;
+
   virtual void Activate() override;
 
   FString Url;
   TMap<FString, FString> Headers;
+  bool BuildSpatialIndex;
+  bool BuildGeometryColumns;
 };
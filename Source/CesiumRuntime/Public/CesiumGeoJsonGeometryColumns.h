@@ -0,0 +1,199 @@
+// Copyright 2020-2026 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "CesiumGeoJsonObject.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Math/Vector.h"
+#include "Templates/Function.h"
+
+#include <CesiumVectorData/GeoJsonObject.h>
+
+/**
+ * @brief The geometry of every feature in a GeoJSON document, stored in a few
+ * flat arrays rather than as a tree of objects.
+ *
+ * The geometry of each feature is made of parts, and each part is made of
+ * lines, which are runs of consecutive Longitude-Latitude-Height coordinates:
+ *
+ * - A Point or MultiPoint is a single part with a single line containing all
+ * of its points.
+ * - A LineString is a single part with a single line.
+ * - A MultiLineString has one part for each line string.
+ * - A Polygon is a single part with one line per ring. The first ring is the
+ * outer boundary, and any others are holes.
+ * - A MultiPolygon has one part for each polygon.
+ * - A GeometryCollection has the parts of each of its geometries, in order.
+ *
+ * Features are numbered in the order they appear in the document, and include
+ * features without geometry, which have no parts.
+ *
+ * The parsed document still holds the properties of each feature. When the
+ * columns are built with `MoveFromDocument`, each feature's geometry is
+ * released from the document as soon as it has been copied, so the geometry
+ * is only ever held in full once. Otherwise the document keeps its geometry
+ * and the columns are an additional copy.
+ *
+ * Coordinates are stored as single-precision offsets from an origin at the
+ * center of each feature's bounds, which takes half the space of
+ * double-precision coordinates. The cost is precision: the error of each
+ * offset is at most about 3e-8 times the feature's extent, which is a few
+ * millimeters for a feature one degree across. Use GetPosition to recover a
+ * coordinate.
+ *
+ * The offset views returned by this class point directly into its storage,
+ * so they remain valid for as long as this object does. Once built, it may
+ * be read from any thread.
+ */
+class CESIUMRUNTIME_API FCesiumGeoJsonGeometryColumns {
+public:
+  /**
+   * @brief Builds the geometry columns for every feature under the given root
+   * object.
+   *
+   * @param rootObject The root object of the document.
+   * @param onProgress If bound, called periodically with the fraction of the
+   * features that have been processed, from the thread building the columns.
+   */
+  explicit FCesiumGeoJsonGeometryColumns(
+      const CesiumVectorData::GeoJsonObject& rootObject,
+      const TFunction<void(float)>& onProgress = nullptr);
+
+  /**
+   * @brief Builds the geometry columns for every feature under the given root
+   * object, releasing the geometry of each feature from the document once it
+   * has been copied. Only the features' properties and other members remain.
+   *
+   * Afterward, the document's features have no geometry, so spatial indexes,
+   * raster overlays, and `FCesiumGeoJsonObject` geometry functions see none.
+   * Nothing may refer to the geometry of the document while this runs.
+   *
+   * @param rootObject The root object of the document.
+   * @param onProgress If bound, called periodically with the fraction of the
+   * features that have been processed, from the thread building the columns.
+   */
+  static FCesiumGeoJsonGeometryColumns MoveFromDocument(
+      CesiumVectorData::GeoJsonObject& rootObject,
+      const TFunction<void(float)>& onProgress = nullptr);
+
+  /** @brief Gets the number of features. */
+  int32 GetFeatureCount() const { return this->_features.Num(); }
+
+  /** @brief Gets the feature with the given index. */
+  const CesiumVectorData::GeoJsonFeature*
+  GetFeature(int32 featureIndex) const {
+    return this->_features[featureIndex];
+  }
+
+  /** @brief Gets the number of geometry parts of a feature. */
+  int32 GetPartCount(int32 featureIndex) const {
+    return this->_featurePartOffsets[featureIndex + 1] -
+           this->_featurePartOffsets[featureIndex];
+  }
+
+  /**
+   * @brief Gets the type of a part of a feature's geometry, which is the type
+   * of the GeoJSON geometry object the part came from.
+   */
+  ECesiumGeoJsonObjectType
+  GetPartType(int32 featureIndex, int32 partIndex) const {
+    return this->_partTypes[this->_getPart(featureIndex, partIndex)];
+  }
+
+  /** @brief Gets the number of lines in a part of a feature's geometry. */
+  int32 GetLineCount(int32 featureIndex, int32 partIndex) const {
+    const int32 part = this->_getPart(featureIndex, partIndex);
+    return this->_partLineOffsets[part + 1] - this->_partLineOffsets[part];
+  }
+
+  /**
+   * @brief Gets the Longitude-Latitude-Height that the coordinates of a
+   * feature are offsets from. This is the center of the feature's bounds, or
+   * zero if it has no coordinates.
+   */
+  const FVector& GetFeatureOrigin(int32 featureIndex) const {
+    return this->_featureOrigins[featureIndex];
+  }
+
+  /**
+   * @brief Gets the coordinates of a line in a part of a feature's geometry,
+   * as offsets from the feature's origin.
+   */
+  TConstArrayView<FVector3f>
+  GetLine(int32 featureIndex, int32 partIndex, int32 lineIndex) const {
+    const int32 line =
+        this->_partLineOffsets[this->_getPart(featureIndex, partIndex)] +
+        lineIndex;
+    return this->_getCoordinates(
+        this->_lineCoordinateOffsets[line],
+        this->_lineCoordinateOffsets[line + 1]);
+  }
+
+  /**
+   * @brief Gets all of the coordinates of a feature's geometry, across all of
+   * its parts and lines, as offsets from the feature's origin.
+   */
+  TConstArrayView<FVector3f> GetFeatureCoordinates(int32 featureIndex) const {
+    const int32 firstLine =
+        this->_partLineOffsets[this->_featurePartOffsets[featureIndex]];
+    const int32 endLine =
+        this->_partLineOffsets[this->_featurePartOffsets[featureIndex + 1]];
+    return this->_getCoordinates(
+        this->_lineCoordinateOffsets[firstLine],
+        this->_lineCoordinateOffsets[endLine]);
+  }
+
+  /**
+   * @brief Converts an offset from a feature's origin, as returned by GetLine
+   * or GetFeatureCoordinates, to a Longitude-Latitude-Height.
+   */
+  FVector GetPosition(int32 featureIndex, const FVector3f& offset) const {
+    return this->_featureOrigins[featureIndex] + FVector(offset);
+  }
+
+  /** @brief Gets the total number of coordinates of every feature. */
+  int32 GetCoordinateCount() const { return this->_coordinates.Num(); }
+
+  /**
+   * @brief Gets the number of bytes used by this object.
+   */
+  SIZE_T GetAllocatedSize() const;
+
+private:
+  FCesiumGeoJsonGeometryColumns(
+      const CesiumVectorData::GeoJsonObject& rootObject,
+      const TFunction<void(float)>& onProgress,
+      bool releaseGeometry);
+
+  int32 _getPart(int32 featureIndex, int32 partIndex) const {
+    return this->_featurePartOffsets[featureIndex] + partIndex;
+  }
+
+  TConstArrayView<FVector3f> _getCoordinates(int32 begin, int32 end) const {
+    return TConstArrayView<FVector3f>(
+        this->_coordinates.GetData() + begin,
+        end - begin);
+  }
+
+  void _addGeometry(const CesiumVectorData::GeoJsonObject& geometry);
+  void _addLine(const glm::dvec3* pCoordinates, size_t count);
+  void _endPart(ECesiumGeoJsonObjectType type);
+  void _endFeature();
+
+  TArray<const CesiumVectorData::GeoJsonFeature*> _features;
+  TArray<FVector> _featureOrigins;
+
+  // The full-precision coordinates of the feature being added, which are
+  // converted to offsets once its origin is known.
+  TArray<FVector> _featureCoordinates;
+
+  // Each offsets array has one more element than the number of items it
+  // describes, so item i spans [offsets[i], offsets[i + 1]).
+  TArray<int32> _featurePartOffsets;
+  TArray<int32> _partLineOffsets;
+  TArray<int32> _lineCoordinateOffsets;
+
+  TArray<ECesiumGeoJsonObjectType> _partTypes;
+  TArray<FVector3f> _coordinates;
+};
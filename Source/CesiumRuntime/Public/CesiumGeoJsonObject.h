@@ -329,6 +329,26 @@ public:
   static FCesiumGeoJsonLineString
   GetObjectAsLineString(const FCesiumGeoJsonObject& InObject);
 
+  /**
+   * @brief If this object is a GeoJSON Point, MultiPoint, or LineString type,
+   * this returns the number of its `coordinates`. Otherwise, 0 is returned.
+   *
+   * Together with `GetObjectPointAt`, this visits the points of a large
+   * MultiPoint or LineString without copying all of them on every call, as
+   * `GetObjectAsMultiPoint` and `GetObjectAsLineString` do.
+   */
+  UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Cesium|Vector|Object")
+  static int32 GetObjectPointCount(const FCesiumGeoJsonObject& InObject);
+
+  /**
+   * @brief If this object is a GeoJSON Point, MultiPoint, or LineString type,
+   * this returns the point at the given index of its `coordinates`. Otherwise,
+   * or if the index is out of range, a zero vector is returned.
+   */
+  UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Cesium|Vector|Object")
+  static FVector
+  GetObjectPointAt(const FCesiumGeoJsonObject& InObject, int32 Index);
+
   /**
    * @brief If this object is a GeoJSON MultiLineString type, this returns an
    * array of `FCesiumGeoJsonLineString` objects representing the lines.
@@ -542,6 +542,86 @@ public:
   FVector TransformUnrealDirectionToEarthCenteredEarthFixed(
       const FVector& UnrealDirection) const;
 
+  /**
+   * Transforms each of the given longitude-latitude-height positions into
+   * Unreal coordinates, as
+   * {@link TransformLongitudeLatitudeHeightPositionToUnreal} does for a single
+   * position. Large arrays are transformed across worker threads.
+   */
+  UFUNCTION(
+      BlueprintPure,
+      Category = "Cesium",
+      meta = (ReturnDisplayName = "UnrealPositions"))
+  TArray<FVector> TransformLongitudeLatitudeHeightPositionsToUnreal(
+      const TArray<FVector>& LongitudeLatitudeHeights) const;
+
+  /**
+   * Transforms each of the given positions in Unreal coordinates into
+   * longitude-latitude-height, as
+   * {@link TransformUnrealPositionToLongitudeLatitudeHeight} does for a single
+   * position. Large arrays are transformed across worker threads.
+   */
+  UFUNCTION(
+      BlueprintPure,
+      Category = "Cesium",
+      meta = (ReturnDisplayName = "LongitudeLatitudeHeights"))
+  TArray<FVector> TransformUnrealPositionsToLongitudeLatitudeHeight(
+      const TArray<FVector>& UnrealPositions) const;
+
+  /**
+   * Transforms each of the given Earth-Centered, Earth-Fixed (ECEF) positions
+   * into Unreal coordinates, as
+   * {@link TransformEarthCenteredEarthFixedPositionToUnreal} does for a single
+   * position. Large arrays are transformed across worker threads.
+   */
+  UFUNCTION(
+      BlueprintPure,
+      Category = "Cesium",
+      meta = (ReturnDisplayName = "UnrealPositions"))
+  TArray<FVector> TransformEarthCenteredEarthFixedPositionsToUnreal(
+      const TArray<FVector>& EarthCenteredEarthFixedPositions) const;
+
+  /**
+   * Transforms each of the given positions in Unreal coordinates into
+   * Earth-Centered, Earth-Fixed (ECEF) coordinates, as
+   * {@link TransformUnrealPositionToEarthCenteredEarthFixed} does for a single
+   * position. Large arrays are transformed across worker threads.
+   */
+  UFUNCTION(
+      BlueprintPure,
+      Category = "Cesium",
+      meta = (ReturnDisplayName = "EarthCenteredEarthFixedPositions"))
+  TArray<FVector> TransformUnrealPositionsToEarthCenteredEarthFixed(
+      const TArray<FVector>& UnrealPositions) const;
+
+  /**
+   * Transforms longitude-latitude-height positions into Unreal coordinates,
+   * overwriting each position with the result.
+   */
+  void TransformLongitudeLatitudeHeightPositionsToUnrealInPlace(
+      TArrayView<FVector> Positions) const;
+
+  /**
+   * Transforms positions in Unreal coordinates into longitude-latitude-height,
+   * overwriting each position with the result.
+   */
+  void TransformUnrealPositionsToLongitudeLatitudeHeightInPlace(
+      TArrayView<FVector> Positions) const;
+
+  /**
+   * Transforms Earth-Centered, Earth-Fixed (ECEF) positions into Unreal
+   * coordinates, overwriting each position with the result.
+   */
+  void TransformEarthCenteredEarthFixedPositionsToUnrealInPlace(
+      TArrayView<FVector> Positions) const;
+
+  /**
+   * Transforms positions in Unreal coordinates into Earth-Centered,
+   * Earth-Fixed (ECEF) coordinates, overwriting each position with the result.
+   */
+  void TransformUnrealPositionsToEarthCenteredEarthFixedInPlace(
+      TArrayView<FVector> Positions) const;
+
   /**
    * Given a Rotator that transforms an object into the Unreal coordinate
    * system, returns a new Rotator that transforms that object into an
@@ -119,6 +119,28 @@ private:
       Meta = (AllowPrivateAccess, ReturnDisplayName = "Height Update Interval"))
   int HeightUpdateInterval = 1;
 
+  /**
+   * Whether to find the height of the `ReferencedTileset` with a
+   * `SampleHeightMostDetailed` query, rather than by tracing a ray through the
+   * physics scene. Only used when `HeightReference` is set to `Tileset`.
+   *
+   * Queries from all objects that use this option are combined into a single
+   * query per tileset. The query loads the most detailed tiles below each
+   * object if they are not already loaded, then intersects their geometry on
+   * worker threads, so it does not require the tileset to create physics
+   * meshes. The result arrives asynchronously, so the height is updated some
+   * frames after the object moves, and later still where tiles must first be
+   * loaded.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadWrite,
+      BlueprintGetter = GetSampleHeightFromTileGeometry,
+      BlueprintSetter = SetSampleHeightFromTileGeometry,
+      Category = "Cesium",
+      Meta = (AllowPrivateAccess))
+  bool SampleHeightFromTileGeometry = false;
+
   /**
    * The resolved georeference used by this component. This is not serialized
    * because it may point to a Georeference in the PersistentLevel while this
@@ -273,6 +295,12 @@ public:
   UFUNCTION(BlueprintSetter, Category = "Cesium")
   void SetHeightUpdateInterval(int NewHeightReferenceUpdateInterval);
 
+  UFUNCTION(BlueprintGetter, Category = "Cesium")
+  bool GetSampleHeightFromTileGeometry() const;
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium")
+  void SetSampleHeightFromTileGeometry(bool NewValue);
+
   /**
    * Gets the resolved georeference used by this component. This is not
    * serialized because it may point to a Georeference in the PersistentLevel
@@ -720,6 +748,36 @@ private:
    */
   bool _setHeightFromTilesetReference();
 
+  /**
+   * Whether a height requested from UCesiumHeightClampingSubsystem has not yet
+   * been received.
+   */
+  bool _tileGeometryHeightPending = false;
+
+  /**
+   * Whether the pending height from UCesiumHeightClampingSubsystem should be
+   * used to set the fixed height above the tileset, rather than to move the
+   * actor.
+   */
+  bool _tileGeometryHeightUpdatesFixedHeight = false;
+
+  /**
+   * Requests the height of the ReferencedTileset below the actor from
+   * UCesiumHeightClampingSubsystem, unless one is already pending. When it
+   * arrives, the actor is moved to maintain its fixed height above the
+   * tileset, or, if `updateFixedHeight` was true for any request since the
+   * last one arrived, the fixed height is set from the actor's current
+   * height instead.
+   */
+  void _requestHeightFromTileGeometry(bool updateFixedHeight);
+
+  /**
+   * Forgets any pending height request, so that a new one can be made. Called
+   * when the ReferencedTileset changes; the result of the old request is
+   * ignored when it arrives.
+   */
+  void _resetTileGeometryHeightRequest();
+
   /**
    * Determines if HeightReference is Tileset and ReferencedTileset is set.
    */
@@ -7,9 +7,10 @@
 #include "CesiumPolygonRasterOverlay.generated.h"
 
 class ACesiumCartographicPolygon;
+class CesiumPolygonCoverageIndex;
 
 namespace Cesium3DTilesSelection {
-class RasterizedPolygonsTileExcluder;
+class ITileExcluder;
 }
 
 /**
@@ -50,6 +51,10 @@ public:
    * Note that if InvertSelection is true, this will cull tiles that are
    * outside of all the polygons. If it is false, this will cull tiles that are
    * completely inside at least one polygon.
+   *
+   * The polygons are spatially indexed when the overlay is created, so tiles
+   * are only tested against the polygons near them. This keeps exclusion fast
+   * even with many thousands of polygons.
    */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium")
   bool ExcludeSelectedTiles = true;
@@ -66,6 +71,6 @@ protected:
       CesiumRasterOverlays::RasterOverlay* pOverlay) override;
 
 private:
-  std::shared_ptr<Cesium3DTilesSelection::RasterizedPolygonsTileExcluder>
-      _pExcluder;
+  std::shared_ptr<const CesiumPolygonCoverageIndex> _pCoverageIndex;
+  std::shared_ptr<Cesium3DTilesSelection::ITileExcluder> _pExcluder;
 };
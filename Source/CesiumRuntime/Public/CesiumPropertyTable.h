@@ -173,6 +173,28 @@ public:
       UPARAM(ref) const FCesiumPropertyTable& PropertyTable,
       const FString& PropertyName);
 
+  /**
+   * Retrieves multiple FCesiumPropertyTableProperty by name, in the same order
+   * as the given names. If the property table does not contain a property with
+   * one of the names, an invalid FCesiumPropertyTableProperty is returned in
+   * its place.
+   *
+   * This is intended for querying the values of many features at once: look
+   * up the properties once with this function, then retrieve a column of
+   * values for each property with a batch function such as
+   * {@link UCesiumPropertyTablePropertyBlueprintLibrary::GetFloatValues}.
+   *
+   * @param PropertyTable The property table.
+   * @param PropertyNames The names of the properties to find.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Metadata|PropertyTable")
+  static TArray<FCesiumPropertyTableProperty> FindProperties(
+      UPARAM(ref) const FCesiumPropertyTable& PropertyTable,
+      const TArray<FString>& PropertyNames);
+
   /**
    * Gets all of the property values for a given feature, mapped by property
    * name. This will only include values from valid property table properties.
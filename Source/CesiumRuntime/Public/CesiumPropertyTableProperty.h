@@ -15,6 +15,8 @@
 
 #include "CesiumPropertyTableProperty.generated.h"
 
+struct CesiumEncodedMetadataCoerce;
+
 /**
  * @brief Reports the status of a FCesiumPropertyTableProperty. If the property
  * table property cannot be accessed, this briefly indicates why.
@@ -124,6 +126,7 @@ private:
   TSharedPtr<FCesiumMetadataEnum> _pEnumDefinition;
 
   friend class UCesiumPropertyTablePropertyBlueprintLibrary;
+  friend struct CesiumEncodedMetadataCoerce;
 };
 
 UCLASS()
@@ -561,6 +564,111 @@ public:
       int64 FeatureID,
       double DefaultValue = 0.0);
 
+  /**
+   * Retrieves the values for the given features as a Boolean column, in
+   * the same order as the feature IDs. Each value is converted exactly as
+   * {@link GetBoolean} would, but the property's type is only resolved once
+   * for the whole batch, which makes this much faster when querying many
+   * features at once.
+   *
+   * @param Property The property table property.
+   * @param FeatureIDs The IDs of the features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The property values as Booleans.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<bool> GetBooleanValues(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      const TArray<int64>& FeatureIDs,
+      bool DefaultValue = false);
+
+  /**
+   * Retrieves the values for the given features as an Integer column, in
+   * the same order as the feature IDs. Each value is converted exactly as
+   * {@link GetInteger} would, but the property's type is only resolved once
+   * for the whole batch, which makes this much faster when querying many
+   * features at once.
+   *
+   * @param Property The property table property.
+   * @param FeatureIDs The IDs of the features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The property values as Integers.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<int32> GetIntegerValues(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      const TArray<int64>& FeatureIDs,
+      int32 DefaultValue = 0);
+
+  /**
+   * Retrieves the values for the given features as an Integer64 column, in
+   * the same order as the feature IDs. Each value is converted exactly as
+   * {@link GetInteger64} would, but the property's type is only resolved once
+   * for the whole batch, which makes this much faster when querying many
+   * features at once.
+   *
+   * @param Property The property table property.
+   * @param FeatureIDs The IDs of the features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The property values as Integer64s.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<int64> GetInteger64Values(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      const TArray<int64>& FeatureIDs,
+      int64 DefaultValue = 0);
+
+  /**
+   * Retrieves the values for the given features as a Float column, in
+   * the same order as the feature IDs. Each value is converted exactly as
+   * {@link GetFloat} would, but the property's type is only resolved once
+   * for the whole batch, which makes this much faster when querying many
+   * features at once.
+   *
+   * @param Property The property table property.
+   * @param FeatureIDs The IDs of the features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The property values as Floats.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<float> GetFloatValues(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      const TArray<int64>& FeatureIDs,
+      float DefaultValue = 0.0f);
+
+  /**
+   * Retrieves the values for the given features as a Float64 column, in
+   * the same order as the feature IDs. Each value is converted exactly as
+   * {@link GetFloat64} would, but the property's type is only resolved once
+   * for the whole batch, which makes this much faster when querying many
+   * features at once.
+   *
+   * @param Property The property table property.
+   * @param FeatureIDs The IDs of the features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The property values as Float64s.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      BlueprintPure,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<double> GetFloat64Values(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      const TArray<int64>& FeatureIDs,
+      double DefaultValue = 0.0);
+
   /**
    * Attempts to retrieve the value for the given feature as a FIntPoint.
    *
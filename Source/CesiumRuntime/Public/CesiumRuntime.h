@@ -8,6 +8,7 @@
 
 class ACesium3DTileset;
 class UCesiumRasterOverlay;
+class UnrealTaskProcessor;
 
 namespace CesiumAsync {
 class AsyncSystem;
@@ -70,6 +71,8 @@ DECLARE_MULTICAST_DELEGATE_OneParam(
 CESIUMRUNTIME_API extern FCesiumVoxelMetadataBuildShader
     OnCesiumVoxelMetadataBuildShader;
 
+CESIUMRUNTIME_API const std::shared_ptr<UnrealTaskProcessor>&
+getTaskProcessor();
 CESIUMRUNTIME_API CesiumAsync::AsyncSystem& getAsyncSystem() noexcept;
 CESIUMRUNTIME_API const std::shared_ptr<CesiumAsync::IAssetAccessor>&
 getAssetAccessor();
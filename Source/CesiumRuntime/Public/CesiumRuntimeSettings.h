@@ -6,6 +6,24 @@
 #include "Engine/DeveloperSettings.h"
 #include "CesiumRuntimeSettings.generated.h"
 
+/**
+ * The storage used for the cache of network requests.
+ */
+UENUM()
+enum class ECesiumRequestCacheBackend : uint8 {
+  /**
+   * A single SQLite database, bounded by the number of cached items.
+   */
+  Sqlite,
+
+  /**
+   * A directory of files, one per cached response, spread across
+   * independently-locked shards and bounded by total size. This scales better
+   * than SQLite when many tiles are loaded concurrently.
+   */
+  ShardedFiles
+};
+
 /**
  * Stores runtime settings for the Cesium plugin.
  */
@@ -45,6 +63,84 @@ public:
   UPROPERTY(Config, EditAnywhere, Category = "Experimental Feature Flags")
   bool EnableExperimentalOcclusionCullingFeature = false;
 
+  /**
+   * The number of threads in the pool that Cesium uses for background work
+   * such as decoding glTF content and generating mipmaps. If zero, the number
+   * of threads is chosen based on the number of cores in the system.
+   */
+  UPROPERTY(
+      Config,
+      EditAnywhere,
+      Category = "Threading",
+      meta = (ConfigRestartRequired = true, ClampMin = 0))
+  int WorkerThreadCount = 0;
+
+  /**
+   * Whether to read tilesets loaded from `file:///` URLs by memory-mapping
+   * their files rather than copying them into memory. This lets large local
+   * tilesets stream at disk bandwidth, but the files must not be modified or
+   * deleted while they are in use.
+   */
+  UPROPERTY(
+      Config,
+      EditAnywhere,
+      Category = "Loading",
+      meta = (ConfigRestartRequired = true))
+  bool UseMemoryMappedFileReads = false;
+
+  /**
+   * The maximum number of files that may be read at once when loading
+   * tilesets from `file:///` URLs. Additional reads wait in a queue so that
+   * large local tilesets do not starve the engine's own asset streaming.
+   */
+  UPROPERTY(
+      Config,
+      EditAnywhere,
+      Category = "Loading",
+      meta = (ConfigRestartRequired = true, ClampMin = 1))
+  int MaximumSimultaneousFileReads = 8;
+
+  /**
+   * Whether to store Gaussian splats in a compact form, both in memory and on
+   * the GPU. Scales and colors are stored as 16-bit floats, orientations as
+   * 8-bit normalized quaternions, and spherical harmonic coefficients as 8-bit
+   * values quantized to the range of each tile. This reduces the memory used
+   * per splat by roughly a factor of three, at the cost of some precision in
+   * splat shape and view-dependent color. Positions are always stored at full
+   * precision.
+   */
+  UPROPERTY(
+      Config,
+      EditAnywhere,
+      Category = "Rendering",
+      meta = (ConfigRestartRequired = true))
+  bool UseCompactGaussianSplats = false;
+
+  /**
+   * The maximum GPU memory, in megabytes, to use for the textures of all
+   * tilesets and raster overlays combined, or 0 for no limit.
+   *
+   * When textures exceed this budget, the tile caches of all tilesets shrink so
+   * that the least recently visible tiles and their textures are unloaded
+   * first, and new textures skip their most detailed mip level. Tiles that are
+   * currently visible are never unloaded, so usage can still exceed the budget
+   * if the visible tiles alone need more than this. Current usage is shown by
+   * the `stat CesiumTextures` console command.
+   */
+  UPROPERTY(Config, EditAnywhere, Category = "Rendering", meta = (ClampMin = 0))
+  int MaximumTextureMegabytes = 0;
+
+  /**
+   * The storage used for the request cache.
+   */
+  UPROPERTY(
+      Config,
+      EditAnywhere,
+      Category = "Cache",
+      meta = (ConfigRestartRequired = true))
+  ECesiumRequestCacheBackend RequestCacheBackend =
+      ECesiumRequestCacheBackend::Sqlite;
+
   /**
    * The number of requests to handle before each prune of old cached results
    * from the database.
@@ -67,6 +163,21 @@ public:
       meta = (ConfigRestartRequired = true))
   int MaxCacheItems = 4096;
 
+  /**
+   * The maximum total size, in megabytes, of the responses kept in the request
+   * cache when the Sharded Files backend is used.
+   */
+  UPROPERTY(
+      Config,
+      EditAnywhere,
+      Category = "Cache",
+      meta =
+          (ConfigRestartRequired = true,
+           ClampMin = 1,
+           EditCondition =
+               "RequestCacheBackend == ECesiumRequestCacheBackend::ShardedFiles"))
+  int MaxCacheMegabytes = 1024;
+
   /**
    * Clears all entries from the request cache database.
    */
@@ -8,12 +8,45 @@
 #include "Containers/UnrealString.h"
 #include "HAL/Platform.h"
 #include <cstddef>
+#include <functional>
+#include <memory>
 
 class CESIUMRUNTIME_API UnrealAssetAccessor
     : public CesiumAsync::IAssetAccessor {
 public:
+  /**
+   * A function that reads the file at a `file:///` URL. It is called from the
+   * engine's I/O thread pool.
+   */
+  using FileReader = std::function<std::shared_ptr<CesiumAsync::IAssetRequest>(
+      const std::string& url)>;
+
+  /**
+   * Constructs an accessor that reads `file:///` URLs in the way specified by
+   * {@link UCesiumRuntimeSettings::UseMemoryMappedFileReads}.
+   */
   UnrealAssetAccessor();
 
+  /**
+   * Constructs an accessor. If `useMemoryMappedFiles` is true and the platform
+   * supports it, the data of `file:///` responses points directly into a
+   * read-only memory mapping of the file rather than into a copy of it. At
+   * most `maximumSimultaneousFileReads` files are read at once; further
+   * `file:///` requests wait in a queue.
+   */
+  explicit UnrealAssetAccessor(
+      bool useMemoryMappedFiles,
+      int32 maximumSimultaneousFileReads = 8);
+
+  /**
+   * Constructs an accessor that reads `file:///` URLs with the given function
+   * instead of from the file system, at most `maximumSimultaneousFileReads` at
+   * once. This is mostly useful for testing.
+   */
+  UnrealAssetAccessor(
+      FileReader&& fileReader,
+      int32 maximumSimultaneousFileReads);
+
   virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
   get(const CesiumAsync::AsyncSystem& asyncSystem,
       const std::string& url,
@@ -30,12 +63,23 @@ public:
 
   virtual void tick() noexcept override;
 
+  /**
+   * Gets the number of `file:///` reads that are waiting for one of the
+   * simultaneous reads to finish.
+   */
+  int32 getQueuedFileReadCount() const;
+
 private:
   CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> getFromFile(
       const CesiumAsync::AsyncSystem& asyncSystem,
       const std::string& url,
       const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers);
 
+  void initializeRequestHeaders();
+
+  class FileReadQueue;
+
   FString _userAgent;
   TMap<FString, FString> _cesiumRequestHeaders;
+  std::shared_ptr<FileReadQueue> _pFileReadQueue;
 };
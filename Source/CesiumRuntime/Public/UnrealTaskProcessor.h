@@ -4,9 +4,151 @@
 
 #include "CesiumAsync/ITaskProcessor.h"
 #include "HAL/Platform.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 
+class FQueuedThreadPool;
+
+/**
+ * An {@link CesiumAsync::ITaskProcessor} that runs cesium-native background
+ * work in a dedicated pool of Cesium worker threads, rather than competing
+ * first-in-first-out with the engine's own background tasks.
+ *
+ * Each task is assigned to a priority lane. Work in a higher priority lane is
+ * always dequeued before work in a lower priority lane, so stale preload or
+ * maintenance work cannot delay the content of currently-visible tiles. The
+ * lane of a new task is taken from the innermost {@link ScopedPriority} on the
+ * calling thread. Tasks inherit the lane of the task that started them, so a
+ * chain of continuations stays in the lane in which it began. Requests made
+ * through {@link UnrealAssetAccessor} complete in the lane they were made in,
+ * even though they finish on HTTP or I/O threads.
+ */
 class CESIUMRUNTIME_API UnrealTaskProcessor
     : public CesiumAsync::ITaskProcessor {
 public:
+  /**
+   * The priority lanes of the task processor, from most to least urgent.
+   */
+  enum class Priority : uint8 {
+    /**
+     * Work needed to render tiles that are currently visible.
+     */
+    Visible,
+
+    /**
+     * Work for tiles that are not yet visible, such as preloaded siblings and
+     * ancestors. This is the lane used when no other lane is specified.
+     */
+    Preload,
+
+    /**
+     * Maintenance work that is never on the critical path for rendering, such
+     * as pruning the request cache.
+     */
+    Background
+  };
+
+  static constexpr size_t PriorityCount = 3;
+
+  /**
+   * Statistics about the tasks dispatched to a single priority lane.
+   */
+  struct LaneStatistics {
+    /**
+     * The number of tasks that are queued in this lane but have not yet
+     * started.
+     */
+    uint32 queued = 0;
+
+    /**
+     * The total number of tasks in this lane that have started executing.
+     */
+    uint64 started = 0;
+
+    /**
+     * The mean time, in seconds, that started tasks spent waiting in the
+     * queue.
+     */
+    double averageLatencySeconds = 0.0;
+
+    /**
+     * The longest time, in seconds, that any started task spent waiting in the
+     * queue.
+     */
+    double maximumLatencySeconds = 0.0;
+  };
+
+  /**
+   * Sets the lane used for tasks started from the current thread for the
+   * lifetime of this object.
+   */
+  class CESIUMRUNTIME_API ScopedPriority {
+  public:
+    explicit ScopedPriority(Priority priority) noexcept;
+    ~ScopedPriority() noexcept;
+
+    ScopedPriority(const ScopedPriority&) = delete;
+    ScopedPriority& operator=(const ScopedPriority&) = delete;
+
+  private:
+    Priority _previous;
+  };
+
+  /**
+   * Gets the lane used for tasks started from the current thread. Inside a
+   * task, this is the lane the task was started in.
+   */
+  static Priority getCurrentPriority() noexcept;
+
+  /**
+   * Constructs a task processor with the number of worker threads specified
+   * by {@link UCesiumRuntimeSettings::WorkerThreadCount}.
+   */
+  UnrealTaskProcessor();
+
+  /**
+   * Constructs a task processor with the given number of worker threads. If
+   * the count is zero or less, the number of threads is chosen based on the
+   * number of cores in the system.
+   */
+  explicit UnrealTaskProcessor(int32 threadCount);
+
+  virtual ~UnrealTaskProcessor();
+
   virtual void startTask(std::function<void()> f) override;
+
+  /**
+   * Waits for the worker threads to exit and releases them. Tasks started
+   * after this call are dispatched to the engine's background task system
+   * instead. This must be called before engine shutdown, because the worker
+   * threads cannot be safely joined from static destructors.
+   */
+  void shutdown();
+
+  /**
+   * Gets the number of threads in the Cesium worker pool, or zero if the pool
+   * is not running.
+   */
+  int32 getThreadCount() const noexcept;
+
+  /**
+   * Gets a snapshot of the statistics for the given priority lane.
+   */
+  LaneStatistics getStatistics(Priority priority) const noexcept;
+
+private:
+  struct LaneCounters {
+    std::atomic<uint32> queued{0};
+    std::atomic<uint64> started{0};
+    std::atomic<uint64> totalLatencyCycles{0};
+    std::atomic<uint64> maximumLatencyCycles{0};
+  };
+
+  class FCesiumQueuedTask;
+
+  std::atomic<FQueuedThreadPool*> _pPool;
+  std::atomic<int32> _threadCount;
+  std::array<LaneCounters, PriorityCount> _lanes;
 };